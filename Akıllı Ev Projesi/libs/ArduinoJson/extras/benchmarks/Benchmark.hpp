@@ -0,0 +1,20 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <chrono>
+#include <stdio.h>
+
+// Returns the average duration of f(), in nanoseconds
+template <typename TFunction>
+double measure(TFunction f, int iterations = 1) {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++)
+    f();
+  auto stop = std::chrono::steady_clock::now();
+  auto elapsed =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start);
+  return double(elapsed.count()) / iterations;
+}
@@ -0,0 +1,38 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+// Reads every element of arrays of increasing sizes with operator[] and
+// size().
+// With ARDUINOJSON_ENABLE_ARRAY_INDEX, the time per element must remain
+// constant; without it, it grows linearly with the number of elements.
+
+#include <ArduinoJson.h>
+
+#include "Benchmark.hpp"
+
+int main() {
+  printf("ARDUINOJSON_ENABLE_ARRAY_INDEX = %d\n",
+         ARDUINOJSON_ENABLE_ARRAY_INDEX);
+  printf("%8s %12s %12s\n", "elements", "total (us)", "per elem (ns)");
+
+  for (int n = 1250; n <= 10000; n *= 2) {
+    JsonDocument doc;
+    JsonArray arr = doc.to<JsonArray>();
+    for (int i = 0; i < n; i++)
+      arr.add(i);
+
+    long sum = 0;
+    double ns = measure([&]() {
+      for (size_t i = 0; i < arr.size(); i++)
+        sum += arr[i].as<int>();
+    });
+    if (sum != long(n) * (n - 1) / 2) {
+      fprintf(stderr, "unexpected sum %ld\n", sum);
+      return 1;
+    }
+    printf("%8d %12.0f %12.1f\n", n, ns / 1000, ns / n);
+  }
+
+  return 0;
+}
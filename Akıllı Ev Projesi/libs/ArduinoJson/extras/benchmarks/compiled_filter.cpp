@@ -0,0 +1,64 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+// Parses a large input with a wide filter, either interpreted
+// (DeserializationOption::Filter) or compiled (compileFilter()).
+
+#include <ArduinoJson.h>
+
+#include <string>
+
+#include "Benchmark.hpp"
+
+static std::string makeInput() {
+  JsonDocument doc;
+  for (int i = 0; i < 100; i++) {
+    JsonObject record = doc.add<JsonObject>();
+    for (int j = 0; j < 50; j++)
+      record["field" + std::to_string(j)] = i * j;
+  }
+  std::string json;
+  serializeJson(doc, json);
+  return json;
+}
+
+int main() {
+  auto json = makeInput();
+
+  // keep one field out of two
+  JsonDocument filter;
+  for (int j = 0; j < 50; j += 2)
+    filter[0]["field" + std::to_string(j)] = true;
+  auto compiled = compileFilter(filter);
+
+  JsonDocument doc;
+  size_t checksum = 0;
+
+  double interpreted = measure(
+      [&]() {
+        deserializeJson(doc, json, DeserializationOption::Filter(filter));
+        checksum += doc[99].size();
+      },
+      100);
+
+  double fast = measure(
+      [&]() {
+        deserializeJson(doc, json, compiled);
+        checksum += doc[99].size();
+      },
+      100);
+
+  double unfiltered = measure(
+      [&]() {
+        deserializeJson(doc, json);
+        checksum += doc[99].size();
+      },
+      100);
+
+  printf("input: %zu bytes, checksum: %zu\n", json.size(), checksum);
+  printf("Filter:          %8.1f us\n", interpreted / 1e3);
+  printf("compileFilter(): %8.1f us\n", fast / 1e3);
+  printf("no filter:       %8.1f us\n", unfiltered / 1e3);
+  return 0;
+}
@@ -0,0 +1,68 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+// Parses a float-heavy document shaped like canada.json: a GeoJSON polygon
+// with 100k coordinates written with 17 significant digits.
+// Compare the throughput and the accuracy with and without
+// ARDUINOJSON_ENABLE_EXACT_FLOAT_PARSING.
+
+#include <ArduinoJson.h>
+
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+static std::vector<double> makeCoordinates() {
+  std::vector<double> values;
+  uint64_t state = 42;
+  for (int i = 0; i < 200000; i++) {
+    state = state * 6364136223846793005 + 1442695040888963407;
+    double x = double(state >> 11) / double(uint64_t(1) << 53);
+    values.push_back(i % 2 ? x * 90 : x * 360 - 180);
+  }
+  return values;
+}
+
+static std::string makeInput(const std::vector<double>& values) {
+  std::string json =
+      "{\"type\":\"FeatureCollection\",\"features\":[{\"type\":\"Feature\","
+      "\"geometry\":{\"type\":\"Polygon\",\"coordinates\":[[";
+  char buffer[64];
+  for (size_t i = 0; i < values.size(); i += 2) {
+    if (i)
+      json += ",";
+    snprintf(buffer, sizeof(buffer), "[%.17g,%.17g]", values[i], values[i + 1]);
+    json += buffer;
+  }
+  json += "]]}}]}";
+  return json;
+}
+
+int main() {
+  printf("ARDUINOJSON_ENABLE_EXACT_FLOAT_PARSING = %d\n",
+         ARDUINOJSON_ENABLE_EXACT_FLOAT_PARSING);
+
+  auto values = makeCoordinates();
+  auto json = makeInput(values);
+  JsonDocument doc;
+  double ns = measure([&]() { deserializeJson(doc, json); }, 10);
+  printf("%.1f MB in %.1f ms: %.1f MB/s\n", double(json.size()) / 1e6, ns / 1e6,
+         double(json.size()) / ns * 1e3);
+
+  JsonArray coordinates =
+      doc["features"][0]["geometry"]["coordinates"][0].as<JsonArray>();
+  size_t inexact = 0, i = 0;
+  for (JsonArray point : coordinates) {
+    inexact += point[0].as<double>() != values[i++];
+    inexact += point[1].as<double>() != values[i++];
+  }
+  if (i != values.size()) {
+    fprintf(stderr, "unexpected size %zu\n", i);
+    return 1;
+  }
+  printf("%zu of %zu values don't round trip\n", inexact, values.size());
+  return 0;
+}
@@ -0,0 +1,43 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+// Parses objects with an increasing number of members.
+// With ARDUINOJSON_ENABLE_OBJECT_INDEX, the time per member must remain
+// constant; without it, it grows linearly with the number of members.
+
+#include <ArduinoJson.h>
+
+#include <string>
+
+#include "Benchmark.hpp"
+
+static std::string makeObject(int n) {
+  std::string json = "{";
+  for (int i = 0; i < n; i++) {
+    if (i)
+      json += ",";
+    json += "\"key" + std::to_string(i) + "\":" + std::to_string(i);
+  }
+  json += "}";
+  return json;
+}
+
+int main() {
+  printf("ARDUINOJSON_ENABLE_OBJECT_INDEX = %d\n",
+         ARDUINOJSON_ENABLE_OBJECT_INDEX);
+  printf("%8s %12s %12s\n", "members", "total (us)", "per key (ns)");
+
+  JsonDocument doc;
+  for (int n = 1250; n <= 10000; n *= 2) {
+    auto json = makeObject(n);
+    double ns = measure([&]() { deserializeJson(doc, json); }, 5);
+    if (doc.size() != size_t(n)) {
+      fprintf(stderr, "unexpected size %zu\n", doc.size());
+      return 1;
+    }
+    printf("%8d %12.0f %12.1f\n", n, ns / 1000, ns / n);
+  }
+
+  return 0;
+}
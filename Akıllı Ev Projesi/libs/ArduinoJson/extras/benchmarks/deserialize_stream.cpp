@@ -0,0 +1,66 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+// Parses a stream of concatenated JSON and MessagePack documents from a
+// std::istream, like a log file or a socket.
+
+#include <ArduinoJson.h>
+
+#include <sstream>
+#include <string>
+
+#include "Benchmark.hpp"
+
+static void fill(JsonDocument& doc, int i) {
+  doc.clear();
+  doc["id"] = i;
+  doc["name"] = "sensor #" + std::to_string(i);
+  doc["description"] =
+      "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do "
+      "eiusmod tempor incididunt ut labore et dolore magna aliqua";
+  doc["values"].add(i * 1.5);
+  doc["values"].add(i * 2.5);
+  doc["enabled"] = i % 2 == 0;
+}
+
+template <typename TDeserialize>
+static void run(const char* name, const std::string& input,
+                TDeserialize deserialize) {
+  std::istringstream stream;
+  JsonDocument doc;
+  int count = 0;
+  double ns = measure(
+      [&]() {
+        stream.clear();
+        stream.str(input);
+        count = 0;
+        while (deserialize(doc, stream) == DeserializationError::Ok)
+          count++;
+      },
+      20);
+  if (count != 10000) {
+    fprintf(stderr, "%s: unexpected count %d\n", name, count);
+    exit(1);
+  }
+  printf("%-10s %10.1f MB/s\n", name, double(input.size()) / ns * 1e3);
+}
+
+int main() {
+  std::ostringstream json, msgpack;
+  JsonDocument doc;
+  for (int i = 0; i < 10000; i++) {
+    fill(doc, i);
+    serializeJson(doc, json);
+    json << '\n';
+    serializeMsgPack(doc, msgpack);
+  }
+
+  run("JSON", json.str(), [](JsonDocument& d, std::istream& s) {
+    return deserializeJson(d, s);
+  });
+  run("MsgPack", msgpack.str(), [](JsonDocument& d, std::istream& s) {
+    return deserializeMsgPack(d, s);
+  });
+  return 0;
+}
@@ -0,0 +1,93 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+// Parses an array of long strings from different inputs.
+// The inputs that expose their buffer (const char*, std::string) are scanned
+// in bulk; the others are read one character at a time.
+// The in-situ parser doesn't copy the strings, but it needs a fresh copy of the
+// input each time, which is included in the measure.
+
+#include <ArduinoJson.h>
+
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+// Reads a buffer one character at a time
+class CharByCharReader {
+ public:
+  CharByCharReader(const std::string& s)
+      : ptr_(s.data()), end_(s.data() + s.size()) {}
+
+  int read() {
+    return ptr_ < end_ ? static_cast<unsigned char>(*ptr_++) : -1;
+  }
+
+  size_t readBytes(char* buffer, size_t length) {
+    size_t n = 0;
+    while (n < length && ptr_ < end_)
+      buffer[n++] = *ptr_++;
+    return n;
+  }
+
+ private:
+  const char* ptr_;
+  const char* end_;
+};
+
+static std::string makeInput() {
+  std::string json = "[";
+  for (int i = 0; i < 1000; i++) {
+    if (i)
+      json += ",";
+    json += "\"Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do "
+            "eiusmod tempor incididunt ut labore et dolore magna aliqua #" +
+            std::to_string(i) + "\\n\"";
+  }
+  json += "]";
+  return json;
+}
+
+template <typename TFunction>
+static void run(const char* name, size_t size, TFunction f) {
+  double ns = measure(f, 50);
+  printf("%-18s %10.1f MB/s\n", name, double(size) / ns * 1e3);
+}
+
+int main() {
+  JsonDocument doc;
+  auto json = makeInput();
+
+  run("const char*", json.size(),
+      [&]() { deserializeJson(doc, json.c_str()); });
+  run("std::string", json.size(), [&]() { deserializeJson(doc, json); });
+  run("char by char", json.size(), [&]() {
+    CharByCharReader reader(json);
+    deserializeJson(doc, reader);
+  });
+  std::vector<char> buffer(json.size());
+  run("in situ", json.size(), [&]() {
+    buffer.assign(json.begin(), json.end());
+    deserializeJsonInSitu(doc, buffer.data(), buffer.size());
+  });
+
+  // the strings are skipped when they are filtered out
+  JsonDocument filter;
+  filter[0] = false;
+  auto skip = DeserializationOption::Filter(filter);
+  run("skip const char*", json.size(),
+      [&]() { deserializeJson(doc, json.c_str(), skip); });
+  run("skip char by char", json.size(), [&]() {
+    CharByCharReader reader(json);
+    deserializeJson(doc, reader, skip);
+  });
+
+  deserializeJson(doc, json);
+  if (doc.size() != 1000) {
+    fprintf(stderr, "unexpected size %zu\n", doc.size());
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,79 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+// Parses messages on 1, 4, and 16 threads, either with a new JsonDocument for
+// each message, or with documents from a JsonDocumentPool.
+// With the pool, the throughput should grow with the number of threads, as
+// the documents don't call the allocator once the pool is warm.
+
+#include <ArduinoJson.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+static const int messagesPerThread = 20000;
+
+static std::string makeMessage(int i) {
+  return "{\"id\":" + std::to_string(i) + ",\"name\":\"sensor #" +
+         std::to_string(i) +
+         "\",\"values\":[1.5,2.5,3.5,4.5],\"tags\":[\"kitchen\",\"first "
+         "floor\",\"temperature\"],\"enabled\":true}";
+}
+
+template <typename TParse>
+static double run(int threadCount, TParse parse) {
+  std::vector<std::string> messages;
+  for (int i = 0; i < 16; i++)
+    messages.push_back(makeMessage(i));
+
+  return measure([&]() {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+      threads.emplace_back([&]() {
+        for (int i = 0; i < messagesPerThread; i++)
+          parse(messages[size_t(i) % messages.size()]);
+      });
+    }
+    for (auto& thread : threads)
+      thread.join();
+  });
+}
+
+int main() {
+  printf("%8s %20s %20s %20s\n", "threads", "new doc (msg/ms)", "pool (msg/ms)",
+         "pool+arena (msg/ms)");
+
+  JsonDocumentPool pool;
+
+  JsonDocumentPool::Options options;
+  options.arenaBlockSize = 4096;
+  JsonDocumentPool poolWithArenas(options);
+
+  for (int threadCount : {1, 4, 16}) {
+    double messages = double(threadCount) * messagesPerThread;
+
+    double newDoc = run(threadCount, [](const std::string& input) {
+      JsonDocument doc;
+      deserializeJson(doc, input);
+    });
+
+    double pooled = run(threadCount, [&](const std::string& input) {
+      auto doc = pool.acquire();
+      deserializeJson(*doc, input);
+    });
+
+    double arenas = run(threadCount, [&](const std::string& input) {
+      auto doc = poolWithArenas.acquire();
+      deserializeJson(*doc, input);
+    });
+
+    printf("%8d %20.0f %20.0f %20.0f\n", threadCount, messages * 1e6 / newDoc,
+           messages * 1e6 / pooled, messages * 1e6 / arenas);
+  }
+
+  return 0;
+}
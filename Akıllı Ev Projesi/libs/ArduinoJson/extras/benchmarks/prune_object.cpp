@@ -0,0 +1,42 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+// Removes half the members of objects of increasing sizes while iterating.
+// With ARDUINOJSON_DOUBLY_LINKED_COLLECTIONS, the time per removal must
+// remain constant; without it, it grows linearly with the number of members.
+// Releasing the keys also scans the string pool, unless
+// ARDUINOJSON_ENABLE_STRING_INDEX is set.
+
+#include <ArduinoJson.h>
+
+#include <string>
+
+#include "Benchmark.hpp"
+
+int main() {
+  printf("ARDUINOJSON_DOUBLY_LINKED_COLLECTIONS = %d\n",
+         ARDUINOJSON_DOUBLY_LINKED_COLLECTIONS);
+  printf("%8s %12s %12s\n", "members", "total (us)", "per remove (ns)");
+
+  for (int n = 2500; n <= 20000; n *= 2) {
+    JsonDocument doc;
+    JsonObject obj = doc.to<JsonObject>();
+    for (int i = 0; i < n; i++)
+      obj[std::to_string(i)] = i;
+
+    double ns = measure([&]() {
+      for (auto it = obj.begin(); it != obj.end(); ++it) {
+        if (it->value().as<int>() % 2 == 0)
+          obj.remove(it);
+      }
+    });
+    if (obj.size() != size_t(n / 2)) {
+      fprintf(stderr, "unexpected size %zu\n", obj.size());
+      return 1;
+    }
+    printf("%8d %12.0f %12.1f\n", n, ns / 1000, ns / (n / 2));
+  }
+
+  return 0;
+}
@@ -0,0 +1,64 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+// Serializes an array of 100k doubles, then floats: half are sensor readings
+// with two decimals, half are arbitrary values.
+// Compare the throughput, the size, and the accuracy with and without
+// ARDUINOJSON_ENABLE_SHORTEST_FLOAT_FORMATTING.
+
+#include <ArduinoJson.h>
+
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+static std::vector<double> makeValues() {
+  std::vector<double> values;
+  uint64_t state = 42;
+  for (int i = 0; i < 100000; i++) {
+    state = state * 6364136223846793005 + 1442695040888963407;
+    double x = double(state >> 11) / double(uint64_t(1) << 53);
+    values.push_back(i % 2 ? double(int(x * 10000)) / 100 : x * 1000);
+  }
+  return values;
+}
+
+template <typename T>
+static void run(const char* name, const std::vector<double>& values) {
+  JsonDocument doc;
+  for (double value : values)
+    doc.add(T(value));
+
+  std::string json;
+  double ns = measure(
+      [&]() {
+        json.clear();
+        serializeJson(doc, json);
+      },
+      20);
+  printf("%s: %.1f MB in %.1f ms, %.1f ns per value\n", name,
+         double(json.size()) / 1e6, ns / 1e6, ns / double(values.size()));
+
+  size_t inexact = 0, i = 0;
+  const char* p = json.c_str() + 1;
+  while (i < values.size()) {
+    char* end;
+    inexact += T(strtod(p, &end)) != T(values[i++]);
+    p = end + 1;
+  }
+  printf("%s: %zu of %zu values don't round trip\n", name, inexact,
+         values.size());
+}
+
+int main() {
+  printf("ARDUINOJSON_ENABLE_SHORTEST_FLOAT_FORMATTING = %d\n",
+         ARDUINOJSON_ENABLE_SHORTEST_FLOAT_FORMATTING);
+
+  auto values = makeValues();
+  run<double>("double", values);
+  run<float>("float", values);
+  return 0;
+}
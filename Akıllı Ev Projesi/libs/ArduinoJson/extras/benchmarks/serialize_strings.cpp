@@ -0,0 +1,85 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+// Serializes an array of long strings to different writers, with mostly
+// ASCII strings and with strings that need a lot of escaping.
+
+#include <ArduinoJson.h>
+
+#include <sstream>
+#include <string>
+
+#include "Benchmark.hpp"
+
+// Collects the output one byte at a time, like a Print without a buffer
+class CharByCharWriter {
+ public:
+  size_t write(uint8_t c) {
+    output_ += char(c);
+    return 1;
+  }
+
+  size_t write(const uint8_t* s, size_t n) {
+    output_.append(reinterpret_cast<const char*>(s), n);
+    return n;
+  }
+
+  void clear() {
+    output_.clear();
+  }
+
+ private:
+  std::string output_;
+};
+
+static void fill(JsonDocument& doc, const char* pattern) {
+  doc.clear();
+  for (int i = 0; i < 1000; i++)
+    doc.add(std::string(pattern) + std::to_string(i));
+}
+
+template <typename TFunction>
+static void run(const char* name, size_t size, TFunction f) {
+  double ns = measure(f, 50);
+  printf("%-24s %10.1f MB/s\n", name, double(size) / ns * 1e3);
+}
+
+static void runAll(const char* name, const JsonDocument& doc) {
+  size_t size = measureJson(doc);
+  printf("%s (%zu bytes)\n", name, size);
+
+  std::string str;
+  run("  std::string", size, [&]() {
+    str.clear();
+    serializeJson(doc, str);
+  });
+
+  std::ostringstream os;
+  run("  std::ostream", size, [&]() {
+    os.str("");
+    serializeJson(doc, os);
+  });
+
+  CharByCharWriter writer;
+  run("  custom writer", size, [&]() {
+    writer.clear();
+    serializeJson(doc, writer);
+  });
+
+  run("  measureJson()", size, [&]() { measureJson(doc); });
+}
+
+int main() {
+  JsonDocument doc;
+
+  fill(doc,
+       "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do "
+       "eiusmod tempor incididunt ut labore et dolore magna aliqua #");
+  runAll("ASCII-heavy", doc);
+
+  fill(doc, "C:\\Users\\\"Lorem\"\\ipsum\\dolor\tsit\tamet\r\n");
+  runAll("escape-heavy", doc);
+
+  return 0;
+}
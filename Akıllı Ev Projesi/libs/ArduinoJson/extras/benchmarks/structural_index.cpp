@@ -0,0 +1,195 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+// Estimates what a two-stage parser could gain on a large in-memory input.
+// Stage 1 would find the structural characters ({}[]:, and the quotes outside
+// of strings) by blocks of 64 bytes; stage 2 would build the same document
+// from these positions.
+// This benchmark measures:
+// - "parse": deserializeJson(), which scans and builds,
+// - "skip": deserializeJson() with a filter that rejects everything, which
+//   scans the whole input with the current parser but builds nothing,
+// - "stage 1": the structural index of the prototype below.
+// Stage 2 still has to convert every number and store every string, so the
+// two-stage parser can't take less than stage 1 + (parse - skip), nor less
+// than (parse - skip) with a stage 1 that would take no time at all.
+//
+// Results on an x86-64 Xeon (GCC 12.2, -O2, 3 runs):
+//   input: 4.4 MB, 1180001 structural characters
+//   parse                       73.3 to  89.1 MB/s
+//   skip                       752.7 to 787.0 MB/s
+//   stage 1                    122.3 to 129.6 MB/s
+//   two stages                  49.8 to  55.4 MB/s
+//   two stages, free stage 1    81.0 to 101.1 MB/s
+//   scanning is 9% to 12% of the parse time
+// Building the document takes most of the time, so even a free stage 1 would
+// make the parse at most 1.14 times faster; with this stage 1, it's slower.
+
+#include <ArduinoJson.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+static std::string makeInput() {
+  std::string json = "[";
+  for (int i = 0; i < 20000; i++) {
+    if (i)
+      json += ",";
+    json += "{\"id\":" + std::to_string(i) +
+            ",\"sensor\":\"temperature-" + std::to_string(i % 16) +
+            "\",\"location\":\"building A, floor 3, room 12\""
+            ",\"timestamp\":\"2025-04-11T12:34:" +
+            std::to_string(10 + i % 50) +
+            "Z\",\"value\":" + std::to_string(20 + (i % 1000) / 100.0) +
+            ",\"tags\":[\"calibrated\",\"indoor\",\"escaped \\\"tag\\\"\"]"
+            ",\"history\":[1,2,3,4,5,6,7,8],\"ok\":true}";
+  }
+  json += "]";
+  return json;
+}
+
+// Returns the bits of the characters that are equal to c
+static uint64_t matches(const char* block, char c) {
+  uint64_t bits = 0;
+  for (int i = 0; i < 64; i++)
+    bits |= uint64_t(block[i] == c) << i;
+  return bits;
+}
+
+// Returns the bits between an opening quote (included) and a closing quote
+// (excluded)
+static uint64_t prefixXor(uint64_t bits) {
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+// Stage 1 of the prototype: appends the positions of the structural
+// characters and of the quotes that open or close a string
+static void buildStructuralIndex(const std::string& json,
+                                 std::vector<uint32_t>& positions) {
+  const uint64_t evenBits = 0x5555555555555555ULL;
+  uint64_t prevEscaped = 0;   // 1 if the first character is escaped
+  uint64_t prevInString = 0;  // all ones if the previous block ends in a string
+  char block[64];
+
+  positions.clear();
+  for (size_t offset = 0; offset < json.size(); offset += 64) {
+    size_t n = json.size() - offset;
+    if (n >= 64) {
+      memcpy(block, json.data() + offset, 64);
+    } else {
+      memcpy(block, json.data() + offset, n);
+      memset(block + n, ' ', 64 - n);
+    }
+
+    // the characters preceded by an odd number of backslashes are escaped
+    uint64_t backslashes = matches(block, '\\') & ~prevEscaped;
+    uint64_t followsEscape = (backslashes << 1) | prevEscaped;
+    uint64_t oddStarts = backslashes & ~evenBits & ~followsEscape;
+    uint64_t evenSequences = oddStarts + backslashes;
+    prevEscaped = evenSequences < oddStarts ? 1 : 0;  // carry
+    uint64_t escaped = (evenBits ^ (evenSequences << 1)) & followsEscape;
+
+    uint64_t quotes = matches(block, '"') & ~escaped;
+    uint64_t inString = prefixXor(quotes) ^ prevInString;
+    prevInString = uint64_t(int64_t(inString) >> 63);
+
+    uint64_t operators = matches(block, '{') | matches(block, '}') |
+                         matches(block, '[') | matches(block, ']') |
+                         matches(block, ':') | matches(block, ',');
+    uint64_t structurals = (operators & ~inString) | quotes;
+
+    while (structurals) {
+#if defined(__GNUC__)
+      int i = __builtin_ctzll(structurals);
+#else
+      int i = 0;
+      while (!(structurals & (uint64_t(1) << i)))
+        i++;
+#endif
+      positions.push_back(uint32_t(offset + size_t(i)));
+      structurals &= structurals - 1;
+    }
+  }
+}
+
+// The same positions, one character at a time
+static void scanStructuralCharacters(const std::string& json,
+                                     std::vector<uint32_t>& positions) {
+  bool inString = false, escaped = false;
+  positions.clear();
+  for (size_t i = 0; i < json.size(); i++) {
+    char c = json[i];
+    if (escaped) {
+      escaped = false;
+    } else if (c == '\\') {
+      escaped = true;
+    } else if (c == '"') {
+      inString = !inString;
+      positions.push_back(uint32_t(i));
+    } else if (!inString && strchr("{}[]:,", c)) {
+      positions.push_back(uint32_t(i));
+    }
+  }
+}
+
+static double megabytesPerSecond(size_t size, double ns) {
+  return double(size) / ns * 1e3;
+}
+
+int main() {
+  auto json = makeInput();
+  JsonDocument doc;
+  JsonDocument filter;
+  filter = false;
+  std::vector<uint32_t> positions;
+  positions.reserve(json.size() / 4);
+
+  const int iterations = 10;
+  double parse = measure([&]() { deserializeJson(doc, json); }, iterations);
+  double skip = measure(
+      [&]() {
+        deserializeJson(doc, json, DeserializationOption::Filter(filter));
+      },
+      iterations);
+  double stage1 =
+      measure([&]() { buildStructuralIndex(json, positions); }, iterations);
+  double twoStages = stage1 + (parse - skip);
+
+  std::vector<uint32_t> expected;
+  scanStructuralCharacters(json, expected);
+  if (positions != expected) {
+    fprintf(stderr, "stage 1 found wrong positions\n");
+    return 1;
+  }
+
+  deserializeJson(doc, json);
+  if (doc.size() != 20000) {
+    fprintf(stderr, "unexpected size %zu\n", doc.size());
+    return 1;
+  }
+
+  printf("input: %.1f MB, %zu structural characters\n",
+         double(json.size()) / 1e6, positions.size());
+  printf("%-26s %10.1f MB/s\n", "parse",
+         megabytesPerSecond(json.size(), parse));
+  printf("%-26s %10.1f MB/s\n", "skip", megabytesPerSecond(json.size(), skip));
+  printf("%-26s %10.1f MB/s\n", "stage 1",
+         megabytesPerSecond(json.size(), stage1));
+  printf("%-26s %10.1f MB/s\n", "two stages",
+         megabytesPerSecond(json.size(), twoStages));
+  printf("%-26s %10.1f MB/s\n", "two stages, free stage 1",
+         megabytesPerSecond(json.size(), parse - skip));
+  printf("scanning is %.0f%% of the parse time\n", skip / parse * 100);
+  return 0;
+}
@@ -0,0 +1,11 @@
+#include <ArduinoJson.h>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  JsonDocument doc;
+  DeserializationError error = deserializeCbor(doc, data, size);
+  if (!error) {
+    std::string cbor;
+    serializeCbor(doc, cbor);
+  }
+  return 0;
+}
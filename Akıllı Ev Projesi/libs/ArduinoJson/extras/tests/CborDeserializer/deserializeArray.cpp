@@ -0,0 +1,62 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include "Literals.hpp"
+
+static std::string deserialize(const std::string& input) {
+  JsonDocument doc;
+  DeserializationError error = deserializeCbor(doc, input);
+  REQUIRE(error == DeserializationError::Ok);
+  return doc.as<std::string>();
+}
+
+TEST_CASE("deserialize CBOR array") {
+  SECTION("empty") {
+    JsonDocument doc;
+    REQUIRE(deserializeCbor(doc, "\x80") == DeserializationError::Ok);
+    REQUIRE(doc.is<JsonArray>());
+    REQUIRE(doc.size() == 0);
+  }
+
+  SECTION("definite length") {
+    REQUIRE(deserialize("\x83\x01\x02\x03") == "[1,2,3]");
+    REQUIRE(deserialize("\x83\x01\x82\x02\x03\x82\x04\x05") ==
+            "[1,[2,3],[4,5]]");
+  }
+
+  SECTION("one-byte length") {
+    std::string input = "\x98\x19";
+    for (char i = 1; i <= 23; i++)
+      input += i;
+    input += "\x18\x18\x18\x19";
+
+    JsonDocument doc;
+    REQUIRE(deserializeCbor(doc, input) == DeserializationError::Ok);
+    REQUIRE(doc.size() == 25);
+    REQUIRE(doc[0] == 1);
+    REQUIRE(doc[24] == 25);
+  }
+
+  SECTION("two-byte length") {
+    std::string input = "\x99\x01\x00"_s + std::string(256, '\xf5');
+
+    JsonDocument doc;
+    REQUIRE(deserializeCbor(doc, input) == DeserializationError::Ok);
+    REQUIRE(doc.size() == 256);
+    REQUIRE(doc[255] == true);
+  }
+
+  SECTION("indefinite length") {
+    REQUIRE(deserialize("\x9f\xff") == "[]");
+    REQUIRE(deserialize("\x9f\x01\x82\x02\x03\x9f\x04\x05\xff\xff") ==
+            "[1,[2,3],[4,5]]");
+    REQUIRE(deserialize("\x83\x01\x82\x02\x03\x9f\x04\x05\xff") ==
+            "[1,[2,3],[4,5]]");
+    REQUIRE(deserialize("\x83\x01\x9f\x02\x03\xff\x82\x04\x05") ==
+            "[1,[2,3],[4,5]]");
+  }
+}
@@ -0,0 +1,61 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include "Literals.hpp"
+
+static std::string deserialize(const std::string& input) {
+  JsonDocument doc;
+  DeserializationError error = deserializeCbor(doc, input);
+  REQUIRE(error == DeserializationError::Ok);
+  return doc.as<std::string>();
+}
+
+TEST_CASE("deserialize CBOR object") {
+  SECTION("empty") {
+    JsonDocument doc;
+    REQUIRE(deserializeCbor(doc, "\xa0") == DeserializationError::Ok);
+    REQUIRE(doc.is<JsonObject>());
+    REQUIRE(doc.size() == 0);
+  }
+
+  SECTION("definite length") {
+    REQUIRE(deserialize("\xa2\x61" "a\x01\x61" "b\x82\x02\x03") ==
+            "{\"a\":1,\"b\":[2,3]}");
+    REQUIRE(deserialize("\x82\x61" "a\xa1\x61" "b\x61" "c") ==
+            "[\"a\",{\"b\":\"c\"}]");
+  }
+
+  SECTION("one-byte length") {
+    std::string input = "\xb8\x18";
+    for (char c = 'A'; c < 'A' + 24; c++) {
+      input += "\x61";
+      input += c;
+      input += "\xf6";
+    }
+
+    JsonDocument doc;
+    REQUIRE(deserializeCbor(doc, input) == DeserializationError::Ok);
+    REQUIRE(doc.size() == 24);
+    REQUIRE(doc["X"].isNull());
+  }
+
+  SECTION("indefinite length") {
+    REQUIRE(deserialize("\xbf\xff") == "{}");
+    REQUIRE(deserialize("\xbf\x61" "a\x01\x61" "b\x9f\x02\x03\xff\xff") ==
+            "{\"a\":1,\"b\":[2,3]}");
+    REQUIRE(deserialize("\xbf\x63" "Fun\xf5\x63" "Amt\x21\xff") ==
+            "{\"Fun\":true,\"Amt\":-2}");
+  }
+
+  SECTION("indefinite-length key") {
+    REQUIRE(deserialize("\xa1\x7f\x62he\x63llo\xff\x01") == "{\"hello\":1}");
+  }
+
+  SECTION("tagged key") {
+    REQUIRE(deserialize("\xa1\xd8\x20\x61" "a\x01") == "{\"a\":1}");
+  }
+}
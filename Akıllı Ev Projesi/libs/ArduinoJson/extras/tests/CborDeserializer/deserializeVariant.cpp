@@ -0,0 +1,171 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <limits>
+
+#include "Literals.hpp"
+
+template <typename T>
+static void checkValue(const std::string& input, T expected) {
+  JsonDocument doc;
+
+  DeserializationError error = deserializeCbor(doc, input);
+
+  REQUIRE(error == DeserializationError::Ok);
+  REQUIRE(doc.is<T>());
+  REQUIRE(doc.as<T>() == expected);
+}
+
+static void checkNull(const std::string& input) {
+  JsonDocument doc;
+
+  DeserializationError error = deserializeCbor(doc, input);
+
+  REQUIRE(error == DeserializationError::Ok);
+  REQUIRE(doc.isNull());
+}
+
+// The examples come from RFC 8949, appendix A
+TEST_CASE("deserialize CBOR value") {
+  SECTION("simple values") {
+    checkValue<bool>("\xf4", false);
+    checkValue<bool>("\xf5", true);
+    checkNull("\xf6");      // null
+    checkNull("\xf7");      // undefined
+    checkNull("\xf0");      // simple(16)
+    checkNull("\xf8\xff");  // simple(255)
+  }
+
+  SECTION("unsigned integers") {
+    checkValue<int>("\x00"_s, 0);
+    checkValue<int>("\x01", 1);
+    checkValue<int>("\x0a", 10);
+    checkValue<int>("\x17", 23);
+    checkValue<int>("\x18\x18", 24);
+    checkValue<int>("\x18\x19", 25);
+    checkValue<int>("\x18\x64", 100);
+    checkValue<int>("\x19\x03\xe8", 1000);
+    checkValue<uint32_t>("\x1a\x00\x0f\x42\x40"_s, 1000000);
+    checkValue<uint32_t>("\x1a\xff\xff\xff\xff", 0xFFFFFFFFU);
+  }
+
+  SECTION("unsigned 64-bit integers") {
+#if ARDUINOJSON_USE_LONG_LONG
+    checkValue<uint64_t>("\x1b\x00\x00\x00\xe8\xd4\xa5\x10\x00"_s,
+                         1000000000000U);
+    checkValue<uint64_t>("\x1b\xff\xff\xff\xff\xff\xff\xff\xff",
+                         0xFFFFFFFFFFFFFFFFU);
+#else
+    checkNull("\x1b\x00\x00\x00\xe8\xd4\xa5\x10\x00"_s);
+    checkNull("\x1b\xff\xff\xff\xff\xff\xff\xff\xff");
+#endif
+  }
+
+  SECTION("negative integers") {
+    checkValue<int>("\x20", -1);
+    checkValue<int>("\x29", -10);
+    checkValue<int>("\x38\x63", -100);
+    checkValue<int>("\x39\x03\xe7", -1000);
+    checkValue<int32_t>("\x3a\x7f\xff\xff\xff", -2147483647 - 1);
+  }
+
+  SECTION("negative 64-bit integers") {
+#if ARDUINOJSON_USE_LONG_LONG
+    checkValue<int64_t>("\x3b\x7f\xff\xff\xff\xff\xff\xff\xff",
+                        std::numeric_limits<int64_t>::min());
+#else
+    checkNull("\x3b\x7f\xff\xff\xff\xff\xff\xff\xff");
+#endif
+    // below -2^63
+    checkNull("\x3b\x80\x00\x00\x00\x00\x00\x00\x00"_s);
+    checkNull("\x3b\xff\xff\xff\xff\xff\xff\xff\xff");
+  }
+
+  SECTION("half-precision floats") {
+    checkValue<float>("\xf9\x00\x00"_s, 0.0f);
+    checkValue<float>("\xf9\x80\x00"_s, -0.0f);
+    checkValue<float>("\xf9\x3c\x00"_s, 1.0f);
+    checkValue<float>("\xf9\x3e\x00"_s, 1.5f);
+    checkValue<float>("\xf9\x7b\xff", 65504.0f);
+    checkValue<float>("\xf9\x00\x01"_s, 5.960464477539063e-8f);
+    checkValue<float>("\xf9\x04\x00"_s, 0.00006103515625f);
+    checkValue<float>("\xf9\xc4\x00"_s, -4.0f);
+    checkValue<float>("\xf9\x7c\x00"_s, std::numeric_limits<float>::infinity());
+    checkValue<float>("\xf9\xfc\x00"_s,
+                      -std::numeric_limits<float>::infinity());
+
+    JsonDocument doc;
+    deserializeCbor(doc, "\xf9\x7e\x00"_s);
+    REQUIRE(doc.as<float>() != doc.as<float>());  // NaN
+  }
+
+  SECTION("single-precision floats") {
+    checkValue<float>("\xfa\x47\xc3\x50\x00"_s, 100000.0f);
+    checkValue<float>("\xfa\x7f\x7f\xff\xff", 3.4028234663852886e+38f);
+  }
+
+  SECTION("double-precision floats") {
+    checkValue<double>("\xfb\x3f\xf1\x99\x99\x99\x99\x99\x9a", 1.1);
+    checkValue<double>("\xfb\xc0\x10\x66\x66\x66\x66\x66\x66", -4.1);
+  }
+
+  SECTION("text strings") {
+    checkValue<std::string>("\x60", "");
+    checkValue<std::string>("\x61" "a", "a");
+    checkValue<std::string>("\x64" "IETF", "IETF");
+    checkValue<std::string>("\x62\x22\x5c", "\"\\");
+    checkValue<std::string>("\x62\xc3\xbc", "\xc3\xbc");
+    checkValue<std::string>("\x78\x20" + std::string(32, 'x'),
+                            std::string(32, 'x'));
+    checkValue<std::string>("\x79\x01\x00"_s + std::string(256, 'x'),
+                            std::string(256, 'x'));
+  }
+
+  SECTION("indefinite-length text strings") {
+    checkValue<std::string>("\x7f\x65strea\x64ming\xff", "streaming");
+    checkValue<std::string>("\x7f\xff", "");
+    checkValue<std::string>("\x7f\x60\x61" "a\x60\xff", "a");
+  }
+
+  SECTION("byte strings") {
+    JsonDocument doc;
+    REQUIRE(deserializeCbor(doc, "\x44\x01\x02\x03\x04") ==
+            DeserializationError::Ok);
+
+    REQUIRE(doc.is<MsgPackBinary>());
+    MsgPackBinary binary = doc.as<MsgPackBinary>();
+    REQUIRE(binary.size() == 4);
+    REQUIRE(memcmp(binary.data(), "\x01\x02\x03\x04", 4) == 0);
+  }
+
+  SECTION("long byte strings") {
+    JsonDocument doc;
+    REQUIRE(deserializeCbor(doc, "\x59\x01\x00"_s + std::string(256, 'x')) ==
+            DeserializationError::Ok);
+
+    MsgPackBinary binary = doc.as<MsgPackBinary>();
+    REQUIRE(std::string(reinterpret_cast<const char*>(binary.data()),
+                        binary.size()) == std::string(256, 'x'));
+  }
+
+  SECTION("indefinite-length byte strings") {
+    JsonDocument doc;
+    REQUIRE(deserializeCbor(doc, "\x5f\x42\x01\x02\x43\x03\x04\x05\xff") ==
+            DeserializationError::Ok);
+
+    MsgPackBinary binary = doc.as<MsgPackBinary>();
+    REQUIRE(binary.size() == 5);
+    REQUIRE(memcmp(binary.data(), "\x01\x02\x03\x04\x05", 5) == 0);
+  }
+
+  SECTION("tags are ignored") {
+    checkValue<std::string>("\xc0\x74" "2013-03-21T20:04:00Z",
+                            "2013-03-21T20:04:00Z");
+    checkValue<int>("\xc1\x1a\x51\x4b\x67\xb0", 1363896240);
+    checkValue<int>("\xd8\x20\xd9\x01\x00\x05"_s, 5);  // nested tags
+  }
+}
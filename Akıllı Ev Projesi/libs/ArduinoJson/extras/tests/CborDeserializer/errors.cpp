@@ -0,0 +1,164 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <sstream>
+
+#include "Allocators.hpp"
+#include "Literals.hpp"
+
+static DeserializationError deserialize(const std::string& input) {
+  JsonDocument doc;
+  return deserializeCbor(doc, input);
+}
+
+TEST_CASE("deserializeCbor() returns InvalidInput") {
+  SECTION("integer as key") {
+    REQUIRE(deserialize("\xa1\x01\x02") == DeserializationError::InvalidInput);
+  }
+
+  SECTION("unexpected break") {
+    REQUIRE(deserialize("\xff") == DeserializationError::InvalidInput);
+    REQUIRE(deserialize("\x82\x01\xff") == DeserializationError::InvalidInput);
+    REQUIRE(deserialize("\xa1\xff") == DeserializationError::InvalidInput);
+  }
+
+  SECTION("reserved additional information") {
+    REQUIRE(deserialize("\x1c") == DeserializationError::InvalidInput);
+    REQUIRE(deserialize("\x5d") == DeserializationError::InvalidInput);
+    REQUIRE(deserialize("\xfe") == DeserializationError::InvalidInput);
+  }
+
+  SECTION("indefinite-length integer") {
+    REQUIRE(deserialize("\x1f") == DeserializationError::InvalidInput);
+    REQUIRE(deserialize("\x3f") == DeserializationError::InvalidInput);
+    REQUIRE(deserialize("\xdf") == DeserializationError::InvalidInput);
+  }
+
+  SECTION("two-byte simple value below 32") {
+    REQUIRE(deserialize("\xf8\x14") == DeserializationError::InvalidInput);
+  }
+
+  SECTION("chunk of the wrong type") {
+    REQUIRE(deserialize("\x7f\x41" "a\xff") ==
+            DeserializationError::InvalidInput);
+    REQUIRE(deserialize("\x5f\x61" "a\xff") ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("nested indefinite-length chunk") {
+    REQUIRE(deserialize("\x7f\x7f\xff\xff") ==
+            DeserializationError::InvalidInput);
+  }
+}
+
+TEST_CASE("deserializeCbor() returns EmptyInput") {
+  JsonDocument doc;
+
+  SECTION("from sized buffer") {
+    REQUIRE(deserializeCbor(doc, "", 0) == DeserializationError::EmptyInput);
+  }
+
+  SECTION("from stream") {
+    std::istringstream input("");
+
+    REQUIRE(deserializeCbor(doc, input) == DeserializationError::EmptyInput);
+  }
+}
+
+static void testIncompleteInput(const std::string& input) {
+  JsonDocument doc;
+  REQUIRE(deserializeCbor(doc, input) == DeserializationError::Ok);
+
+  for (size_t len = input.size() - 1; len > 0; len--) {
+    CAPTURE(len);
+    REQUIRE(deserializeCbor(doc, input.data(), len) ==
+            DeserializationError::IncompleteInput);
+  }
+}
+
+TEST_CASE("deserializeCbor() returns IncompleteInput") {
+  SECTION("integers") {
+    testIncompleteInput("\x19\x03\xe8");
+    testIncompleteInput("\x3b\x7f\xff\xff\xff\xff\xff\xff\xff");
+  }
+
+  SECTION("floats") {
+    testIncompleteInput("\xf9\x3c\x00"_s);
+    testIncompleteInput("\xfa\x47\xc3\x50\x00"_s);
+    testIncompleteInput("\xfb\x3f\xf1\x99\x99\x99\x99\x99\x9a");
+  }
+
+  SECTION("strings") {
+    testIncompleteInput("\x65hello");
+    testIncompleteInput("\x7f\x62he\x63llo\xff");
+    testIncompleteInput("\x43\x01\x02\x03");
+    testIncompleteInput("\x5f\x41\x01\xff");
+  }
+
+  SECTION("arrays") {
+    testIncompleteInput("\x82\x01\x02");
+    testIncompleteInput("\x9f\x01\x02\xff");
+  }
+
+  SECTION("objects") {
+    testIncompleteInput("\xa1\x61" "a\x01");
+    testIncompleteInput("\xbf\x61" "a\x01\xff");
+  }
+
+  SECTION("tags") {
+    testIncompleteInput("\xd9\x01\x00\x01"_s);
+  }
+}
+
+TEST_CASE("deserializeCbor() returns NoMemory") {
+  TimebombAllocator timebomb(0);
+  JsonDocument doc(&timebomb);
+
+  SECTION("string") {
+    REQUIRE(deserializeCbor(doc, "\x65hello") ==
+            DeserializationError::NoMemory);
+  }
+
+  SECTION("indefinite-length string") {
+    REQUIRE(deserializeCbor(doc, "\x7f\x62he\x63llo\xff") ==
+            DeserializationError::NoMemory);
+  }
+
+  SECTION("indefinite-length byte string") {
+    REQUIRE(deserializeCbor(doc, "\x5f\x41\x01\xff") ==
+            DeserializationError::NoMemory);
+  }
+
+  SECTION("array") {
+    REQUIRE(deserializeCbor(doc, "\x81\x01") == DeserializationError::NoMemory);
+  }
+}
+
+TEST_CASE("deserializeCbor() and the nesting limit") {
+  JsonDocument doc;
+
+  SECTION("limit = 0") {
+    DeserializationOption::NestingLimit nesting(0);
+
+    REQUIRE(deserializeCbor(doc, "\x01", nesting) == DeserializationError::Ok);
+    REQUIRE(deserializeCbor(doc, "\x80", nesting) ==
+            DeserializationError::TooDeep);
+    REQUIRE(deserializeCbor(doc, "\xbf\xff", nesting) ==
+            DeserializationError::TooDeep);
+  }
+
+  SECTION("limit = 1") {
+    DeserializationOption::NestingLimit nesting(1);
+
+    REQUIRE(deserializeCbor(doc, "\x81\x01", nesting) ==
+            DeserializationError::Ok);
+    REQUIRE(deserializeCbor(doc, "\x9f\x80\xff", nesting) ==
+            DeserializationError::TooDeep);
+    REQUIRE(deserializeCbor(doc, "\xa1\x61" "a\xa0", nesting) ==
+            DeserializationError::TooDeep);
+  }
+}
@@ -0,0 +1,72 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include "Allocators.hpp"
+#include "Literals.hpp"
+
+using namespace ArduinoJson::detail;
+
+// {"include":[1,{"a":2,"b":"x"}],"ignore":["long string",h'0102',1.5,{"c":3}]}
+// with indefinite lengths in the ignored part
+static const std::string input =
+    "\xa2\x67include\x82\x01\xa2\x61"
+    "a\x02\x61"
+    "b\x61x\x66ignore\x9f\x7f\x64long\x67 string\xff\x5f\x42\x01\x02\xff"
+    "\xf9\x3e\x00\xbf\x61"
+    "c\x03\xff\xff"_s;
+
+TEST_CASE("deserializeCbor() filter") {
+  JsonDocument filter;
+  filter["include"][0]["a"] = true;
+
+  SECTION("Filter") {
+    JsonDocument doc;
+
+    DeserializationError error =
+        deserializeCbor(doc, input, DeserializationOption::Filter(filter));
+
+    REQUIRE(error == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"include\":[null,{\"a\":2}]}");
+  }
+
+  SECTION("CompiledFilter") {
+    JsonDocument doc;
+
+    DeserializationError error =
+        deserializeCbor(doc, input, compileFilter(filter));
+
+    REQUIRE(error == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"include\":[null,{\"a\":2}]}");
+  }
+
+  SECTION("Filter and NestingLimit") {
+    JsonDocument doc;
+
+    DeserializationError error =
+        deserializeCbor(doc, input, DeserializationOption::Filter(filter),
+                        DeserializationOption::NestingLimit(1));
+
+    REQUIRE(error == DeserializationError::TooDeep);
+  }
+
+  SECTION("skipped values don't allocate") {
+    SpyingAllocator spy;
+    JsonDocument doc(&spy);
+    JsonDocument nothing;
+    nothing["other"] = true;
+
+    DeserializationError error =
+        deserializeCbor(doc, input, DeserializationOption::Filter(nothing));
+
+    REQUIRE(error == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{}");
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofString("include")),
+                             Deallocate(sizeofString("include")),
+                         });
+  }
+}
@@ -0,0 +1,89 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <sstream>
+
+#include "CustomReader.hpp"
+#include "Literals.hpp"
+
+TEST_CASE("deserializeCbor(const std::string&)") {
+  JsonDocument doc;
+
+  SECTION("should accept a zero in input") {
+    DeserializationError err = deserializeCbor(doc, "\x82\x00\x02"_s);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc[0] == 0);
+    REQUIRE(doc[1] == 2);
+  }
+
+  SECTION("should duplicate content") {
+    std::string input("\x81\x65hello");
+
+    DeserializationError err = deserializeCbor(doc, input);
+    input[2] = 'X';  // alter the string to make sure we made a copy
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc[0] == "hello");
+  }
+}
+
+TEST_CASE("deserializeCbor(std::istream&)") {
+  JsonDocument doc;
+
+  SECTION("indefinite-length items") {
+    std::istringstream input(
+        "\xbf\x64name\x7f\x62he\x63llo\xff\x64list\x9f\x01\x02\xff\xff"_s);
+
+    REQUIRE(deserializeCbor(doc, input) == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"name\":\"hello\",\"list\":[1,2]}");
+  }
+
+  SECTION("concatenated documents") {
+    std::istringstream input(
+        "\x82\x01\x02\x9f\xff\x7f\x63"
+        "abc\xff\x18\x2a"_s);
+
+    REQUIRE(deserializeCbor(doc, input) == DeserializationError::Ok);
+    REQUIRE(doc[1] == 2);
+    REQUIRE(deserializeCbor(doc, input) == DeserializationError::Ok);
+    REQUIRE(doc.is<JsonArray>());
+    REQUIRE(deserializeCbor(doc, input) == DeserializationError::Ok);
+    REQUIRE(doc == "abc");
+    REQUIRE(deserializeCbor(doc, input) == DeserializationError::Ok);
+    REQUIRE(doc == 42);
+    REQUIRE(deserializeCbor(doc, input) == DeserializationError::EmptyInput);
+  }
+
+  SECTION("should detect incomplete input") {
+    std::istringstream input("\x9f\x01\x02");
+
+    REQUIRE(deserializeCbor(doc, input) ==
+            DeserializationError::IncompleteInput);
+  }
+}
+
+TEST_CASE("deserializeCbor(CustomReader)") {
+  JsonDocument doc;
+  CustomReader reader("\x82\x65Hello\x65world");
+  DeserializationError err = deserializeCbor(doc, reader);
+
+  REQUIRE(err == DeserializationError::Ok);
+  REQUIRE(doc.size() == 2);
+  REQUIRE(doc[0] == "Hello");
+  REQUIRE(doc[1] == "world");
+}
+
+TEST_CASE("deserializeCbor(JsonVariant)") {
+  JsonDocument doc;
+  JsonVariant variant = doc["value"].to<JsonVariant>();
+
+  DeserializationError err = deserializeCbor(variant, "\x82\x01\x02");
+
+  REQUIRE(err == DeserializationError::Ok);
+  REQUIRE(doc.as<std::string>() == "{\"value\":[1,2]}");
+}
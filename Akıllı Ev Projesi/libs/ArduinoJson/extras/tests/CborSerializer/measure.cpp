@@ -0,0 +1,14 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+TEST_CASE("measureCbor()") {
+  JsonDocument doc;
+  JsonObject object = doc.to<JsonObject>();
+  object["hello"] = "world";
+
+  REQUIRE(measureCbor(doc) == 13);
+}
@@ -0,0 +1,61 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include "Literals.hpp"
+
+TEST_CASE("CBOR round trip") {
+  JsonDocument doc;
+  deserializeJson(doc,
+                  "{\"name\":\"sensor\",\"values\":[1,-2,3.5,1e300,"
+                  "4294967296,-4294967297],\"on\":true,\"off\":false,"
+                  "\"nothing\":null,\"nested\":{\"a\":[[]],\"b\":{}}}");
+  doc["binary"] = MsgPackBinary("\x00\xff", 2);
+
+  std::string cbor;
+  serializeCbor(doc, cbor);
+  REQUIRE(cbor.size() == measureCbor(doc));
+
+  SECTION("deserializeCbor() gives the same document") {
+    JsonDocument copy;
+    REQUIRE(deserializeCbor(copy, cbor) == DeserializationError::Ok);
+    REQUIRE(copy == doc);
+  }
+
+  SECTION("serializeCbor() gives the same output") {
+    JsonDocument copy;
+    deserializeCbor(copy, cbor);
+    std::string output;
+    serializeCbor(copy, output);
+    REQUIRE(output == cbor);
+  }
+
+  SECTION("the byte strings can be written as MessagePack") {
+    JsonDocument copy;
+    deserializeCbor(copy, cbor);
+    std::string msgpack;
+    serializeMsgPack(copy["binary"], msgpack);
+    REQUIRE(msgpack == "\xc4\x02\x00\xff"_s);
+  }
+}
+
+TEST_CASE("CBOR round trip of raw strings") {
+  JsonDocument doc;
+  doc["binary"] = MsgPackBinary("\x01\x02", 2);
+  doc["json"] = serialized("[1,2]");
+  doc["extension"] = MsgPackExtension(1, "\x03", 1);
+
+  std::string cbor;
+  serializeCbor(doc, cbor);
+  REQUIRE(cbor.size() == measureCbor(doc));
+
+  JsonDocument copy;
+  REQUIRE(deserializeCbor(copy, cbor) == DeserializationError::Ok);
+  REQUIRE(copy.size() == 3);
+  REQUIRE(copy["binary"].as<MsgPackBinary>().size() == 2);
+  REQUIRE(copy["json"].isNull());
+  REQUIRE(copy["extension"].isNull());
+}
@@ -0,0 +1,54 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include "Literals.hpp"
+
+static void check(const JsonArray array, const std::string& expected) {
+  std::string actual;
+  size_t len = serializeCbor(array, actual);
+  REQUIRE(len == expected.size());
+  REQUIRE(actual == expected);
+}
+
+TEST_CASE("serialize CBOR array") {
+  JsonDocument doc;
+  JsonArray array = doc.to<JsonArray>();
+
+  SECTION("empty") {
+    check(array, "\x80");
+  }
+
+  SECTION("nested") {
+    array.add(1);
+    JsonArray nested = array.add<JsonArray>();
+    nested.add(2);
+    nested.add(3);
+
+    check(array, "\x82\x01\x82\x02\x03");
+  }
+
+  SECTION("23 elements") {
+    for (int i = 0; i < 23; i++)
+      array.add(true);
+
+    check(array, "\x97" + std::string(23, '\xf5'));
+  }
+
+  SECTION("24 elements") {
+    for (int i = 0; i < 24; i++)
+      array.add(true);
+
+    check(array, "\x98\x18" + std::string(24, '\xf5'));
+  }
+
+  SECTION("256 elements") {
+    for (int i = 0; i < 256; i++)
+      array.add(nullptr);
+
+    check(array, "\x99\x01\x00"_s + std::string(256, '\xf6'));
+  }
+}
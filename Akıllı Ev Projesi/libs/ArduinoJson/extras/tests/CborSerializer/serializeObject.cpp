@@ -0,0 +1,64 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include "Literals.hpp"
+
+static void check(const JsonObject object, const std::string& expected) {
+  std::string actual;
+  size_t len = serializeCbor(object, actual);
+  REQUIRE(len == expected.size());
+  REQUIRE(actual == expected);
+}
+
+TEST_CASE("serialize CBOR object") {
+  JsonDocument doc;
+  JsonObject object = doc.to<JsonObject>();
+
+  SECTION("empty") {
+    check(object, "\xa0");
+  }
+
+  SECTION("members") {
+    object["a"] = 1;
+    object["b"][0] = 2;
+    object["b"][1] = 3;
+
+    check(object, "\xa2\x61" "a\x01\x61" "b\x82\x02\x03");
+  }
+
+  SECTION("24 members") {
+    std::string expected = "\xb8\x18";
+    for (char c = 'A'; c < 'A' + 24; c++) {
+      object[std::string(1, c)] = nullptr;
+      expected += "\x61";
+      expected += c;
+      expected += "\xf6";
+    }
+
+    check(object, expected);
+  }
+}
+
+TEST_CASE("serializeCbor() destinations") {
+  JsonDocument doc;
+  doc["hello"] = "world";
+
+  SECTION("char array") {
+    char buffer[32];
+    size_t n = serializeCbor(doc, buffer, sizeof(buffer));
+
+    REQUIRE(n == 13);
+    REQUIRE(std::string(buffer, n) == "\xa1\x65hello\x65world");
+  }
+
+  SECTION("buffer too small") {
+    char buffer[8];
+    size_t n = serializeCbor(doc, buffer, sizeof(buffer));
+
+    REQUIRE(n == 8);
+  }
+}
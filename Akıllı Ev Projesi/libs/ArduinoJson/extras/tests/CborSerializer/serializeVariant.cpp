@@ -0,0 +1,104 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include "Literals.hpp"
+
+template <typename T>
+static void checkVariant(T value, const std::string& expected) {
+  JsonDocument doc;
+  JsonVariant variant = doc.to<JsonVariant>();
+  variant.set(value);
+  std::string actual;
+  size_t len = serializeCbor(variant, actual);
+  CAPTURE(variant);
+  REQUIRE(len == expected.size());
+  REQUIRE(actual == expected);
+}
+
+// The examples come from RFC 8949, appendix A
+TEST_CASE("serialize CBOR value") {
+  SECTION("unbound") {
+    checkVariant(JsonVariant(), "\xf6");
+  }
+
+  SECTION("null") {
+    checkVariant(static_cast<char*>(0), "\xf6");
+  }
+
+  SECTION("bool") {
+    checkVariant(false, "\xf4");
+    checkVariant(true, "\xf5");
+  }
+
+  SECTION("unsigned integers") {
+    checkVariant(0, "\x00"_s);
+    checkVariant(23, "\x17");
+    checkVariant(24, "\x18\x18");
+    checkVariant(100, "\x18\x64");
+    checkVariant(1000, "\x19\x03\xe8");
+    checkVariant(1000000, "\x1a\x00\x0f\x42\x40"_s);
+    checkVariant(0xFFFFFFFFU, "\x1a\xff\xff\xff\xff");
+  }
+
+  SECTION("negative integers") {
+    checkVariant(-1, "\x20");
+    checkVariant(-10, "\x29");
+    checkVariant(-24, "\x37");
+    checkVariant(-25, "\x38\x18");
+    checkVariant(-100, "\x38\x63");
+    checkVariant(-1000, "\x39\x03\xe7");
+    checkVariant(-2147483647 - 1, "\x3a\x7f\xff\xff\xff");
+  }
+
+#if ARDUINOJSON_USE_LONG_LONG
+  SECTION("64-bit integers") {
+    checkVariant(1000000000000ULL, "\x1b\x00\x00\x00\xe8\xd4\xa5\x10\x00"_s);
+    checkVariant(0xFFFFFFFFFFFFFFFFULL, "\x1b\xff\xff\xff\xff\xff\xff\xff\xff");
+    checkVariant(-9223372036854775807LL - 1,
+                 "\x3b\x7f\xff\xff\xff\xff\xff\xff\xff");
+  }
+#endif
+
+  SECTION("floats") {
+    checkVariant(1.0f, "\x01");  // integral values become integers
+    checkVariant(1.5f, "\xfa\x3f\xc0\x00\x00"_s);
+    checkVariant(100000.5f, "\xfa\x47\xc3\x50\x40");
+  }
+
+  SECTION("doubles") {
+    checkVariant(1.5, "\xfa\x3f\xc0\x00\x00"_s);  // exact as a float
+    checkVariant(1.1, "\xfb\x3f\xf1\x99\x99\x99\x99\x99\x9a");
+    checkVariant(-4.1, "\xfb\xc0\x10\x66\x66\x66\x66\x66\x66");
+  }
+
+  SECTION("text strings") {
+    checkVariant("", "\x60");
+    checkVariant("IETF", "\x64IETF");
+    checkVariant("\xc3\xbc", "\x62\xc3\xbc");
+    checkVariant(std::string(23, 'x'), "\x77" + std::string(23, 'x'));
+    checkVariant(std::string(24, 'x'), "\x78\x18" + std::string(24, 'x'));
+    checkVariant(std::string(256, 'x'),
+                 "\x79\x01\x00"_s + std::string(256, 'x'));
+    checkVariant("a\0b"_s, "\x63" "a\0b"_s);
+  }
+
+  SECTION("MsgPackBinary becomes a byte string") {
+    checkVariant(MsgPackBinary("\x01\x02\x03\x04", 4),
+                 "\x44\x01\x02\x03\x04");
+    checkVariant(MsgPackBinary(std::string(300, 'x').data(), 300),
+                 "\x59\x01\x2c" + std::string(300, 'x'));
+  }
+
+  SECTION("serialized() becomes null") {
+    checkVariant(serialized("\x83\x01\x02\x03"), "\xf6");
+    checkVariant(serialized("[1,2]"), "\xf6");
+  }
+
+  SECTION("MsgPackExtension becomes null") {
+    checkVariant(MsgPackExtension(1, "\x01\x02", 2), "\xf6");
+  }
+}
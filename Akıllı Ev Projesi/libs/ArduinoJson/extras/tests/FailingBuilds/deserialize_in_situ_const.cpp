@@ -0,0 +1,12 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+
+// deserializeJsonInSitu() writes in the input, so it requires a mutable buffer
+
+int main() {
+  JsonDocument doc;
+  deserializeJsonInSitu(doc, "{\"hello\":\"world\"}");
+}
@@ -0,0 +1,227 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+#include "Allocators.hpp"
+
+static const char* input =
+    "{\"ok\":true,\"result\":[{\"update_id\":1001,\"message\":{\"text\":"
+    "\"hello\",\"chat\":{\"id\":-42}}},{\"update_id\":1002,\"message\":{"
+    "\"text\":\"line\\nbreak\",\"chat\":{\"id\":-43}}}],\"ratio\":0.5, "
+    "\"esc\\\"aped\" : 7, unquoted: 8, \"nothing\": null}";
+
+TEST_CASE("JsonLazyDocument") {
+  JsonLazyDocument doc(input);
+
+  SECTION("same values as JsonDocument") {
+    JsonDocument expected;
+    deserializeJson(expected, input);
+
+    REQUIRE(doc["ok"].as<bool>() == expected["ok"].as<bool>());
+    REQUIRE(doc["result"][0]["update_id"].as<long>() ==
+            expected["result"][0]["update_id"].as<long>());
+    REQUIRE(doc["result"][1]["message"]["text"].as<std::string>() ==
+            expected["result"][1]["message"]["text"].as<std::string>());
+    REQUIRE(doc["result"][1]["message"]["chat"]["id"].as<int>() ==
+            expected["result"][1]["message"]["chat"]["id"].as<int>());
+    REQUIRE(doc["ratio"].as<double>() == expected["ratio"].as<double>());
+    REQUIRE(doc["result"][0].as<std::string>() ==
+            expected["result"][0].as<std::string>());
+    REQUIRE(doc.as<std::string>() == expected.as<std::string>());
+    REQUIRE(doc.size() == expected.size());
+    REQUIRE(doc["result"].size() == expected["result"].size());
+  }
+
+  SECTION("conversions") {
+    REQUIRE(doc["ok"].as<int>() == 1);
+    REQUIRE(doc["ratio"].as<bool>() == true);
+    REQUIRE(doc["ratio"].as<int>() == 0);
+    REQUIRE(doc["result"].as<bool>() == true);
+    REQUIRE(doc["result"].as<int>() == 0);
+    REQUIRE(doc["nothing"].as<bool>() == false);
+    REQUIRE(doc["nothing"].as<std::string>() == "null");
+    REQUIRE(doc["result"][0]["message"]["text"].as<std::string>() == "hello");
+
+    int id = doc["result"][0]["message"]["chat"]["id"];
+    REQUIRE(id == -42);
+  }
+
+  SECTION("is<T>()") {
+    REQUIRE(doc.is<JsonObjectConst>());
+    REQUIRE(doc["result"].is<JsonArrayConst>());
+    REQUIRE(doc["ok"].is<bool>());
+    REQUIRE(doc["result"][0]["update_id"].is<int>());
+    REQUIRE(doc["result"][0]["update_id"].is<unsigned char>() == false);
+    REQUIRE(doc["ratio"].is<double>());
+    REQUIRE(doc["ratio"].is<int>() == false);
+    REQUIRE(doc["result"][1]["message"]["text"].is<std::string>());
+    REQUIRE(doc["result"][1]["message"]["text"].is<JsonString>());
+    REQUIRE(doc["nothing"].isNull());
+    REQUIRE(doc["missing"].isNull());
+  }
+
+  SECTION("keys with escape sequences") {
+    REQUIRE(doc["esc\"aped"].as<int>() == 7);
+  }
+
+  SECTION("unquoted keys") {
+    REQUIRE(doc["unquoted"].as<int>() == 8);
+  }
+
+  SECTION("variable keys") {
+    std::string key = "ratio";
+    REQUIRE(doc[key].as<double>() == 0.5);
+
+    char buffer[] = "ok";
+    REQUIRE(doc[buffer].as<bool>() == true);
+  }
+
+  SECTION("out of range") {
+    REQUIRE(doc["result"][2].isNull());
+    REQUIRE(doc["result"][2]["message"].isNull());
+    REQUIRE(doc[0].isNull());
+    REQUIRE(doc["ok"]["key"].isNull());
+    REQUIRE(doc["ok"].size() == 0);
+  }
+
+  SECTION("repeated access") {
+    for (int i = 0; i < 3; i++) {
+      REQUIRE(doc["result"][1]["update_id"].as<int>() == 1002);
+      REQUIRE(doc["result"][0]["update_id"].as<int>() == 1001);
+      REQUIRE(doc["ratio"].as<double>() == 0.5);
+    }
+  }
+}
+
+TEST_CASE("JsonLazyDocument arrays") {
+  std::string json = "[";
+  for (int i = 0; i < 100; i++) {
+    if (i)
+      json += ", ";
+    json += std::to_string(i * 10);
+  }
+  json += "]";
+  JsonLazyDocument doc(json.data(), json.size());
+
+  SECTION("forward iteration") {
+    for (int i = 0; i < 100; i++)
+      REQUIRE(doc[i].as<int>() == i * 10);
+    REQUIRE(doc[100].isNull());
+  }
+
+  SECTION("backward iteration") {
+    for (int i = 99; i >= 0; i--)
+      REQUIRE(doc[i].as<int>() == i * 10);
+  }
+
+  SECTION("size") {
+    REQUIRE(doc.size() == 100);
+    REQUIRE(doc.size() == 100);
+  }
+}
+
+TEST_CASE("JsonLazyDocument edge cases") {
+  SECTION("empty input") {
+    JsonLazyDocument doc("");
+
+    REQUIRE(doc.isNull());
+    REQUIRE(doc.size() == 0);
+    REQUIRE(doc["key"].isNull());
+    REQUIRE(doc[0].isNull());
+  }
+
+  SECTION("null input") {
+    JsonLazyDocument doc(nullptr);
+
+    REQUIRE(doc.isNull());
+    REQUIRE(doc["key"].isNull());
+  }
+
+  SECTION("empty containers") {
+    JsonLazyDocument doc(" { \"a\" : [ ] , \"b\" : { } } ");
+
+    REQUIRE(doc.size() == 2);
+    REQUIRE(doc["a"].size() == 0);
+    REQUIRE(doc["a"][0].isNull());
+    REQUIRE(doc["b"].size() == 0);
+    REQUIRE(doc["b"]["c"].isNull());
+  }
+
+  SECTION("scalar root") {
+    JsonLazyDocument doc("  42  ");
+
+    REQUIRE(doc.as<int>() == 42);
+    REQUIRE(doc.is<int>());
+    REQUIRE(doc.size() == 0);
+  }
+
+  SECTION("sized input") {
+    JsonLazyDocument doc("[1,2,3]garbage", 7);
+
+    REQUIRE(doc.size() == 3);
+    REQUIRE(doc[2].as<int>() == 3);
+  }
+
+  SECTION("truncated input") {
+    JsonLazyDocument doc("{\"a\":1,\"b\":[1,2");
+
+    REQUIRE(doc["a"].as<int>() == 1);
+    REQUIRE(doc["b"][1].as<int>() == 2);
+    REQUIRE(doc["b"][2].isNull());
+    REQUIRE(doc["b"].size() == 0);
+    REQUIRE(doc.size() == 0);
+  }
+
+  SECTION("duplicate keys return the first value") {
+    JsonLazyDocument doc("{\"a\":1,\"b\":{\"a\":3},\"a\":2,\"c\":4}");
+
+    REQUIRE(doc["a"].as<int>() == 1);
+    REQUIRE(doc["a"].as<int>() == 1);  // from the cache
+    REQUIRE(doc["b"]["a"].as<int>() == 3);
+    REQUIRE(doc["c"].as<int>() == 4);
+  }
+
+  SECTION("a key found before a truncated value") {
+    JsonLazyDocument doc("{\"a\":1,\"a\":2,\"b\":[");
+
+    REQUIRE(doc["a"].as<int>() == 1);
+  }
+
+  SECTION("strings with escape sequences") {
+    JsonLazyDocument doc("[\"\\u00e9t\\u00e9\", \"42\"]");
+
+    REQUIRE(doc[0].as<std::string>() == "\xc3\xa9t\xc3\xa9");
+    REQUIRE(doc[1].as<int>() == 42);
+  }
+}
+
+TEST_CASE("JsonLazyDocument memory") {
+  SpyingAllocator spy;
+  JsonLazyDocument doc(input, &spy);
+
+  SECTION("reads numbers and booleans without allocating") {
+    auto result = doc["result"];
+    spy.clearLog();
+
+    REQUIRE(result[1]["message"]["chat"]["id"].as<int>() == -43);
+    REQUIRE(result[0]["update_id"].as<int>() == 1001);
+    REQUIRE(result.size() == 2);
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("keys with escape sequences go through a temporary buffer") {
+    // the lookup scans the whole object, including the escaped key
+    REQUIRE(doc["ok"].as<bool>() == true);
+    REQUIRE(spy.allocatedBytes() == 0);  // everything was released
+  }
+
+  SECTION("strings go through a temporary document") {
+    REQUIRE(doc["result"][0]["message"]["text"].as<std::string>() == "hello");
+    REQUIRE(spy.allocatedBytes() == 0);  // everything was released
+  }
+}
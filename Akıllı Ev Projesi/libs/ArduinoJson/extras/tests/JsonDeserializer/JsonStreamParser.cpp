@@ -0,0 +1,210 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#define ARDUINOJSON_ENABLE_COMMENTS 1
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+#include "Allocators.hpp"
+#include "Literals.hpp"
+
+static DeserializationError parseInChunks(JsonStreamParser& parser,
+                                          const std::string& input,
+                                          size_t chunkSize) {
+  for (size_t i = 0; i < input.size(); i += chunkSize) {
+    auto err = parser.feed(input.data() + i,
+                           std::min(chunkSize, input.size() - i));
+    if (err)
+      return err;
+  }
+  return parser.finish();
+}
+
+TEST_CASE("JsonStreamParser") {
+  JsonDocument doc;
+
+  SECTION("same result as deserializeJson() for any chunk size") {
+    const char* inputs[] = {
+        "",
+        "  \t\r\n",
+        "null",
+        "true",
+        "false",
+        "42",
+        "-3.14",
+        "1e300",
+        "\"hello\"",
+        "'single quotes'",
+        "\"\\\"\\\\\\/\\b\\f\\n\\r\\t\"",
+        "\"\\u00e9\\ud83d\\ude00\"",
+        "[]",
+        "{}",
+        " [ 1 , 2.5 , \"three\" , [ true , false ] , null ] ",
+        "{\"a\":{\"b\":[1,{\"c\":\"d\"}]},\"e\":[]}",
+        "{a:1,b_c:true}",
+        "{\"a\":1,\"a\":2}",
+        "/* comment */ [1, // another\n 2]",
+        "[1,2",
+        "[1,2,",
+        "{\"a\":",
+        "\"unterminated",
+        "[1,]",
+        "{\"a\":1,}",
+        "[1 2]",
+        "{\"a\" 1}",
+        "[tru]",
+        "[\"\\x\"]",
+        "\"\\u00ZZ\"",
+        "/* unterminated",
+        "/x",
+        "[1] trailing",
+        "1 ",
+        "1.5\n",
+        "1x",
+        "-2e3 // comment",
+    };
+
+    for (auto input : inputs) {
+      JsonDocument expected;
+      auto expectedErr = deserializeJson(expected, input);
+
+      for (size_t chunkSize : {1u, 2u, 3u, 7u, 1000u}) {
+        CAPTURE(input);
+        CAPTURE(chunkSize);
+        JsonStreamParser parser(doc);
+        auto err = parseInChunks(parser, input, chunkSize);
+        REQUIRE(err == expectedErr);
+        if (!err)
+          REQUIRE(doc.as<std::string>() == expected.as<std::string>());
+      }
+    }
+  }
+
+  SECTION("feed() reports errors as soon as they are detected") {
+    JsonStreamParser parser(doc);
+
+    REQUIRE(parser.feed("[1,", 3) == DeserializationError::Ok);
+    REQUIRE(parser.feed("x", 1) == DeserializationError::InvalidInput);
+    REQUIRE(parser.feed("2]", 2) == DeserializationError::InvalidInput);
+    REQUIRE(parser.finish() == DeserializationError::InvalidInput);
+  }
+
+  SECTION("a number at the root ends with finish()") {
+    JsonStreamParser parser(doc);
+
+    REQUIRE(parser.feed("12", 2) == DeserializationError::Ok);
+    REQUIRE(parser.feed("34", 2) == DeserializationError::Ok);
+    REQUIRE(parser.finish() == DeserializationError::Ok);
+    REQUIRE(doc.as<int>() == 1234);
+  }
+
+  SECTION("stops at the null-terminator") {
+    JsonStreamParser parser(doc);
+
+    REQUIRE(parser.feed("[1,2]\0[3]", 9) == DeserializationError::Ok);
+    REQUIRE(parser.finish() == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "[1,2]");
+  }
+
+  SECTION("accepts uint8_t buffers") {
+    const uint8_t input[] = {'[', '4', '2', ']'};
+    JsonStreamParser parser(doc);
+
+    REQUIRE(parser.feed(input, sizeof(input)) == DeserializationError::Ok);
+    REQUIRE(parser.finish() == DeserializationError::Ok);
+    REQUIRE(doc[0] == 42);
+  }
+
+  SECTION("clears the document") {
+    doc["hello"] = "world";
+    JsonStreamParser parser(doc);
+
+    REQUIRE(doc.isNull());
+  }
+
+  SECTION("filter") {
+    JsonDocument filter;
+    filter["list"][0]["id"] = true;
+    filter["name"] = true;
+    std::string input =
+        "{\"name\":\"\\\"x\\\"\",\"skip\":{\"a\":[1,\"\\\"]\",{}]},"
+        "\"list\":[{\"id\":1,\"x\":2},{\"id\":3,\"y\":[4]}]}";
+
+    for (size_t chunkSize : {1u, 5u, 1000u}) {
+      CAPTURE(chunkSize);
+      JsonStreamParser parser(doc, DeserializationOption::Filter(filter));
+
+      REQUIRE(parseInChunks(parser, input, chunkSize) ==
+              DeserializationError::Ok);
+      REQUIRE(doc.as<std::string>() ==
+              "{\"name\":\"\\\"x\\\"\",\"list\":[{\"id\":1},{\"id\":3}]}");
+    }
+  }
+
+  SECTION("nesting limit") {
+    DeserializationOption::NestingLimit nesting(1);
+
+    JsonStreamParser parser1(doc, nesting);
+    REQUIRE(parseInChunks(parser1, "{\"a\":[1]}", 1) ==
+            DeserializationError::TooDeep);
+
+    JsonStreamParser parser2(doc, nesting);
+    REQUIRE(parseInChunks(parser2, "{\"a\":1}", 1) == DeserializationError::Ok);
+  }
+
+  SECTION("nesting limit applies to skipped values") {
+    JsonDocument filter;
+    filter["a"] = true;
+    JsonStreamParser parser(doc, DeserializationOption::NestingLimit(2),
+                            DeserializationOption::Filter(filter));
+
+    REQUIRE(parseInChunks(parser, "{\"b\":[[1]]}", 1) ==
+            DeserializationError::TooDeep);
+  }
+
+  SECTION("deep nesting") {
+    std::string input = std::string(100, '[') + std::string(100, ']');
+    JsonStreamParser parser(doc, DeserializationOption::NestingLimit(100));
+
+    REQUIRE(parseInChunks(parser, input, 1) == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == input);
+  }
+
+  SECTION("strings that span several chunks") {
+    std::string input = "[\"" + std::string(100, 'x') + "\",\"abc\"]";
+
+    JsonStreamParser parser(doc);
+    REQUIRE(parseInChunks(parser, input, 7) == DeserializationError::Ok);
+    REQUIRE(doc[0] == std::string(100, 'x'));
+    REQUIRE(doc[1] == "abc");
+  }
+}
+
+TEST_CASE("JsonStreamParser memory") {
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+
+  SECTION("releases its memory") {
+    {
+      JsonStreamParser parser(doc);
+      REQUIRE(parseInChunks(parser, "[[[[[\"hello\"]]]]]", 3) ==
+              DeserializationError::Ok);
+    }
+    doc.clear();
+
+    REQUIRE(spy.allocatedBytes() == 0);
+  }
+
+  SECTION("NoMemory") {
+    KillswitchAllocator killswitch;
+    JsonDocument doc2(&killswitch);
+    JsonStreamParser parser(doc2);
+
+    REQUIRE(parser.feed("[1,", 3) == DeserializationError::Ok);
+    killswitch.on();
+    REQUIRE(parser.feed("\"hello\"]", 8) == DeserializationError::NoMemory);
+  }
+}
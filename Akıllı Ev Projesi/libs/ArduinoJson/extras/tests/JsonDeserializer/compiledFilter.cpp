@@ -0,0 +1,134 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+#include "Allocators.hpp"
+
+using DeserializationOption::CompiledFilter;
+
+static std::string filterWith(const char* filterJson, const char* input) {
+  JsonDocument filter;
+  deserializeJson(filter, filterJson);
+  JsonDocument doc;
+  deserializeJson(doc, input, compileFilter(filter));
+  return doc.as<std::string>();
+}
+
+TEST_CASE("compileFilter()") {
+  SECTION("wide filter") {
+    JsonDocument filter, input, expected;
+    for (int i = 0; i < 100; i++) {
+      std::string key = "key" + std::to_string(i);
+      input[key] = i;
+      input["other" + std::to_string(i)] = i;
+      if (i % 3 == 0) {
+        filter[key] = true;
+        expected[key] = i;
+      }
+    }
+    std::string json = input.as<std::string>();
+
+    JsonDocument doc;
+    deserializeJson(doc, json, compileFilter(filter));
+
+    REQUIRE(doc == expected);
+  }
+
+  SECTION("wildcard") {
+    REQUIRE(filterWith("{\"a\":true,\"*\":{\"x\":true}}",
+                       "{\"a\":{\"y\":1},\"b\":{\"x\":2,\"y\":3},\"c\":4}") ==
+            "{\"a\":{\"y\":1},\"b\":{\"x\":2},\"c\":null}");
+  }
+
+  SECTION("recursive true") {
+    REQUIRE(filterWith("{\"a\":true}", "{\"a\":[{\"b\":[1,{}]}],\"c\":1}") ==
+            "{\"a\":[{\"b\":[1,{}]}]}");
+  }
+
+  SECTION("array of objects") {
+    REQUIRE(filterWith("[{\"id\":true}]",
+                       "[{\"id\":1,\"x\":1},{\"x\":2},{\"id\":3}]") ==
+            "[{\"id\":1},{},{\"id\":3}]");
+  }
+
+  SECTION("null and false members") {
+    REQUIRE(filterWith("{\"a\":null,\"b\":false,\"*\":true}",
+                       "{\"a\":1,\"b\":2,\"c\":3}") == "{\"a\":1,\"c\":3}");
+  }
+
+  SECTION("keys with a null character") {
+    REQUIRE(filterWith("{\"a\":false,\"a\\u0000b\":true}",
+                       "{\"a\":1,\"a\\u0000b\":2}") ==
+            "{\"a\\u0000b\":2}");
+  }
+
+  SECTION("the filter document can be destroyed") {
+    CompiledFilter compiled;
+    {
+      JsonDocument filter;
+      filter["keep"] = true;
+      compiled = compileFilter(filter);
+    }
+    JsonDocument doc;
+    deserializeJson(doc, "{\"keep\":1,\"drop\":2}", compiled);
+
+    REQUIRE(doc.as<std::string>() == "{\"keep\":1}");
+  }
+
+  SECTION("reused filter") {
+    JsonDocument filter;
+    filter["keep"] = true;
+    CompiledFilter compiled = compileFilter(filter);
+    JsonDocument doc;
+
+    for (int i = 0; i < 3; i++) {
+      deserializeJson(doc, "{\"keep\":1,\"drop\":2}", compiled);
+      REQUIRE(doc.as<std::string>() == "{\"keep\":1}");
+    }
+  }
+
+  SECTION("makes one allocation") {
+    SpyingAllocator spy;
+    JsonDocument filter;
+    filter["a"] = true;
+    filter["b"]["c"] = true;
+
+    size_t size;
+    {
+      CompiledFilter compiled = compileFilter(filter, &spy);
+      size = spy.allocatedBytes();
+
+      REQUIRE(compiled.overflowed() == false);
+      REQUIRE(spy.log() == AllocatorLog{Allocate(size)});
+    }
+
+    REQUIRE(spy.log() == AllocatorLog{Allocate(size), Deallocate(size)});
+  }
+
+  SECTION("allocation failure") {
+    JsonDocument filter;
+    filter["a"] = true;
+    CompiledFilter compiled =
+        compileFilter(filter, FailingAllocator::instance());
+    JsonDocument doc;
+
+    REQUIRE(compiled.overflowed() == true);
+    REQUIRE(deserializeJson(doc, "{\"a\":1}", compiled) ==
+            DeserializationError::Ok);
+    REQUIRE(doc.isNull());
+  }
+
+  SECTION("default-constructed filter allows nothing") {
+    CompiledFilter compiled;
+    JsonDocument doc;
+
+    REQUIRE(deserializeJson(doc, "[1,2]", compiled) ==
+            DeserializationError::Ok);
+    REQUIRE(doc.isNull());
+  }
+}
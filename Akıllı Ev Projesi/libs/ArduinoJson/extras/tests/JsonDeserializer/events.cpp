@@ -0,0 +1,164 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <sstream>
+#include <string>
+
+#include "Literals.hpp"
+
+// Writes the events in a compact form, and skips the keys that start with '_'
+class EventLogger {
+ public:
+  bool startObject() {
+    log += "{";
+    return !skipCollections;
+  }
+
+  void endObject() {
+    log += "}";
+  }
+
+  bool startArray() {
+    log += "[";
+    return !skipCollections;
+  }
+
+  void endArray() {
+    log += "]";
+  }
+
+  bool key(JsonString key) {
+    log += key.c_str();
+    log += ":";
+    return key.c_str()[0] != '_';
+  }
+
+  void value(JsonVariantConst value) {
+    log += value.as<std::string>();
+    log += ",";
+  }
+
+  std::string log;
+  bool skipCollections = false;
+};
+
+TEST_CASE("deserializeJsonEvents()") {
+  EventLogger handler;
+
+  SECTION("values") {
+    auto err = deserializeJsonEvents(
+        handler, "[null,true,false,42,-1.5,\"hello\",'world',\"\\u00e9\"]");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(handler.log == "[null,true,false,42,-1.5,hello,world,é,]");
+  }
+
+  SECTION("nested") {
+    auto err = deserializeJsonEvents(handler,
+                                     "{\"a\":{\"b\":[1,{}],\"c\":[]},d:2}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(handler.log == "{a:{b:[1,{}]c:[]}d:2,}");
+  }
+
+  SECTION("key() skips the value") {
+    auto err = deserializeJsonEvents(
+        handler, "{\"_a\":{\"b\":[1,\"]\"]},\"c\":3,\"_d\":\"x\"}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(handler.log == "{_a:c:3,_d:}");
+  }
+
+  SECTION("startArray() skips the array") {
+    handler.skipCollections = true;
+    auto err = deserializeJsonEvents(handler, "[1,[2,3],{\"a\":4}]");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(handler.log == "[");
+  }
+
+  SECTION("string containing NUL") {
+    auto err = deserializeJsonEvents(handler, "[\"a\\u0000b\"]");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(handler.log == "[a\0b,]"_s);
+  }
+
+  SECTION("input types") {
+    std::istringstream stream("[1]");
+    REQUIRE(deserializeJsonEvents(handler, stream) == DeserializationError::Ok);
+    REQUIRE(deserializeJsonEvents(handler, "[2]"_s) ==
+            DeserializationError::Ok);
+    REQUIRE(deserializeJsonEvents(handler, "[3]garbage", 3) ==
+            DeserializationError::Ok);
+    REQUIRE(handler.log == "[1,][2,][3,]");
+  }
+
+  SECTION("errors") {
+    REQUIRE(deserializeJsonEvents(handler, "") ==
+            DeserializationError::EmptyInput);
+    REQUIRE(deserializeJsonEvents(handler, "[1,") ==
+            DeserializationError::IncompleteInput);
+    REQUIRE(deserializeJsonEvents(handler, "{\"a\" 1}") ==
+            DeserializationError::InvalidInput);
+    REQUIRE(deserializeJsonEvents(handler, "{\"_a\":[1,}") ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("root number") {
+    REQUIRE(deserializeJsonEvents(handler, "1.5") == DeserializationError::Ok);
+    REQUIRE(deserializeJsonEvents(handler, "1.5x") ==
+            DeserializationError::InvalidInput);
+    REQUIRE(deserializeJsonEvents(handler, "1 ") ==
+            DeserializationError::InvalidInput);
+    REQUIRE(deserializeJsonEvents(handler, "42\n") ==
+            DeserializationError::InvalidInput);
+    REQUIRE(deserializeJsonEvents(handler, "[1.5] x") ==
+            DeserializationError::Ok);
+    REQUIRE(handler.log == "1.5,[1.5,]");
+  }
+
+  SECTION("nesting limit") {
+    DeserializationOption::NestingLimit nesting(1);
+
+    REQUIRE(deserializeJsonEvents(handler, "[1]", nesting) ==
+            DeserializationError::Ok);
+    REQUIRE(deserializeJsonEvents(handler, "[[1]]", nesting) ==
+            DeserializationError::TooDeep);
+    REQUIRE(deserializeJsonEvents(handler, "{\"_a\":[1]}", nesting) ==
+            DeserializationError::TooDeep);
+  }
+
+  SECTION("large input") {
+    std::string input = "[";
+    for (int i = 0; i < 1000; i++)
+      input += "{\"id\":" + std::to_string(i) + ",\"name\":\"sensor #" +
+               std::to_string(i) + "\",\"value\":123456789012},";
+    input += "0]";
+
+    struct CountingHandler {
+      bool startObject() {
+        return true;
+      }
+      void endObject() {}
+      bool startArray() {
+        return true;
+      }
+      void endArray() {}
+      bool key(JsonString) {
+        return true;
+      }
+      void value(JsonVariantConst) {
+        count++;
+      }
+      int count = 0;
+    } counter;
+
+    REQUIRE(deserializeJsonEvents(counter, input) == DeserializationError::Ok);
+    REQUIRE(counter.count == 3001);
+  }
+}
@@ -721,6 +721,14 @@ TEST_CASE("Filtering") {
 
       doc.shrinkToFit();
       CHECK(spy.allocatedBytes() == tc.memoryUsage);
+
+      // compileFilter() must give the same result
+      JsonDocument doc2;
+      CHECK(deserializeJson(
+                doc2, tc.input, compileFilter(filter),
+                DeserializationOption::NestingLimit(tc.nestingLimit)) ==
+            tc.error);
+      CHECK(doc2.as<std::string>() == tc.output);
     }
   }
 }
@@ -814,6 +822,27 @@ TEST_CASE("Overloads") {
     deserializeJson(doc, vla, NestingLimit(5), Filter(filter));
   }
 #endif
+
+  // deserializeJson(..., CompiledFilter)
+
+  SECTION("const char*, CompiledFilter") {
+    deserializeJson(doc, "{}", compileFilter(filter));
+  }
+
+  SECTION("const char*, size_t, CompiledFilter, NestingLimit") {
+    CompiledFilter compiled = compileFilter(filter);
+    deserializeJson(doc, "{}", 2, compiled, NestingLimit(5));
+  }
+
+  SECTION("std::istream&, NestingLimit, CompiledFilter") {
+    std::stringstream s("{}");
+    deserializeJson(doc, s, NestingLimit(5), compileFilter(filter));
+  }
+
+  SECTION("char*, CompiledFilter (in situ)") {
+    char input[] = "{}";
+    deserializeJsonInSitu(doc, input, compileFilter(filter));
+  }
 }
 
 TEST_CASE("shrink filter") {
@@ -0,0 +1,146 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#define ARDUINOJSON_DECODE_UNICODE 1
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+#include "Allocators.hpp"
+
+using ArduinoJson::detail::sizeofObject;
+
+static bool pointsInto(JsonString s, const std::string& buffer) {
+  return s.c_str() >= buffer.data() &&
+         s.c_str() < buffer.data() + buffer.size();
+}
+
+TEST_CASE("deserializeJsonInSitu()") {
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+
+  SECTION("strings point to the input buffer") {
+    std::string input = "{\"greeting\":\"hello world\",\"answer\":42}";
+
+    auto err = deserializeJsonInSitu(doc, &input[0], input.size());
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc["greeting"] == "hello world");
+    REQUIRE(doc["answer"] == 42);
+    REQUIRE(pointsInto(doc["greeting"].as<JsonString>(), input));
+    REQUIRE(pointsInto(doc.as<JsonObject>().begin()->key(), input));
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofPool()),
+                             Reallocate(sizeofPool(), sizeofObject(2)),
+                         });
+  }
+
+  SECTION("null-terminated input") {
+    char input[] = "[\"hello world\",\"goodbye world\"]";
+
+    auto err = deserializeJsonInSitu(doc, input);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc[0] == "hello world");
+    REQUIRE(doc[1] == "goodbye world");
+    REQUIRE(doc[0].as<const char*>() == input + 1);  // over the quote
+  }
+
+  SECTION("escape sequences are unescaped in place") {
+    std::string input =
+        "[\"1\\\"2\\\\3\\/4\\b5\\f6\\n7\\r8\\t9\",\"\\u00e4\\ud83d\\udda4!\"]";
+
+    auto err = deserializeJsonInSitu(doc, &input[0], input.size());
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc[0] == "1\"2\\3/4\b5\f6\n7\r8\t9");
+    REQUIRE(doc[1] == "\xc3\xa4\xf0\x9f\x96\xa4!");
+    REQUIRE(pointsInto(doc[0].as<JsonString>(), input));
+    REQUIRE(pointsInto(doc[1].as<JsonString>(), input));
+  }
+
+  SECTION("non-quoted keys") {
+    std::string input = "{first_key:'first value',second_key:2}";
+
+    auto err = deserializeJsonInSitu(doc, &input[0], input.size());
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc["first_key"] == "first value");
+    REQUIRE(doc["second_key"] == 2);
+  }
+
+  SECTION("tiny strings are stored in the variant") {
+    std::string input = "{\"a\":\"b\"}";
+
+    auto err = deserializeJsonInSitu(doc, &input[0], input.size());
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc["a"] == "b");
+    REQUIRE_FALSE(pointsInto(doc["a"].as<JsonString>(), input));
+  }
+
+  SECTION("strings containing NUL are copied") {
+    std::string input = "[\"hello\\u0000world\"]";
+
+    auto err = deserializeJsonInSitu(doc, &input[0], input.size());
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc[0] == std::string("hello\0world", 11));
+    REQUIRE_FALSE(pointsInto(doc[0].as<JsonString>(), input));
+  }
+
+  SECTION("duplicate keys") {
+    std::string input = "{\"hello\":\"world\",\"hello\":\"there\"}";
+
+    auto err = deserializeJsonInSitu(doc, &input[0], input.size());
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.size() == 1);
+    REQUIRE(doc["hello"] == "there");
+  }
+
+  SECTION("filter") {
+    std::string input = "{\"keep\":\"this value\",\"skip\":\"that value\"}";
+    JsonDocument filter;
+    filter["keep"] = true;
+
+    auto err = deserializeJsonInSitu(doc, &input[0], input.size(),
+                                     DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"keep\":\"this value\"}");
+  }
+
+  SECTION("uses less memory than deserializeJson()") {
+    std::string input =
+        "{\"sensor\":\"temperature\",\"location\":\"living room\"}";
+    SpyingAllocator copySpy;
+    JsonDocument copy(&copySpy);
+    deserializeJson(copy, input);
+
+    auto err = deserializeJsonInSitu(doc, &input[0], input.size());
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc == copy);
+    REQUIRE(spy.allocatedBytes() < copySpy.allocatedBytes());
+  }
+
+  SECTION("incomplete input") {
+    std::string input = "{\"hello\":\"wor";
+
+    auto err = deserializeJsonInSitu(doc, &input[0], input.size());
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("size limits the input") {
+    std::string input = "\"hello world\"garbage";
+
+    auto err = deserializeJsonInSitu(doc, &input[0], 13);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc == "hello world");
+  }
+}
@@ -151,6 +151,17 @@ TEST_CASE("deserializeJson(std::istream&)") {
 
     REQUIRE('1' == char(json.get()));
   }
+  SECTION("Concatenated documents") {
+    std::istringstream json("{\"a\":1}[2]\n\"three\"");
+
+    REQUIRE(deserializeJson(doc, json) == DeserializationError::Ok);
+    REQUIRE(doc["a"] == 1);
+    REQUIRE(deserializeJson(doc, json) == DeserializationError::Ok);
+    REQUIRE(doc[0] == 2);
+    REQUIRE(deserializeJson(doc, json) == DeserializationError::Ok);
+    REQUIRE(doc == "three");
+    REQUIRE(deserializeJson(doc, json) == DeserializationError::EmptyInput);
+  }
 }
 
 #ifdef HAS_VARIABLE_LENGTH_ARRAY
@@ -0,0 +1,185 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#define ARDUINOJSON_ENABLE_STD_THREAD 1
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Allocators.hpp"
+
+TEST_CASE("deserializeJsonLines()") {
+  JsonDocument doc;
+  std::vector<std::string> records;
+  auto collect = [&](JsonDocument& record) {
+    records.push_back(record.as<std::string>());
+  };
+
+  SECTION("one record per line") {
+    auto err = deserializeJsonLines(doc, "{\"a\":1}\n[2]\n\"three\"\n4.5\n",
+                                    collect);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(records == std::vector<std::string>{"{\"a\":1}", "[2]",
+                                                "three", "4.5"});
+  }
+
+  SECTION("blank lines, CRLF, and no final newline") {
+    std::string input = "\r\n  1 \r\n\n\t2\r\n \n3";
+
+    auto err = deserializeJsonLines(doc, input, collect);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(records == std::vector<std::string>{"1", "2", "3"});
+  }
+
+  SECTION("empty input") {
+    auto err = deserializeJsonLines(doc, "", collect);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(records.empty());
+  }
+
+  SECTION("stops at the first error") {
+    auto err = deserializeJsonLines(doc, "[1]\n[2\n[3]\n", collect);
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+    REQUIRE(records == std::vector<std::string>{"[1]"});
+  }
+
+  SECTION("sized input") {
+    const char* input = "1\n2\n3\n";
+
+    auto err = deserializeJsonLines(doc, input, 4, collect);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(records == std::vector<std::string>{"1", "2"});
+  }
+
+  SECTION("filter") {
+    JsonDocument filter;
+    filter["id"] = true;
+
+    auto err = deserializeJsonLines(doc, "{\"id\":1,\"x\":2}\n{\"id\":3}",
+                                    collect,
+                                    DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(records == std::vector<std::string>{"{\"id\":1}", "{\"id\":3}"});
+  }
+
+  SECTION("keeps the memory of the document between records") {
+    SpyingAllocator spy;
+    JsonDocument doc2(&spy);
+    size_t count = 0;
+
+    auto err = deserializeJsonLines(doc2, "[1,2]\n[3,4]\n[5,6]\n",
+                                    [&](JsonDocument& record) {
+                                      if (count++ == 0)
+                                        spy.clearLog();
+                                      REQUIRE(record.size() == 2);
+                                    });
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(count == 3);
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+}
+
+TEST_CASE("deserializeJsonLinesParallel()") {
+  std::string input;
+  for (int i = 0; i < 1000; i++)
+    input += "{\"id\":" + std::to_string(i) + ",\"name\":\"item" +
+             std::to_string(i) + "\"}\n";
+
+  JsonLinesOptions options;
+  options.threads = 4;
+  options.chunkSize = 100;
+
+  SECTION("ordered") {
+    options.ordered = true;
+    std::vector<int> ids;
+
+    auto err = deserializeJsonLinesParallel(
+        input, [&](JsonDocument& doc) { ids.push_back(doc["id"]); }, options);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(ids.size() == 1000);
+    for (int i = 0; i < 1000; i++)
+      REQUIRE(ids[size_t(i)] == i);
+  }
+
+  SECTION("unordered") {
+    std::mutex mutex;
+    std::vector<bool> seen(1000);
+
+    auto err = deserializeJsonLinesParallel(
+        input,
+        [&](JsonDocument& doc) {
+          std::lock_guard<std::mutex> lock(mutex);
+          int id = doc["id"];
+          seen[size_t(id)] = doc["name"] == "item" + std::to_string(id);
+        },
+        options);
+
+    REQUIRE(err == DeserializationError::Ok);
+    for (int i = 0; i < 1000; i++)
+      REQUIRE(seen[size_t(i)]);
+  }
+
+  SECTION("lines longer than the chunks") {
+    options.ordered = true;
+    options.chunkSize = 1;
+    std::vector<int> ids;
+
+    auto err = deserializeJsonLinesParallel(
+        input.c_str(), 4 * input.find('\n') + 4,  // the first four lines
+        [&](JsonDocument& doc) { ids.push_back(doc["id"]); }, options);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(ids == std::vector<int>{0, 1, 2, 3});
+  }
+
+  SECTION("ordered mode stops at the first error") {
+    options.ordered = true;
+    input.replace(input.find("{\"id\":500,"), 1, "x");
+    std::vector<int> ids;
+
+    auto err = deserializeJsonLinesParallel(
+        input, [&](JsonDocument& doc) { ids.push_back(doc["id"]); }, options);
+
+    REQUIRE(err == DeserializationError::InvalidInput);
+    REQUIRE(ids.size() == 500);
+    REQUIRE(ids.back() == 499);
+  }
+
+  SECTION("one thread") {
+    options.threads = 1;
+    options.values = 10;
+    options.stringBytes = 100;
+    int count = 0;
+
+    auto err = deserializeJsonLinesParallel(
+        input, [&](JsonDocument&) { count++; }, options);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(count == 1000);
+  }
+
+  SECTION("releases its memory") {
+    SpyingAllocator spy;
+    options.allocator = &spy;
+    options.threads = 1;  // SpyingAllocator isn't thread-safe
+    options.ordered = true;
+
+    auto err = deserializeJsonLinesParallel(
+        input, [&](JsonDocument&) {}, options);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(spy.allocatedBytes() == 0);
+  }
+}
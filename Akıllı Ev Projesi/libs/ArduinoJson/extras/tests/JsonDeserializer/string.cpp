@@ -6,6 +6,9 @@
 #include <ArduinoJson.h>
 #include <catch.hpp>
 
+#include <string>
+#include <vector>
+
 #include "Allocators.hpp"
 
 using ArduinoJson::detail::sizeofArray;
@@ -83,6 +86,70 @@ TEST_CASE("Truncated JSON string") {
   }
 }
 
+TEST_CASE("Long JSON strings") {
+  JsonDocument doc;
+  std::string expected(100, 'a');
+
+  // move the special character across the words scanned by the parser
+  for (size_t i = 0; i < expected.size(); i++) {
+    CAPTURE(i);
+
+    SECTION("escaped character") {
+      std::string input = "\"" + expected + "\"";
+      input.replace(i + 1, 1, "\\n");
+      std::string output = expected;
+      output[i] = '\n';
+
+      REQUIRE(deserializeJson(doc, input) == DeserializationError::Ok);
+      REQUIRE(doc.as<std::string>() == output);
+
+      REQUIRE(deserializeJson(doc, input.c_str()) == DeserializationError::Ok);
+      REQUIRE(doc.as<std::string>() == output);
+
+      std::vector<char> vec(input.begin(), input.end());
+      REQUIRE(deserializeJson(doc, vec) == DeserializationError::Ok);
+      REQUIRE(doc.as<std::string>() == output);
+    }
+
+    SECTION("end of string") {
+      std::string input = "[\"" + expected.substr(0, i) + "\",1]";
+
+      REQUIRE(deserializeJson(doc, input) == DeserializationError::Ok);
+      REQUIRE(doc[0] == expected.substr(0, i));
+      REQUIRE(doc[1] == 1);
+    }
+
+    SECTION("truncated input") {
+      std::string input = "\"" + expected.substr(0, i);
+
+      REQUIRE(deserializeJson(doc, input) ==
+              DeserializationError::IncompleteInput);
+      REQUIRE(deserializeJson(doc, input.c_str()) ==
+              DeserializationError::IncompleteInput);
+    }
+
+    SECTION("NUL in bounded input") {
+      std::string input = "\"" + expected + "\"";
+      input[i + 1] = '\0';
+
+      REQUIRE(deserializeJson(doc, input) ==
+              DeserializationError::IncompleteInput);
+    }
+
+    SECTION("filtered out") {
+      std::string input = "{\"a\":\"" + expected + "\",\"b\":2}";
+      input.replace(i + 7, 1, "\\\"");
+      JsonDocument filter;
+      filter["b"] = true;
+
+      REQUIRE(deserializeJson(doc, input,
+                              DeserializationOption::Filter(filter)) ==
+              DeserializationError::Ok);
+      REQUIRE(doc.as<std::string>() == "{\"b\":2}");
+    }
+  }
+}
+
 TEST_CASE("Escape single quote in single quoted string") {
   JsonDocument doc;
 
@@ -0,0 +1,157 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+#include "Allocators.hpp"
+#include "Literals.hpp"
+
+using ArduinoJson::detail::addPadding;
+
+TEST_CASE("JsonDocument::reserve()") {
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+
+  SECTION("allocates the pools") {
+    REQUIRE(doc.reserve(ARDUINOJSON_POOL_CAPACITY * 3) == true);
+
+    REQUIRE(spy.log() ==
+            AllocatorLog{
+                Allocate(sizeofPool()) * 2,
+                Allocate(sizeofPool(ARDUINOJSON_POOL_CAPACITY * 2)),
+            });
+
+    spy.clearLog();
+    for (int i = 0; i < ARDUINOJSON_POOL_CAPACITY * 3; i++)
+      doc.add(i);
+
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("allocates the strings") {
+    REQUIRE(doc.reserve(10, 200) == true);
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofPool()),
+                             Allocate(200),
+                         });
+
+    spy.clearLog();
+    doc["hello"_s] = "world"_s;
+    doc["a long key"_s] = "a long value"_s;
+
+    REQUIRE(doc.as<std::string>() ==
+            "{\"hello\":\"world\",\"a long key\":\"a long value\"}");
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("strings go to the allocator when the arena is full") {
+    // room for one string only
+    REQUIRE(doc.reserve(10, addPadding(sizeofString("hello"))) == true);
+    spy.clearLog();
+
+    doc["hello"_s] = "world"_s;
+
+    REQUIRE(doc.as<std::string>() == "{\"hello\":\"world\"}");
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofString("world")),
+                         });
+  }
+
+  SECTION("returns false when allocation fails") {
+    KillswitchAllocator killswitch;
+    JsonDocument doc2(&killswitch);
+    killswitch.on();
+
+    REQUIRE(doc2.reserve(10) == false);
+  }
+
+  SECTION("releases everything in the destructor") {
+    {
+      JsonDocument doc2(&spy);
+      doc2.reserve(ARDUINOJSON_POOL_CAPACITY * 3, 100);
+      doc2["hello"_s] = "world"_s;
+    }
+
+    REQUIRE(spy.allocatedBytes() == 0);
+  }
+
+  SECTION("shrinkToFit() releases the unused capacity") {
+    doc.reserve(ARDUINOJSON_POOL_CAPACITY * 3, 100);
+    doc.add(1);
+    spy.clearLog();
+
+    doc.shrinkToFit();
+
+    REQUIRE(spy.log() ==
+            AllocatorLog{
+                Deallocate(sizeofPool()),
+                Deallocate(sizeofPool(ARDUINOJSON_POOL_CAPACITY * 2)),
+                Reallocate(sizeofPool(), sizeofPool(1)),
+                Deallocate(100),
+            });
+  }
+}
+
+TEST_CASE("JsonDocument::clear(true)") {
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+
+  SECTION("keeps the pools") {
+    for (int i = 0; i < ARDUINOJSON_POOL_CAPACITY * 3; i++)
+      doc.add(i);
+    spy.clearLog();
+
+    doc.clear(true);
+
+    REQUIRE(doc.isNull());
+    REQUIRE(spy.log() == AllocatorLog{});
+
+    for (int i = 0; i < ARDUINOJSON_POOL_CAPACITY * 3; i++)
+      doc.add(i);
+
+    REQUIRE(spy.log() == AllocatorLog{});
+    REQUIRE(doc.size() == ARDUINOJSON_POOL_CAPACITY * 3);
+  }
+
+  SECTION("releases the strings that are not in the arena") {
+    doc["hello"_s] = "world"_s;
+    spy.clearLog();
+
+    doc.clear(true);
+
+    REQUIRE(spy.log() == AllocatorLog{
+                             Deallocate(sizeofString("hello")),
+                             Deallocate(sizeofString("world")),
+                         });
+  }
+
+  SECTION("deserializeJson() doesn't call the allocator after warm up") {
+    std::string input =
+        "{\"name\":\"a string long enough to need more than one resize\","
+        "\"list\":[1,2,3,{\"key\":\"value\"}],\"pi\":3.14}";
+    doc.reserve(0, 256);
+
+    for (int i = 0; i < 3; i++) {
+      if (i == 1)
+        spy.clearLog();
+      REQUIRE(deserializeJson(doc, input) == DeserializationError::Ok);
+      REQUIRE(doc.as<std::string>() == input);
+    }
+
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("clear() releases everything") {
+    doc.reserve(ARDUINOJSON_POOL_CAPACITY * 3, 100);
+    doc["hello"_s] = "world"_s;
+    doc.clear(true);
+
+    doc.clear();
+
+    REQUIRE(spy.allocatedBytes() == 0);
+  }
+}
@@ -0,0 +1,111 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <sstream>
+#include <string>
+
+// Records the writes, to check that the lines are sent in batches
+class RecordingWriter {
+ public:
+  size_t write(uint8_t c) {
+    writes_++;
+    str_.append(1, static_cast<char>(c));
+    return 1;
+  }
+
+  size_t write(const uint8_t* s, size_t n) {
+    writes_++;
+    str_.append(reinterpret_cast<const char*>(s), n);
+    return n;
+  }
+
+  const std::string& str() const {
+    return str_;
+  }
+
+  int writes() const {
+    return writes_;
+  }
+
+ private:
+  std::string str_;
+  int writes_ = 0;
+};
+
+TEST_CASE("JsonLinesWriter") {
+  JsonDocument doc;
+
+  SECTION("writes one value per line") {
+    std::string output;
+    {
+      JsonLinesWriter<std::string> writer(output);
+      doc["a"] = 1;
+      REQUIRE(writer.write(doc) == 8);
+      REQUIRE(writer.write(JsonVariantConst()) == 5);
+      JsonDocument array;
+      array.add(1);
+      array.add(2);
+      REQUIRE(writer.write(array) == 6);
+    }
+
+    REQUIRE(output == "{\"a\":1}\nnull\n[1,2]\n");
+  }
+
+  SECTION("sends the lines in batches") {
+    RecordingWriter destination;
+    JsonLinesWriter<RecordingWriter, 64> writer(destination);
+    doc["id"] = 12345;
+
+    for (int i = 0; i < 10; i++)
+      writer.write(doc);
+    REQUIRE(writer.flush());
+
+    REQUIRE(destination.str().size() == 130);
+    REQUIRE(destination.writes() == 3);
+  }
+
+  SECTION("writes lines longer than the buffer directly") {
+    RecordingWriter destination;
+    JsonLinesWriter<RecordingWriter, 8> writer(destination);
+    doc["hello"] = "world";
+
+    writer.write(doc);
+    writer.flush();
+
+    REQUIRE(destination.str() == "{\"hello\":\"world\"}\n");
+  }
+
+  SECTION("std::ostream") {
+    std::ostringstream os;
+    JsonLinesWriter<std::ostream> writer(os);
+
+    writer.write(doc);
+    writer.write(doc);
+    writer.flush();
+
+    REQUIRE(os.str() == "null\nnull\n");
+  }
+
+  SECTION("round-trip with deserializeJsonLines()") {
+    std::string output;
+    {
+      JsonLinesWriter<std::string> writer(output);
+      for (int i = 0; i < 3; i++) {
+        doc["i"] = i;
+        writer.write(doc);
+      }
+    }
+
+    int count = 0;
+    auto err = deserializeJsonLines(doc, output, [&](JsonDocument& record) {
+      REQUIRE(record["i"] == count);
+      count++;
+    });
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(count == 3);
+  }
+}
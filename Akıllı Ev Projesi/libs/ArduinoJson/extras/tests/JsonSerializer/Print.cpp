@@ -0,0 +1,87 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <Arduino.h>
+
+#define ARDUINOJSON_ENABLE_ARDUINO_PRINT 1
+#define ARDUINOJSON_WRITER_BUFFER_SIZE 8
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+#include <string>
+
+class PrintSpy : public Print {
+ public:
+  PrintSpy(size_t capacity = 1000) : capacity_(capacity) {}
+
+  size_t write(uint8_t c) {
+    return write(&c, 1);
+  }
+
+  size_t write(const uint8_t* s, size_t n) {
+    calls++;
+    if (n > capacity_ - str.size())
+      n = capacity_ - str.size();
+    str.append(reinterpret_cast<const char*>(s), n);
+    return n;
+  }
+
+  std::string str;
+  int calls = 0;
+
+ private:
+  size_t capacity_;
+};
+
+TEST_CASE("serializeJson(Print&)") {
+  JsonDocument doc;
+  doc["hello"] = "world";
+  doc["values"].add(1);
+  doc["values"].add(2);
+  const std::string expected = "{\"hello\":\"world\",\"values\":[1,2]}";
+
+  SECTION("writes in blocks of ARDUINOJSON_WRITER_BUFFER_SIZE") {
+    PrintSpy print;
+    size_t n = serializeJson(doc, print);
+
+    REQUIRE(print.str == expected);
+    REQUIRE(n == expected.size());
+    REQUIRE(print.calls == 4);  // 32 bytes = 4 blocks of 8
+  }
+
+  SECTION("writes long strings directly") {
+    doc.clear();
+    doc.set("0123456789ABCDEF");
+    PrintSpy print;
+    size_t n = serializeJson(doc, print);
+
+    REQUIRE(print.str == "\"0123456789ABCDEF\"");
+    REQUIRE(n == 18);
+    REQUIRE(print.calls == 3);
+  }
+
+  SECTION("returns the number of bytes actually written") {
+    PrintSpy print(20);
+    size_t n = serializeJson(doc, print);
+
+    REQUIRE(print.str == expected.substr(0, 20));
+    REQUIRE(n == 20);
+  }
+
+  SECTION("serializeJsonPretty()") {
+    PrintSpy print(20);
+    size_t n = serializeJsonPretty(doc, print);
+
+    REQUIRE(print.str.size() == 20);
+    REQUIRE(n == 20);
+  }
+
+  SECTION("serializeMsgPack()") {
+    PrintSpy print(10);
+    size_t n = serializeMsgPack(doc, print);
+
+    REQUIRE(print.str == "\x82\xA5hello\xA5wo");
+    REQUIRE(n == 10);
+  }
+}
@@ -0,0 +1,159 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+#include "Allocators.hpp"
+
+template <typename TCursor>
+static std::string readInChunks(JsonVariantConst source, size_t chunkSize) {
+  TCursor cursor(source);
+  std::string result;
+  char buffer[1000];
+  while (size_t n = cursor.read(buffer, chunkSize)) {
+    REQUIRE(n <= chunkSize);
+    result.append(buffer, n);
+  }
+  REQUIRE(cursor.done());
+  REQUIRE(cursor.read(buffer, chunkSize) == 0);
+  return result;
+}
+
+TEST_CASE("JsonSerializationCursor") {
+  JsonDocument doc;
+
+  SECTION("same output as serializeJson() for any chunk size") {
+    const char* inputs[] = {
+        "null",
+        "true",
+        "42",
+        "-3.14",
+        "\"hello\"",
+        "\"\\\"\\\\\\b\\f\\n\\r\\t\"",
+        "[]",
+        "{}",
+        "[[]]",
+        "[{}]",
+        "[1,2.5,\"three\",[true,false],null]",
+        "{\"a\":{\"b\":[1,{\"c\":\"d\"}]},\"e\":[],\"f\":{}}",
+    };
+
+    for (auto input : inputs) {
+      REQUIRE(deserializeJson(doc, input) == DeserializationError::Ok);
+      std::string expected, expectedPretty;
+      serializeJson(doc, expected);
+      serializeJsonPretty(doc, expectedPretty);
+
+      for (size_t chunkSize : {1u, 2u, 3u, 7u, 1000u}) {
+        CAPTURE(input);
+        CAPTURE(chunkSize);
+        REQUIRE(readInChunks<JsonSerializationCursor>(doc, chunkSize) ==
+                expected);
+        REQUIRE(readInChunks<PrettyJsonSerializationCursor>(doc, chunkSize) ==
+                expectedPretty);
+      }
+    }
+  }
+
+  SECTION("unbound variant") {
+    REQUIRE(readInChunks<JsonSerializationCursor>(JsonVariantConst(), 3) ==
+            "null");
+  }
+
+  SECTION("strings that span several chunks") {
+    doc[0] = std::string(100, 'x');
+    doc[1] = "abc";
+
+    REQUIRE(readInChunks<JsonSerializationCursor>(doc, 7) ==
+            "[\"" + std::string(100, 'x') + "\",\"abc\"]");
+  }
+
+  SECTION("escape sequences at the boundaries of the string parts") {
+    std::string s(200, 'x');
+    s[63] = '"';
+    s[64] = '\n';
+    s[127] = '\\';
+    doc["key"] = s;
+    std::string expected;
+    serializeJson(doc, expected);
+
+    for (size_t chunkSize : {1u, 5u, 64u, 1000u}) {
+      CAPTURE(chunkSize);
+      REQUIRE(readInChunks<JsonSerializationCursor>(doc, chunkSize) ==
+              expected);
+    }
+  }
+
+  SECTION("raw strings that span several chunks") {
+    doc[0] = serialized(std::string(150, '1'));
+    doc[1] = serialized("");
+
+    REQUIRE(readInChunks<JsonSerializationCursor>(doc, 7) ==
+            "[" + std::string(150, '1') + ",]");
+  }
+
+  SECTION("linked strings") {
+    doc["a"] = "hello";
+
+    REQUIRE(readInChunks<JsonSerializationCursor>(doc, 2) ==
+            "{\"a\":\"hello\"}");
+  }
+
+  SECTION("deep nesting") {
+    std::string input = std::string(100, '[') + std::string(100, ']');
+    REQUIRE(deserializeJson(doc, input,
+                            DeserializationOption::NestingLimit(100)) ==
+            DeserializationError::Ok);
+
+    REQUIRE(readInChunks<JsonSerializationCursor>(doc, 5) == input);
+  }
+
+  SECTION("a zero-sized chunk doesn't move the cursor") {
+    doc.add(1);
+    JsonSerializationCursor cursor(doc);
+    char buffer[8];
+
+    REQUIRE(cursor.read(buffer, 0) == 0);
+    REQUIRE(cursor.done() == false);
+    REQUIRE(cursor.read(buffer, sizeof(buffer)) == 3);
+    REQUIRE(std::string(buffer, 3) == "[1]");
+    REQUIRE(cursor.done() == true);
+  }
+}
+
+TEST_CASE("JsonSerializationCursor memory") {
+  SECTION("releases its stack") {
+    SpyingAllocator spy;
+    JsonDocument doc(&spy);
+    deserializeJson(doc, "[[[[[1]]]]]");
+    size_t before = spy.allocatedBytes();
+
+    {
+      JsonSerializationCursor cursor(doc);
+      char buffer[2];
+      while (cursor.read(buffer, sizeof(buffer))) {
+      }
+      REQUIRE(cursor.failed() == false);
+    }
+
+    REQUIRE(spy.allocatedBytes() == before);
+  }
+
+  SECTION("failed() when the stack can't be allocated") {
+    KillswitchAllocator killswitch;
+    JsonDocument doc(&killswitch);
+    doc[0][0] = 1;
+    killswitch.on();
+
+    JsonSerializationCursor cursor(doc);
+    char buffer[16];
+    REQUIRE(cursor.read(buffer, sizeof(buffer)) == 1);
+    REQUIRE(cursor.done() == false);
+    REQUIRE(cursor.failed() == true);
+    REQUIRE(cursor.read(buffer, sizeof(buffer)) == 0);
+  }
+}
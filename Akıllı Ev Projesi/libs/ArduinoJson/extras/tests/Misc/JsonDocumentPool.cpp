@@ -0,0 +1,180 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#define ARDUINOJSON_ENABLE_DOCUMENT_POOL 1
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Allocators.hpp"
+
+TEST_CASE("JsonDocumentPool") {
+  SpyingAllocator spy;
+
+  SECTION("recycles the documents") {
+    JsonDocumentPool pool(JsonDocumentPool::Options(), &spy);
+
+    JsonDocument* first;
+    {
+      auto doc = pool.acquire();
+      REQUIRE(doc);
+      first = doc.get();
+      deserializeJson(*doc, "{\"hello\":\"world\"}");
+    }
+    REQUIRE(pool.idleDocuments() == 1);
+
+    auto doc = pool.acquire();
+    REQUIRE(doc.get() == first);
+    REQUIRE(doc->isNull());
+    REQUIRE(pool.idleDocuments() == 0);
+  }
+
+  SECTION("doesn't call the allocator once warm") {
+    JsonDocumentPool pool(JsonDocumentPool::Options(), &spy);
+
+    for (int i = 0; i < 2; i++) {
+      auto doc = pool.acquire();
+      deserializeJson(*doc, "[1,[2,3],{}]");
+      if (i == 0)
+        spy.clearLog();
+    }
+
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("reserves the capacity of the documents") {
+    JsonDocumentPool::Options options;
+    options.values = 10;
+    options.stringBytes = 100;
+    JsonDocumentPool pool(options, &spy);
+    spy.clearLog();
+
+    auto doc = pool.acquire();
+    spy.clearLog();
+    deserializeJson(*doc, "[\"hello\",\"world\"]");
+
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("arenas") {
+    JsonDocumentPool::Options options;
+    options.arenaBlockSize = 1024;
+    JsonDocumentPool pool(options, &spy);
+
+    for (int i = 0; i < 2; i++) {
+      auto doc = pool.acquire();
+      deserializeJson(*doc, "{\"hello\":[\"world\",1,2,3]}");
+      REQUIRE(doc->as<std::string>() == "{\"hello\":[\"world\",1,2,3]}");
+      if (i == 0)
+        spy.clearLog();
+    }
+
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("destroys the documents above maxIdleDocuments") {
+    JsonDocumentPool::Options options;
+    options.maxIdleDocuments = 0;
+    JsonDocumentPool pool(options, &spy);
+
+    pool.acquire();
+
+    REQUIRE(pool.idleDocuments() == 0);
+    REQUIRE(spy.allocatedBytes() == 0);
+  }
+
+  SECTION("keeps exactly maxIdleDocuments") {
+    JsonDocumentPool::Options options;
+    options.maxIdleDocuments = 5;
+    options.shards = 2;
+    JsonDocumentPool pool(options, &spy);
+
+    {
+      std::vector<JsonDocumentPool::Handle> handles;
+      for (int i = 0; i < 8; i++)
+        handles.push_back(pool.acquire());
+    }
+
+    REQUIRE(pool.idleDocuments() == 5);
+  }
+
+  SECTION("keeps 64 documents by default") {
+    JsonDocumentPool pool(JsonDocumentPool::Options(), &spy);
+
+    {
+      std::vector<JsonDocumentPool::Handle> handles;
+      for (int i = 0; i < 100; i++)
+        handles.push_back(pool.acquire());
+    }
+
+    REQUIRE(pool.idleDocuments() == 64);
+  }
+
+  SECTION("returns an empty handle when the allocation fails") {
+    JsonDocumentPool::Options options;
+    options.maxIdleDocuments = 0;
+    JsonDocumentPool pool(options, FailingAllocator::instance());
+
+    auto doc = pool.acquire();
+
+    REQUIRE_FALSE(doc);
+    REQUIRE(doc.get() == nullptr);
+  }
+
+  SECTION("handles can be moved") {
+    JsonDocumentPool pool(JsonDocumentPool::Options(), &spy);
+
+    auto a = pool.acquire();
+    JsonDocument* doc = a.get();
+    JsonDocumentPool::Handle b(std::move(a));
+
+    REQUIRE_FALSE(a);
+    REQUIRE(b.get() == doc);
+
+    b.reset();
+    REQUIRE_FALSE(b);
+    REQUIRE(pool.idleDocuments() == 1);
+  }
+
+  SECTION("releases everything when destroyed") {
+    {
+      JsonDocumentPool pool(JsonDocumentPool::Options(), &spy);
+      auto a = pool.acquire();
+      auto b = pool.acquire();
+      a->add("hello");
+      b->add("world");
+    }
+
+    REQUIRE(spy.allocatedBytes() == 0);
+  }
+}
+
+TEST_CASE("JsonDocumentPool with several threads") {
+  JsonDocumentPool pool;
+  std::atomic<int> errors(0);
+  std::vector<std::thread> threads;
+
+  for (int t = 0; t < 8; t++) {
+    threads.emplace_back([&pool, &errors, t]() {
+      for (int i = 0; i < 500; i++) {
+        auto doc = pool.acquire();
+        std::string json = "{\"thread\":" + std::to_string(t) +
+                           ",\"i\":" + std::to_string(i) + "}";
+        if (!doc->isNull() || deserializeJson(*doc, json) ||
+            (*doc)["thread"].as<int>() != t || (*doc)["i"].as<int>() != i)
+          errors++;
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  REQUIRE(errors == 0);
+  REQUIRE(pool.idleDocuments() >= 1);
+  REQUIRE(pool.idleDocuments() <= 8);
+}
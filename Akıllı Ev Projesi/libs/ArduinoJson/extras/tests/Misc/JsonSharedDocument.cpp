@@ -0,0 +1,129 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+#include <vector>
+
+#include "Allocators.hpp"
+
+using ArduinoJson::detail::SharedDocumentData;
+
+TEST_CASE("JsonSharedDocument") {
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+  deserializeJson(doc, "{\"name\":\"gateway\",\"ports\":[80,443]}");
+  std::string json = doc.as<std::string>();
+
+  SECTION("freezes the document") {
+    JsonSharedDocument shared(std::move(doc));
+
+    REQUIRE(doc.isNull());
+    REQUIRE(shared.as<std::string>() == json);
+    REQUIRE(shared["name"] == "gateway");
+    REQUIRE(shared["ports"][1] == 443);
+    REQUIRE(shared.size() == 2);
+    REQUIRE(shared.is<JsonObjectConst>());
+    REQUIRE(shared.useCount() == 1);
+  }
+
+  SECTION("copies share the document") {
+    JsonSharedDocument a(std::move(doc));
+    JsonSharedDocument b = a;
+    JsonSharedDocument c;
+    c = b;
+
+    REQUIRE(a.useCount() == 3);
+    REQUIRE(c.root() == a.root());
+    REQUIRE(c["name"].as<const char*>() == a["name"].as<const char*>());
+  }
+
+  SECTION("fan-out doesn't allocate") {
+    JsonSharedDocument shared(std::move(doc));
+    spy.clearLog();
+
+    std::vector<JsonSharedDocument> consumers(100, shared);
+
+    REQUIRE(shared.useCount() == 101);
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("the last handle destroys the document") {
+    size_t documentBytes = spy.allocatedBytes();
+    {
+      JsonSharedDocument a(std::move(doc));
+      JsonSharedDocument b = a;
+      a.release();
+
+      REQUIRE(a.isNull());
+      REQUIRE(a.useCount() == 0);
+      REQUIRE(b.useCount() == 1);
+      REQUIRE(spy.allocatedBytes() ==
+              documentBytes + sizeof(SharedDocumentData));
+    }
+
+    REQUIRE(spy.allocatedBytes() == 0);
+  }
+
+  SECTION("unshare() moves the document if it's not shared") {
+    JsonSharedDocument shared(std::move(doc));
+    spy.clearLog();
+
+    JsonDocument copy = shared.unshare();
+
+    REQUIRE(shared.isNull());
+    REQUIRE(copy.as<std::string>() == json);
+    REQUIRE(spy.log() == AllocatorLog{
+                             Deallocate(sizeof(SharedDocumentData)),
+                         });
+  }
+
+  SECTION("unshare() copies the document if it's shared") {
+    JsonSharedDocument a(std::move(doc));
+    JsonSharedDocument b = a;
+
+    JsonDocument copy = b.unshare();
+    copy["name"] = "modified";
+
+    REQUIRE(a.useCount() == 1);
+    REQUIRE(b.isNull());
+    REQUIRE(a["name"] == "gateway");
+    REQUIRE(copy["name"] == "modified");
+    REQUIRE(copy.allocator() == &spy);
+  }
+
+  SECTION("unshare() on a null handle") {
+    JsonSharedDocument shared;
+
+    REQUIRE(shared.unshare().isNull());
+  }
+
+  SECTION("move") {
+    JsonSharedDocument a(std::move(doc));
+    JsonSharedDocument b(std::move(a));
+
+    REQUIRE(a.isNull());
+    REQUIRE(b.useCount() == 1);
+    REQUIRE(b.as<std::string>() == json);
+  }
+
+  SECTION("can be serialized") {
+    JsonSharedDocument shared(std::move(doc));
+    std::string output;
+
+    serializeJson(shared, output);
+
+    REQUIRE(output == json);
+  }
+}
+
+TEST_CASE("JsonSharedDocument allocation failure") {
+  JsonDocument doc(FailingAllocator::instance());
+  JsonSharedDocument shared(std::move(doc));
+
+  REQUIRE(shared.isNull());
+  REQUIRE(shared.useCount() == 0);
+}
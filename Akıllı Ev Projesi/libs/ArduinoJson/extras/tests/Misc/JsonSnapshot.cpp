@@ -0,0 +1,328 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+#include <vector>
+
+#include "Allocators.hpp"
+
+// A buffer aligned on 8 bytes, as returned by mmap() or malloc()
+struct Image {
+  explicit Image(size_t n) : words((n + 7) / 8), size(n) {}
+
+  void* data() {
+    return words.data();
+  }
+
+  char* bytes() {
+    return reinterpret_cast<char*>(words.data());
+  }
+
+  std::vector<uint64_t> words;
+  size_t size;
+};
+
+static Image save(const JsonDocument& doc) {
+  Image image(measureSnapshot(doc));
+  REQUIRE(image.size > 0);
+  REQUIRE(serializeSnapshot(doc, image.data(), image.size) == image.size);
+  return image;
+}
+
+using ArduinoJson::detail::SlotId;
+using ArduinoJson::detail::SnapshotHeader;
+using ArduinoJson::detail::VariantData;
+
+static SnapshotHeader& headerOf(Image& image) {
+  return *reinterpret_cast<SnapshotHeader*>(image.data());
+}
+
+static VariantData* slotOf(Image& image, SlotId id) {
+  return reinterpret_cast<VariantData*>(
+      image.bytes() + ArduinoJson::detail::snapshotSlotsOffset +
+      id * ArduinoJson::detail::ResourceManager::slotSize);
+}
+
+// Updates the checksum after a change, like a forged image would
+static void sign(Image& image) {
+  headerOf(image).checksum =
+      ArduinoJson::detail::snapshotChecksum(image.bytes(), headerOf(image));
+}
+
+TEST_CASE("JsonSnapshot") {
+  JsonDocument doc;
+  deserializeJson(doc,
+                  "{\"name\":\"gateway\",\"port\":8080,\"ratio\":0.25,"
+                  "\"big\":12345678901234,\"pi\":3.141592653589793,"
+                  "\"enabled\":true,\"nothing\":null,\"tiny\":\"abc\","
+                  "\"routes\":[{\"path\":\"/a\",\"target\":\"http://a\"},"
+                  "{\"path\":\"/b\",\"target\":\"http://b\"}]}");
+  doc["linked"] = "a linked string";
+  doc["raw"] = serialized("[1,2]");
+
+  SECTION("same content as the document") {
+    Image image = save(doc);
+    JsonSnapshot snapshot;
+
+    REQUIRE(snapshot.load(image.data(), image.size) ==
+            DeserializationError::Ok);
+    REQUIRE(snapshot.as<JsonVariantConst>() == doc.as<JsonVariantConst>());
+    REQUIRE(snapshot.as<std::string>() == doc.as<std::string>());
+    REQUIRE(snapshot.size() == doc.size());
+    REQUIRE(snapshot["routes"][1]["target"] == "http://b");
+    REQUIRE(snapshot["big"].as<long long>() == 12345678901234);
+    REQUIRE(snapshot["pi"].as<double>() == 3.141592653589793);
+    REQUIRE(snapshot["linked"] == "a linked string");
+    REQUIRE(snapshot["missing"].isNull());
+  }
+
+  SECTION("strings point to the image") {
+    Image image = save(doc);
+    JsonSnapshot snapshot;
+    snapshot.load(image.data(), image.size);
+
+    const char* name = snapshot["name"].as<const char*>();
+
+    REQUIRE(name >= image.bytes());
+    REQUIRE(name < image.bytes() + image.size);
+  }
+
+  SECTION("repeated keys are written once") {
+    JsonDocument small, large;
+    for (int i = 0; i < 2; i++)
+      small.add<JsonObject>()["a long key"] = i;
+    for (int i = 0; i < 20; i++)
+      large.add<JsonObject>()["a long key"] = i;
+
+    size_t slotSize = ArduinoJson::detail::ResourceManager::slotSize;
+    REQUIRE(measureSnapshot(large) - measureSnapshot(small) ==
+            (large.as<JsonArray>().size() - small.as<JsonArray>().size()) *
+                (3 * slotSize + sizeof(uint32_t)));
+  }
+
+  SECTION("the document doesn't need to outlive the image") {
+    Image image = save(doc);
+    std::string expected = doc.as<std::string>();
+    doc.clear();
+    JsonSnapshot snapshot;
+    snapshot.load(image.data(), image.size);
+
+    REQUIRE(snapshot.as<std::string>() == expected);
+  }
+
+  SECTION("load the same image twice") {
+    Image image = save(doc);
+    JsonSnapshot a, b;
+
+    REQUIRE(a.load(image.data(), image.size) == DeserializationError::Ok);
+    REQUIRE(b.load(image.data(), image.size) == DeserializationError::Ok);
+    REQUIRE(b.as<std::string>() == doc.as<std::string>());
+  }
+
+  SECTION("load a copy of a loaded image") {
+    Image image = save(doc);
+    JsonSnapshot a;
+    a.load(image.data(), image.size);
+    Image copy = image;
+    JsonSnapshot b;
+
+    REQUIRE(b.load(copy.data(), copy.size) == DeserializationError::Ok);
+    REQUIRE(b.as<std::string>() == doc.as<std::string>());
+    REQUIRE(b["name"].as<const char*>() >= copy.bytes());
+  }
+
+  SECTION("load another image") {
+    Image image = save(doc);
+    JsonDocument other;
+    other["other"] = "value";
+    Image otherImage = save(other);
+    JsonSnapshot snapshot;
+    snapshot.load(image.data(), image.size);
+
+    REQUIRE(snapshot.load(otherImage.data(), otherImage.size) ==
+            DeserializationError::Ok);
+    REQUIRE(snapshot.as<std::string>() == "{\"other\":\"value\"}");
+  }
+
+  SECTION("the image is deterministic") {
+    Image a = save(doc);
+    Image b = save(doc);
+
+    REQUIRE(a.words == b.words);
+  }
+
+  SECTION("buffer too small") {
+    size_t size = measureSnapshot(doc);
+    Image image(size - 1);
+
+    REQUIRE(serializeSnapshot(doc, image.data(), image.size) == 0);
+  }
+}
+
+TEST_CASE("JsonSnapshot errors") {
+  JsonDocument doc;
+  doc["hello"] = "world";
+  Image image = save(doc);
+  JsonSnapshot snapshot;
+
+  SECTION("empty input") {
+    REQUIRE(snapshot.load(nullptr, 0) == DeserializationError::EmptyInput);
+    REQUIRE(snapshot.isNull());
+  }
+
+  SECTION("truncated image") {
+    REQUIRE(snapshot.load(image.data(), image.size - 1) ==
+            DeserializationError::IncompleteInput);
+    REQUIRE(snapshot.load(image.data(), 16) ==
+            DeserializationError::IncompleteInput);
+  }
+
+  SECTION("wrong magic") {
+    image.bytes()[0] = 'X';
+
+    REQUIRE(snapshot.load(image.data(), image.size) ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("wrong version") {
+    image.bytes()[4]++;
+
+    REQUIRE(snapshot.load(image.data(), image.size) ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("corrupted string") {
+    char* last = image.bytes() + image.size - 1;
+    while (*last != 'd')  // the last character of "world"
+      last--;
+    *last = 'D';
+
+    REQUIRE(snapshot.load(image.data(), image.size) ==
+            DeserializationError::InvalidInput);
+    REQUIRE(snapshot.isNull());
+  }
+
+  SECTION("corrupted string in a loaded image") {
+    JsonSnapshot other;
+    REQUIRE(other.load(image.data(), image.size) == DeserializationError::Ok);
+    other.unload();
+    char* last = image.bytes() + image.size - 1;
+    while (*last != 'd')
+      last--;
+    *last = 'D';
+
+    REQUIRE(snapshot.load(image.data(), image.size) ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("too many slots") {
+    headerOf(image).slotCount = 0xFFFFFFFF;
+
+    REQUIRE(snapshot.load(image.data(), image.size) ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("slot id out of range") {
+    slotOf(image, 1)->setNext(2);
+    sign(image);
+
+    REQUIRE(snapshot.load(image.data(), image.size) ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("cycle") {
+    slotOf(image, 1)->setNext(0);
+    sign(image);
+
+    REQUIRE(snapshot.load(image.data(), image.size) ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("string longer than the image") {
+    auto node = reinterpret_cast<ArduinoJson::detail::StringNode*>(
+        image.bytes() + headerOf(image).stringsOffset);
+    node->length = 200;
+    sign(image);
+
+    REQUIRE(snapshot.load(image.data(), image.size) ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("relocation of a variant that isn't a string") {
+    auto rootOffset = uint32_t(ArduinoJson::detail::snapshotRootOffset);
+    memcpy(image.bytes() + headerOf(image).relocationsOffset, &rootOffset,
+           sizeof(rootOffset));
+    sign(image);
+
+    REQUIRE(snapshot.load(image.data(), image.size) ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("missing relocation leaves the image unchanged") {
+    headerOf(image).relocationCount--;
+    sign(image);
+    Image copy = image;
+
+    REQUIRE(snapshot.load(image.data(), image.size) ==
+            DeserializationError::InvalidInput);
+    REQUIRE(image.words == copy.words);
+  }
+
+  SECTION("misaligned image") {
+    Image copy(image.size + 8);
+    memcpy(copy.bytes() + 1, image.bytes(), image.size);
+
+    REQUIRE(snapshot.load(copy.bytes() + 1, image.size) ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("previous image is unloaded on error") {
+    REQUIRE(snapshot.load(image.data(), image.size) ==
+            DeserializationError::Ok);
+    REQUIRE(snapshot.load(image.data(), 3) ==
+            DeserializationError::IncompleteInput);
+    REQUIRE(snapshot.isNull());
+  }
+}
+
+TEST_CASE("JsonSnapshot nesting limit") {
+  JsonDocument doc;
+  deserializeJson(doc, "[[[[[[[[[[[42]]]]]]]]]]]",
+                  DeserializationOption::NestingLimit(11));
+  Image image = save(doc);
+  JsonSnapshot snapshot;
+
+  SECTION("default limit") {
+    REQUIRE(snapshot.load(image.data(), image.size) ==
+            DeserializationError::TooDeep);
+  }
+
+  SECTION("custom limit") {
+    REQUIRE(snapshot.load(image.data(), image.size,
+                          DeserializationOption::NestingLimit(11)) ==
+            DeserializationError::Ok);
+    REQUIRE(snapshot.as<std::string>() == "[[[[[[[[[[[42]]]]]]]]]]]");
+  }
+}
+
+TEST_CASE("JsonSnapshot memory") {
+  JsonDocument doc;
+  for (int i = 0; i < 1000; i++)
+    doc.add(i);
+  Image image = save(doc);
+  SpyingAllocator spy;
+
+  {
+    JsonSnapshot snapshot(&spy);
+    REQUIRE(snapshot.load(image.data(), image.size) ==
+            DeserializationError::Ok);
+    REQUIRE(snapshot[999] == 999);
+    REQUIRE(snapshot.size() == 1000);
+  }
+
+  REQUIRE(spy.log() == AllocatorLog{});
+}
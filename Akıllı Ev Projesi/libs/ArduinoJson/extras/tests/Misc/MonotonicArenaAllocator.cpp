@@ -0,0 +1,182 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+#include "Allocators.hpp"
+
+TEST_CASE("MonotonicArenaAllocator") {
+  SpyingAllocator spy;
+
+  SECTION("allocates from the caller's buffer first") {
+    alignas(void*) char buffer[256];
+    MonotonicArenaAllocator arena(buffer, sizeof(buffer), 1024, &spy);
+
+    auto p = reinterpret_cast<char*>(arena.allocate(10));
+    REQUIRE(p >= buffer);
+    REQUIRE(p + 10 <= buffer + sizeof(buffer));
+    REQUIRE(spy.log() == AllocatorLog{});
+
+    arena.allocate(1000);
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(1024 + 2 * sizeof(void*)),
+                         });
+  }
+
+  SECTION("chains blocks from the upstream allocator") {
+    MonotonicArenaAllocator arena(64, &spy);
+
+    auto p1 = arena.allocate(8);
+    auto p2 = arena.allocate(8);
+    REQUIRE(p1 != p2);
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(64 + 2 * sizeof(void*)),
+                         });
+
+    arena.allocate(40);
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(64 + 2 * sizeof(void*)) * 2,
+                         });
+  }
+
+  SECTION("returns null when upstream fails") {
+    MonotonicArenaAllocator arena(64, FailingAllocator::instance());
+
+    REQUIRE(arena.allocate(8) == nullptr);
+  }
+
+  SECTION("returns null when the size would overflow") {
+    MonotonicArenaAllocator arena(64, &spy);
+    auto p = arena.allocate(8);
+
+    REQUIRE(arena.allocate(size_t(-1)) == nullptr);
+    REQUIRE(arena.allocate(size_t(-1) - sizeof(void*)) == nullptr);
+    REQUIRE(arena.reallocate(p, size_t(-1)) == nullptr);
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(64 + 2 * sizeof(void*)),
+                         });
+  }
+
+  SECTION("returns null when the block size would overflow") {
+    MonotonicArenaAllocator arena(size_t(-1), &spy);
+
+    REQUIRE(arena.allocate(8) == nullptr);
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("reallocate() grows the last allocation in place") {
+    MonotonicArenaAllocator arena(256, &spy);
+
+    auto p = reinterpret_cast<char*>(arena.allocate(8));
+    strcpy(p, "hello");
+
+    REQUIRE(arena.reallocate(p, 100) == p);
+    REQUIRE(arena.reallocate(p, 6) == p);
+    REQUIRE(std::string(p) == "hello");
+
+    // the space released by the shrink is available again
+    auto q = reinterpret_cast<char*>(arena.allocate(8));
+    REQUIRE(q == p + 8 + sizeof(void*));
+  }
+
+  SECTION("reallocate() copies the other allocations") {
+    MonotonicArenaAllocator arena(256, &spy);
+
+    auto p = reinterpret_cast<char*>(arena.allocate(6));
+    strcpy(p, "hello");
+    arena.allocate(8);
+
+    auto q = reinterpret_cast<char*>(arena.reallocate(p, 32));
+    REQUIRE(q != p);
+    REQUIRE(std::string(q) == "hello");
+  }
+
+  SECTION("reallocate() shrinks the other allocations in place") {
+    MonotonicArenaAllocator arena(256, &spy);
+
+    auto p = reinterpret_cast<char*>(arena.allocate(32));
+    strcpy(p, "hello");
+    auto q = arena.allocate(8);
+
+    REQUIRE(arena.reallocate(p, 6) == p);
+    REQUIRE(std::string(p) == "hello");
+
+    // the space isn't released, but none is consumed either
+    auto r = reinterpret_cast<char*>(arena.allocate(8));
+    REQUIRE(r == reinterpret_cast<char*>(q) + 8 + sizeof(void*));
+
+    // the size was updated, so growing copies the new size only
+    auto s = reinterpret_cast<char*>(arena.reallocate(p, 16));
+    REQUIRE(s != p);
+    REQUIRE(std::string(s) == "hello");
+  }
+
+  SECTION("reallocate(nullptr) allocates") {
+    MonotonicArenaAllocator arena(256, &spy);
+
+    REQUIRE(arena.reallocate(nullptr, 8) != nullptr);
+  }
+
+  SECTION("deallocate() releases the last allocation only") {
+    MonotonicArenaAllocator arena(256, &spy);
+
+    auto p1 = arena.allocate(8);
+    auto p2 = arena.allocate(8);
+    arena.deallocate(p1);
+    REQUIRE(arena.allocate(8) != p1);
+
+    arena.deallocate(p2);  // not the last anymore
+    auto p3 = arena.allocate(8);
+    arena.deallocate(p3);
+    REQUIRE(arena.allocate(8) == p3);
+  }
+
+  SECTION("reset() reuses the blocks") {
+    MonotonicArenaAllocator arena(64, &spy);
+
+    auto p = arena.allocate(40);
+    arena.allocate(40);
+    arena.allocate(200);
+    arena.reset();
+    spy.clearLog();
+
+    REQUIRE(arena.allocate(40) == p);
+    arena.allocate(40);
+    arena.allocate(200);
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("releases the blocks in the destructor") {
+    {
+      MonotonicArenaAllocator arena(64, &spy);
+      arena.allocate(40);
+      arena.allocate(100);
+    }
+    REQUIRE(spy.allocatedBytes() == 0);
+  }
+
+  SECTION("no upstream allocation after the first document") {
+    MonotonicArenaAllocator arena(1024, &spy);
+    std::string input =
+        "{\"name\":\"a string long enough to need a StringNode\","
+        "\"list\":[1,2,3,{\"key\":\"value\"}],\"pi\":3.14}";
+
+    for (int i = 0; i < 3; i++) {
+      {
+        JsonDocument doc(&arena);
+        REQUIRE(deserializeJson(doc, input) == DeserializationError::Ok);
+        REQUIRE(doc["list"][3]["key"] == "value");
+        REQUIRE(doc.as<std::string>() == input);
+      }
+      arena.reset();
+      if (i == 0)
+        spy.clearLog();
+    }
+
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+}
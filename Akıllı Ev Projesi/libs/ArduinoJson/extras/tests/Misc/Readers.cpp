@@ -8,6 +8,8 @@
 
 #include <sstream>
 
+using ArduinoJson::DeserializationError;
+using ArduinoJson::JsonDocument;
 using namespace ArduinoJson::detail;
 
 TEST_CASE("Reader<std::istringstream>") {
@@ -49,6 +51,60 @@ TEST_CASE("Reader<std::istringstream>") {
     REQUIRE(buffer[5] == 'F');
     REQUIRE(buffer[6] == 'g');
   }
+
+  SECTION("sets eofbit and failbit at the end, like get()") {
+    std::istringstream src("A");
+    Reader<std::istringstream> reader(src);
+
+    REQUIRE(reader.read() == 'A');
+    REQUIRE(src.good());
+    REQUIRE(reader.read() == -1);
+    REQUIRE(src.eof());
+    REQUIRE(src.fail());
+  }
+
+  SECTION("doesn't read a stream in a failed state, like get()") {
+    std::istringstream src("ABC");
+    src.setstate(std::ios::failbit);
+    Reader<std::istringstream> reader(src);
+
+    char buffer[4];
+    REQUIRE(reader.read() == -1);
+    REQUIRE(reader.readBytes(buffer, 3) == 0);
+    src.clear();
+    REQUIRE(reader.read() == 'A');
+  }
+
+  SECTION("flushes the tied stream, like get()") {
+    struct SyncCounter : std::stringbuf {
+      int syncs = 0;
+
+      int sync() override {
+        syncs++;
+        return 0;
+      }
+    };
+    SyncCounter buf;
+    std::ostream out(&buf);
+    std::istringstream src("AB");
+    src.tie(&out);
+
+    Reader<std::istringstream> reader(src);
+    REQUIRE(reader.read() == 'A');
+    REQUIRE(reader.read() == 'B');
+
+    REQUIRE(buf.syncs == 1);
+  }
+
+  SECTION("stream without a buffer") {
+    std::istream src(nullptr);
+    Reader<std::istream> reader(src);
+
+    char buffer[4];
+    REQUIRE(reader.read() == -1);
+    REQUIRE(reader.readBytes(buffer, 3) == 0);
+    REQUIRE(src.fail());
+  }
 }
 
 TEST_CASE("BoundedReader<const char*>") {
@@ -170,19 +226,32 @@ TEST_CASE("IteratorReader") {
 
 class StreamStub : public Stream {
  public:
-  StreamStub(const char* s) : stream_(s) {}
+  StreamStub(const char* s, int available = 0)
+      : stream_(s), available_(available) {}
+
+  int available() {
+    return available_;
+  }
 
   int read() {
+    reads++;
+    if (available_ > 0)
+      available_--;
     return stream_.get();
   }
 
   size_t readBytes(char* buffer, size_t length) {
+    readBytesCalls++;
     stream_.read(buffer, static_cast<std::streamsize>(length));
     return static_cast<size_t>(stream_.gcount());
   }
 
+  int reads = 0;
+  int readBytesCalls = 0;
+
  private:
   std::istringstream stream_;
+  int available_;
 };
 
 TEST_CASE("Reader<Stream>") {
@@ -195,6 +264,19 @@ TEST_CASE("Reader<Stream>") {
     REQUIRE(reader.read() == -1);
   }
 
+  SECTION("read() skips the timeout for the available characters") {
+    StreamStub src("ABC", 2);
+    Reader<StreamStub> reader(src);
+
+    REQUIRE(reader.read() == 'A');
+    REQUIRE(reader.read() == 'B');
+    REQUIRE(reader.read() == 'C');
+    REQUIRE(reader.read() == -1);
+
+    REQUIRE(src.reads == 2);
+    REQUIRE(src.readBytesCalls == 2);
+  }
+
   SECTION("readBytes() all at once") {
     StreamStub src("ABC");
     Reader<StreamStub> reader(src);
@@ -225,3 +307,198 @@ TEST_CASE("Reader<Stream>") {
     REQUIRE(buffer[6] == 'g');
   }
 }
+
+class UnreadableStreamStub : public Stream {
+ public:
+  UnreadableStreamStub(const char* s) : data_(s) {}
+
+  int available() {
+    return static_cast<int>(data_.size() - position_);
+  }
+
+  int read() {
+    if (position_ == data_.size())
+      return -1;
+    return static_cast<unsigned char>(data_[position_++]);
+  }
+
+  size_t readBytes(char* buffer, size_t length) {
+    readBytesCalls++;
+    size_t n = data_.copy(buffer, length, position_);
+    position_ += n;
+    return n;
+  }
+
+  void unread(const char* buffer, size_t length) {
+    data_ = std::string(buffer, length) + data_.substr(position_);
+    position_ = 0;
+  }
+
+  std::string remaining() const {
+    return data_.substr(position_);
+  }
+
+  int readBytesCalls = 0;
+
+ private:
+  std::string data_;
+  size_t position_ = 0;
+};
+
+TEST_CASE("Reader<Stream> with unread()") {
+  SECTION("read()") {
+    UnreadableStreamStub src("\x01\xFF");
+    Reader<UnreadableStreamStub> reader(src);
+
+    REQUIRE(reader.read() == 0x01);
+    REQUIRE(reader.read() == 0xFF);
+    REQUIRE(reader.read() == -1);
+  }
+
+  SECTION("read() reads the available characters at once") {
+    UnreadableStreamStub src("ABC");
+    Reader<UnreadableStreamStub> reader(src);
+
+    REQUIRE(reader.read() == 'A');
+    REQUIRE(reader.read() == 'B');
+    REQUIRE(reader.read() == 'C');
+
+    REQUIRE(src.readBytesCalls == 1);
+  }
+
+  SECTION("gives the unread characters back to the stream") {
+    UnreadableStreamStub src("ABCDEF");
+    {
+      Reader<UnreadableStreamStub> reader(src);
+      REQUIRE(reader.read() == 'A');
+      REQUIRE(reader.read() == 'B');
+      REQUIRE(src.remaining() == "");
+    }
+    REQUIRE(src.remaining() == "CDEF");
+  }
+
+  SECTION("readBytes() starts with the buffered characters") {
+    UnreadableStreamStub src("ABCDEF");
+    Reader<UnreadableStreamStub> reader(src);
+
+    char buffer[8] = "abcdefg";
+    REQUIRE(reader.read() == 'A');
+    REQUIRE(reader.readBytes(buffer, 4) == 4);
+    REQUIRE(reader.readBytes(buffer + 4, 4) == 1);
+
+    REQUIRE(buffer[0] == 'B');
+    REQUIRE(buffer[1] == 'C');
+    REQUIRE(buffer[2] == 'D');
+    REQUIRE(buffer[3] == 'E');
+    REQUIRE(buffer[4] == 'F');
+    REQUIRE(buffer[5] == 'f');
+  }
+}
+
+TEST_CASE("deserializeJson(Stream&) with unread()") {
+  JsonDocument doc;
+  UnreadableStreamStub src("{\"a\":1}[2]\n\"three\"");
+
+  REQUIRE(deserializeJson(doc, src) == DeserializationError::Ok);
+  REQUIRE(doc["a"] == 1);
+  REQUIRE(src.remaining() == "[2]\n\"three\"");
+  REQUIRE(deserializeJson(doc, src) == DeserializationError::Ok);
+  REQUIRE(doc[0] == 2);
+  REQUIRE(src.remaining() == "\n\"three\"");
+  REQUIRE(deserializeJson(doc, src) == DeserializationError::Ok);
+  REQUIRE(doc == "three");
+  REQUIRE(deserializeJson(doc, src) == DeserializationError::EmptyInput);
+}
+
+TEST_CASE("deserializeMsgPack(Stream&) with unread()") {
+  JsonDocument doc;
+  UnreadableStreamStub src(
+      "\x92\x01\x02\xA3"
+      "abc\x2A");
+
+  REQUIRE(deserializeMsgPack(doc, src) == DeserializationError::Ok);
+  REQUIRE(doc[1] == 2);
+  REQUIRE(src.remaining() == "\xA3" "abc\x2A");
+  REQUIRE(deserializeMsgPack(doc, src) == DeserializationError::Ok);
+  REQUIRE(doc == "abc");
+  REQUIRE(src.remaining() == "\x2A");
+  REQUIRE(deserializeMsgPack(doc, src) == DeserializationError::Ok);
+  REQUIRE(doc == 42);
+  REQUIRE(deserializeMsgPack(doc, src) == DeserializationError::EmptyInput);
+}
+
+TEST_CASE("BufferedStream") {
+  SECTION("read() reads the available characters at once") {
+    StreamStub src("ABC", 3);
+    ArduinoJson::BufferedStream stream(src);
+
+    REQUIRE(stream.read() == 'A');
+    REQUIRE(stream.read() == 'B');
+    REQUIRE(stream.read() == 'C');
+    REQUIRE(stream.read() == -1);
+
+    REQUIRE(src.reads == 0);
+    REQUIRE(src.readBytesCalls == 2);
+  }
+
+  SECTION("read() waits for one character when none is available") {
+    StreamStub src("AB");
+    ArduinoJson::BufferedStream stream(src);
+
+    REQUIRE(stream.read() == 'A');
+    REQUIRE(stream.read() == 'B');
+
+    REQUIRE(src.readBytesCalls == 2);
+  }
+
+  SECTION("readBytes() starts with the buffered characters") {
+    StreamStub src("ABCDEF", 2);
+    ArduinoJson::BufferedStream stream(src);
+
+    char buffer[8] = "abcdefg";
+    REQUIRE(stream.read() == 'A');
+    REQUIRE(stream.readBytes(buffer, 4) == 4);
+    REQUIRE(stream.readBytes(buffer + 4, 4) == 1);
+
+    REQUIRE(buffer[0] == 'B');
+    REQUIRE(buffer[1] == 'C');
+    REQUIRE(buffer[2] == 'D');
+    REQUIRE(buffer[3] == 'E');
+    REQUIRE(buffer[4] == 'F');
+    REQUIRE(buffer[5] == 'f');
+  }
+}
+
+TEST_CASE("deserializeJson(BufferedStream&)") {
+  JsonDocument doc;
+  StreamStub src("{\"a\":1}[2]\n\"three\"", 18);
+  ArduinoJson::BufferedStream stream(src);
+
+  REQUIRE(deserializeJson(doc, stream) == DeserializationError::Ok);
+  REQUIRE(doc["a"] == 1);
+  REQUIRE(deserializeJson(doc, stream) == DeserializationError::Ok);
+  REQUIRE(doc[0] == 2);
+  REQUIRE(deserializeJson(doc, stream) == DeserializationError::Ok);
+  REQUIRE(doc == "three");
+  REQUIRE(deserializeJson(doc, stream) == DeserializationError::EmptyInput);
+
+  REQUIRE(src.reads == 0);
+}
+
+TEST_CASE("deserializeMsgPack(BufferedStream&)") {
+  JsonDocument doc;
+  StreamStub src(
+      "\x92\x01\x02\xA3"
+      "abc\x2A",
+      9);
+  ArduinoJson::BufferedStream stream(src);
+
+  REQUIRE(deserializeMsgPack(doc, stream) == DeserializationError::Ok);
+  REQUIRE(doc[1] == 2);
+  REQUIRE(deserializeMsgPack(doc, stream) == DeserializationError::Ok);
+  REQUIRE(doc == "abc");
+  REQUIRE(deserializeMsgPack(doc, stream) == DeserializationError::Ok);
+  REQUIRE(doc == 42);
+  REQUIRE(deserializeMsgPack(doc, stream) ==
+          DeserializationError::EmptyInput);
+}
@@ -0,0 +1,98 @@
+#define ARDUINOJSON_VERSION_NAMESPACE DoublyLinked
+#define ARDUINOJSON_DOUBLY_LINKED_COLLECTIONS 1
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+#include <string>
+
+static std::string toJson(const JsonDocument& doc) {
+  std::string json;
+  serializeJson(doc, json);
+  return json;
+}
+
+TEST_CASE("ARDUINOJSON_DOUBLY_LINKED_COLLECTIONS == 1") {
+  JsonDocument doc;
+
+  SECTION("JsonArray::remove(iterator) while iterating") {
+    deserializeJson(doc, "[0,1,2,3,4,5,6,7,8,9]");
+    JsonArray arr = doc.as<JsonArray>();
+
+    for (auto it = arr.begin(); it != arr.end(); ++it) {
+      if (it->as<int>() % 2 == 0)
+        arr.remove(it);
+    }
+
+    REQUIRE(toJson(doc) == "[1,3,5,7,9]");
+    arr.add(10);
+    REQUIRE(toJson(doc) == "[1,3,5,7,9,10]");
+  }
+
+  SECTION("JsonArray::remove(index)") {
+    deserializeJson(doc, "[0,1,2,3]");
+    JsonArray arr = doc.as<JsonArray>();
+
+    arr.remove(3);
+    arr.remove(0);
+    arr.remove(1);
+    REQUIRE(toJson(doc) == "[1]");
+
+    arr.remove(0);
+    REQUIRE(toJson(doc) == "[]");
+
+    arr.add(4);
+    arr.add(5);
+    arr.remove(0);
+    REQUIRE(toJson(doc) == "[5]");
+  }
+
+  SECTION("JsonObject::remove(iterator) while iterating") {
+    deserializeJson(doc, "{\"a\":1,\"b\":2,\"c\":3,\"d\":4,\"e\":5}");
+    JsonObject obj = doc.as<JsonObject>();
+
+    for (auto it = obj.begin(); it != obj.end(); ++it) {
+      if (it->value().as<int>() % 2 == 1)
+        obj.remove(it);
+    }
+
+    REQUIRE(toJson(doc) == "{\"b\":2,\"d\":4}");
+    obj["f"] = 6;
+    REQUIRE(toJson(doc) == "{\"b\":2,\"d\":4,\"f\":6}");
+  }
+
+  SECTION("JsonObject::remove(key)") {
+    deserializeJson(doc, "{\"a\":1,\"b\":2,\"c\":3}");
+    JsonObject obj = doc.as<JsonObject>();
+
+    obj.remove("c");
+    obj.remove("a");
+    REQUIRE(toJson(doc) == "{\"b\":2}");
+
+    obj["d"] = 4;
+    obj.remove("b");
+    obj["e"] = 5;
+    REQUIRE(toJson(doc) == "{\"d\":4,\"e\":5}");
+
+    obj.remove("e");
+    obj.remove("d");
+    REQUIRE(toJson(doc) == "{}");
+  }
+
+  SECTION("removing every other member of a large object") {
+    JsonObject obj = doc.to<JsonObject>();
+    for (int i = 0; i < 1000; i++)
+      obj[std::to_string(i)] = i;
+
+    for (auto it = obj.begin(); it != obj.end(); ++it) {
+      if (it->value().as<int>() % 2 == 0)
+        obj.remove(it);
+    }
+
+    REQUIRE(obj.size() == 500);
+    int expected = 1;
+    for (JsonPair kv : obj) {
+      REQUIRE(kv.value() == expected);
+      expected += 2;
+    }
+  }
+}
@@ -0,0 +1,244 @@
+#define ARDUINOJSON_VERSION_NAMESPACE ArrayIndex
+#define ARDUINOJSON_ENABLE_ARRAY_INDEX 1
+#define ARDUINOJSON_ARRAY_INDEX_THRESHOLD 4
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Allocators.hpp"
+
+static void fill(JsonArray arr, int n) {
+  for (int i = 0; i < n; i++)
+    arr.add(i);
+}
+
+static void checkContent(JsonArray arr, const std::vector<int>& expected) {
+  REQUIRE(arr.size() == expected.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    CAPTURE(i);
+    REQUIRE(arr[i] == expected[i]);
+  }
+  REQUIRE(arr[expected.size()].isNull());
+}
+
+static std::vector<int> range(int n) {
+  std::vector<int> v;
+  for (int i = 0; i < n; i++)
+    v.push_back(i);
+  return v;
+}
+
+TEST_CASE("ARDUINOJSON_ENABLE_ARRAY_INDEX == 1") {
+  JsonDocument doc;
+  JsonArray arr = doc.to<JsonArray>();
+
+  SECTION("small arrays") {
+    fill(arr, 3);
+    checkContent(arr, range(3));
+  }
+
+  SECTION("elements added after the index was built") {
+    fill(arr, 10);
+    checkContent(arr, range(10));
+    arr.add(10);
+    arr.add(11);
+    checkContent(arr, range(12));
+  }
+
+  SECTION("operator[] adds missing elements") {
+    fill(arr, 10);
+    checkContent(arr, range(10));
+    arr[12] = 12;
+    REQUIRE(arr.size() == 13);
+    REQUIRE(arr[10].isNull());
+    REQUIRE(arr[11].isNull());
+    REQUIRE(arr[12] == 12);
+  }
+
+  SECTION("remove(index)") {
+    fill(arr, 10);
+    checkContent(arr, range(10));
+    arr.remove(5);
+    arr.remove(0);
+    arr.remove(7);
+    checkContent(arr, {1, 2, 3, 4, 6, 7, 8});
+    arr.add(10);
+    checkContent(arr, {1, 2, 3, 4, 6, 7, 8, 10});
+  }
+
+  SECTION("remove(index) until empty") {
+    fill(arr, 10);
+    checkContent(arr, range(10));
+    while (arr.size())
+      arr.remove(0);
+    REQUIRE(arr[0].isNull());
+    fill(arr, 5);
+    checkContent(arr, range(5));
+  }
+
+  SECTION("size() doesn't allocate") {
+    SpyingAllocator spy;
+    JsonDocument doc2(&spy);
+    JsonArray arr2 = doc2.to<JsonArray>();
+    fill(arr2, 10);
+    spy.clearLog();
+
+    REQUIRE(arr2.size() == 10);
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("remove(index) in the middle keeps the index") {
+    SpyingAllocator spy;
+    JsonDocument doc2(&spy);
+    JsonArray arr2 = doc2.to<JsonArray>();
+    fill(arr2, 10);
+    checkContent(arr2, range(10));
+    arr2.remove(5);
+    spy.clearLog();
+
+    arr2.remove(5);
+    checkContent(arr2, {0, 1, 2, 3, 4, 7, 8, 9});
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("remove(index) in the middle until one element is left") {
+    SpyingAllocator spy;
+    JsonDocument doc2(&spy);
+    JsonArray arr2 = doc2.to<JsonArray>();
+    fill(arr2, 1000);
+    std::vector<int> expected = range(1000);
+    checkContent(arr2, expected);
+    spy.clearLog();
+
+    while (expected.size() > 1) {
+      size_t i = expected.size() / 2;
+      arr2.remove(i);
+      expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(i));
+      REQUIRE(arr2.size() == expected.size());
+      REQUIRE(arr2[i - 1] == expected[i - 1]);
+    }
+    checkContent(arr2, expected);
+
+    // the index is only rebuilt after it gets compacted, which happens each
+    // time a third of the elements are removed
+    std::string log = "\n" + spy.log().str();
+    size_t rebuilds = 0;
+    for (size_t pos = log.find("\nallocate("); pos != std::string::npos;
+         pos = log.find("\nallocate(", pos + 1))
+      rebuilds++;
+    REQUIRE(rebuilds < 20);
+  }
+
+  SECTION("remove(0) and add() in a loop") {
+    fill(arr, 10);
+    checkContent(arr, range(10));
+    for (int i = 10; i < 100; i++) {
+      arr.remove(0);
+      arr.add(i);
+      REQUIRE(arr.size() == 10);
+      REQUIRE(arr[0] == i - 9);
+      REQUIRE(arr[9] == i);
+    }
+  }
+
+  SECTION("add() after remove(index) in the middle") {
+    fill(arr, 10);
+    checkContent(arr, range(10));
+    arr.remove(3);
+    arr.remove(3);
+    for (int i = 10; i < 30; i++)
+      arr.add(i);
+    std::vector<int> expected = {0, 1, 2, 5, 6, 7, 8, 9};
+    for (int i = 10; i < 30; i++)
+      expected.push_back(i);
+    checkContent(arr, expected);
+  }
+
+  SECTION("remove(iterator)") {
+    fill(arr, 10);
+    checkContent(arr, range(10));
+    for (auto it = arr.begin(); it != arr.end(); ++it) {
+      if (it->as<int>() % 2 == 0)
+        arr.remove(it);
+    }
+    checkContent(arr, {1, 3, 5, 7, 9});
+  }
+
+  SECTION("remove(iterator) keeps the index") {
+    SpyingAllocator spy;
+    JsonDocument doc2(&spy);
+    JsonArray arr2 = doc2.to<JsonArray>();
+    fill(arr2, 10);
+    checkContent(arr2, range(10));
+
+    auto it = arr2.begin();
+    ++it;
+    ++it;
+    arr2.remove(arr2.begin());
+    arr2.remove(it);
+    spy.clearLog();
+
+    checkContent(arr2, {1, 3, 4, 5, 6, 7, 8, 9});
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("remove the last element with an iterator") {
+    fill(arr, 10);
+    checkContent(arr, range(10));
+    JsonArray::iterator last;
+    for (auto it = arr.begin(); it != arr.end(); ++it)
+      last = it;
+    arr.remove(last);
+    checkContent(arr, range(9));
+    arr.add(9);
+    checkContent(arr, range(10));
+  }
+
+  SECTION("clear()") {
+    fill(arr, 10);
+    checkContent(arr, range(10));
+    arr.clear();
+    REQUIRE(arr.size() == 0);
+    fill(arr, 5);
+    checkContent(arr, range(5));
+  }
+
+  SECTION("nested arrays") {
+    for (int i = 0; i < 10; i++)
+      fill(arr.add<JsonArray>(), 10);
+    for (int i = 0; i < 10; i++)
+      checkContent(arr[i], range(10));
+    arr.remove(0);
+    arr[1].to<JsonObject>();
+    REQUIRE(arr.size() == 9);
+    checkContent(arr[0], range(10));
+    for (int i = 2; i < 9; i++)
+      checkContent(arr[i], range(10));
+  }
+
+  SECTION("deserializeJson() with 10k elements") {
+    std::string input = "[";
+    for (int i = 0; i < 10000; i++) {
+      if (i)
+        input += ",";
+      input += std::to_string(i);
+    }
+    input += "]";
+
+    auto err = deserializeJson(doc, input);
+
+    REQUIRE(err == DeserializationError::Ok);
+    checkContent(doc.as<JsonArray>(), range(10000));
+  }
+
+  SECTION("copy of an indexed array") {
+    fill(arr, 10);
+    checkContent(arr, range(10));
+    JsonDocument copy = doc;
+    doc.clear();
+    checkContent(copy.as<JsonArray>(), range(10));
+  }
+}
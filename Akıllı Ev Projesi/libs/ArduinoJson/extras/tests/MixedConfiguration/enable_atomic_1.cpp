@@ -0,0 +1,33 @@
+#define ARDUINOJSON_VERSION_NAMESPACE Atomic
+#define ARDUINOJSON_ENABLE_ATOMIC 1
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+#include <thread>
+#include <vector>
+
+TEST_CASE("ARDUINOJSON_ENABLE_ATOMIC == 1") {
+  JsonDocument doc;
+  for (int i = 0; i < 100; i++)
+    doc.add(i);
+  JsonSharedDocument shared(std::move(doc));
+
+  SECTION("handles can be copied and destroyed on several threads") {
+    std::vector<std::thread> threads;
+    std::vector<long> sums(8);
+    for (size_t t = 0; t < sums.size(); t++) {
+      threads.emplace_back([&sums, shared, t]() {
+        for (int i = 0; i < 100; i++) {
+          JsonSharedDocument copy = shared;
+          sums[t] += copy[i].as<long>();
+        }
+      });
+    }
+    for (auto& thread : threads)
+      thread.join();
+
+    REQUIRE(shared.useCount() == 1);
+    for (long sum : sums)
+      REQUIRE(sum == 4950);
+  }
+}
@@ -0,0 +1,118 @@
+#define ARDUINOJSON_VERSION_NAMESPACE ExactFloatParsing
+#define ARDUINOJSON_ENABLE_EXACT_FLOAT_PARSING 1
+#define ARDUINOJSON_USE_DOUBLE 1
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace ArduinoJson::detail;
+
+static uint64_t bitsOf(double x) {
+  uint64_t bits;
+  memcpy(&bits, &x, sizeof(bits));
+  return bits;
+}
+
+static uint32_t bitsOf(float x) {
+  uint32_t bits;
+  memcpy(&bits, &x, sizeof(bits));
+  return bits;
+}
+
+TEST_CASE("ARDUINOJSON_ENABLE_EXACT_FLOAT_PARSING == 1") {
+  SECTION("doubles are correctly rounded") {
+    // expected values computed with arbitrary precision arithmetic
+    struct TestCase {
+      const char* input;
+      uint64_t expected;
+    };
+
+    TestCase testCases[] = {
+        {"0.1000000000000000055511151231257827", 0x3FB999999999999A},
+        {"3.14159265358979323846264338327950288", 0x400921FB54442D18},
+        {"100000000000000000000000", 0x44B52D02C7E14AF6},
+        {"8.98846567431158e307", 0x7FE0000000000000},
+        {"7.2057594037927933e16", 0x4370000000000000},
+        {"2.2250738585072014e-308", 0x0010000000000000},
+        {"2.2250738585072011e-308", 0x000FFFFFFFFFFFFF},
+        {"4.9406564584124654e-324", 0x0000000000000001},
+        {"2.4703282292062328e-324", 0x0000000000000001},
+        {"2.4703282292062327e-324", 0x0000000000000000},
+        {"2.4703282292062327208828439643e-324", 0x0000000000000000},
+        {"1.7976931348623157e308", 0x7FEFFFFFFFFFFFFF},
+        {"1.7976931348623158e308", 0x7FEFFFFFFFFFFFFF},
+        {"1.7976931348623159e308", 0x7FF0000000000000},
+        {"1e-400", 0x0000000000000000},
+        {"1000e-310", 0x0031FA182C40C60D},
+        {"18446744073709551616", 0x43F0000000000000},
+        {"123456789012345678901234567890", 0x45F8EE90FF6C373E},
+        {"0.000000000000000000000000000000000000000000001e300",
+         0x74E10CB132C2FF63},
+        // halfway between two doubles: round to even
+        {"9007199254740993.00000000000000000000", 0x4340000000000000},
+        {"9007199254740993.0000000000000000000000000001", 0x4340000000000001},
+        {"1.00000000000000011102230246251565404236316680908203124",
+         0x3FF0000000000000},
+        {"1.00000000000000011102230246251565404236316680908203125",
+         0x3FF0000000000000},
+        {"1.00000000000000011102230246251565404236316680908203126",
+         0x3FF0000000000001},
+    };
+
+    for (auto& tc : testCases) {
+      CAPTURE(tc.input);
+      Number number = parseNumber(tc.input);
+      REQUIRE(number.type() == NumberType::Double);
+      REQUIRE(bitsOf(number.asDouble()) == tc.expected);
+    }
+  }
+
+  SECTION("floats are correctly rounded") {
+    struct TestCase {
+      const char* input;
+      uint32_t expected;
+    };
+
+    TestCase testCases[] = {
+        {"0.1", 0x3DCCCCCD},       {"0.3333333", 0x3EAAAAAA},
+        {"3.402823e38", 0x7F7FFFFD}, {"1e23", 0x65A96816},
+        {"1e-38", 0x006CE3EE},     {"-0.0", 0x80000000},
+    };
+
+    for (auto& tc : testCases) {
+      CAPTURE(tc.input);
+      Number number = parseNumber(tc.input);
+      REQUIRE(number.type() == NumberType::Float);
+      REQUIRE(bitsOf(number.asFloat()) == tc.expected);
+    }
+  }
+
+  SECTION("round trip of printf(\"%.17g\")") {
+    uint64_t bits = 0x123456789ABCDEF;
+    for (int i = 0; i < 10000; i++) {
+      bits = bits * 6364136223846793005 + 1442695040888963407;
+      double expected;
+      memcpy(&expected, &bits, sizeof(expected));
+      if (expected != expected || expected - expected != 0)
+        continue;  // skip NaN and infinity
+
+      char input[32];
+      snprintf(input, sizeof(input), "%.17g", expected);
+      CAPTURE(input);
+      REQUIRE(parseNumber<double>(input) == expected);
+    }
+  }
+
+  SECTION("deserializeJson()") {
+    JsonDocument doc;
+    deserializeJson(doc,
+                    "[0.1000000000000000055511151231257827,"
+                    "1.00000000000000011102230246251565404236316680908203126]");
+
+    REQUIRE(bitsOf(doc[0].as<double>()) == 0x3FB999999999999A);
+    REQUIRE(bitsOf(doc[1].as<double>()) == 0x3FF0000000000001);
+  }
+}
@@ -0,0 +1,175 @@
+#define ARDUINOJSON_VERSION_NAMESPACE ObjectIndex
+#define ARDUINOJSON_ENABLE_OBJECT_INDEX 1
+#define ARDUINOJSON_OBJECT_INDEX_THRESHOLD 4
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+#include <string>
+
+#include "Allocators.hpp"
+
+static std::string key(int i) {
+  return "key" + std::to_string(i);
+}
+
+static void fill(JsonObject obj, int n) {
+  for (int i = 0; i < n; i++)
+    obj[key(i)] = i;
+}
+
+static void checkContent(JsonObject obj, int n, int removedModulo = 0) {
+  for (int i = 0; i < n; i++) {
+    bool removed = removedModulo && i % removedModulo == 0;
+    CAPTURE(i);
+    REQUIRE(obj[key(i)].isNull() == removed);
+    if (!removed)
+      REQUIRE(obj[key(i)] == i);
+  }
+}
+
+TEST_CASE("ARDUINOJSON_ENABLE_OBJECT_INDEX == 1") {
+  JsonDocument doc;
+  JsonObject obj = doc.to<JsonObject>();
+
+  SECTION("small objects") {
+    fill(obj, 3);
+    checkContent(obj, 3);
+  }
+
+  SECTION("keys added after the index was built") {
+    fill(obj, 10);
+    checkContent(obj, 10);
+    obj["extra"] = "value";
+    REQUIRE(obj["extra"] == "value");
+    REQUIRE(obj.size() == 11);
+    checkContent(obj, 10);
+  }
+
+  SECTION("operator[] updates existing members") {
+    fill(obj, 10);
+    obj[key(5)] = "five";
+    REQUIRE(obj.size() == 10);
+    REQUIRE(obj[key(5)] == "five");
+  }
+
+  SECTION("remove(key)") {
+    fill(obj, 20);
+    checkContent(obj, 20);
+    for (int i = 0; i < 20; i += 3)
+      obj.remove(key(i));
+    checkContent(obj, 20, 3);
+    REQUIRE(obj.size() == 13);
+  }
+
+  SECTION("remove the first member") {
+    fill(obj, 10);
+    checkContent(obj, 10);
+    obj.remove(key(0));
+    obj.remove(key(1));
+    REQUIRE(obj[key(0)].isNull());
+    REQUIRE(obj[key(1)].isNull());
+    REQUIRE(obj[key(2)] == 2);
+    REQUIRE(obj[key(9)] == 9);
+    obj[key(0)] = 0;
+    REQUIRE(obj[key(0)] == 0);
+  }
+
+  SECTION("remove the last member") {
+    fill(obj, 10);
+    checkContent(obj, 10);
+    obj.remove(key(9));
+    REQUIRE(obj[key(9)].isNull());
+    obj[key(10)] = 10;
+    REQUIRE(obj[key(10)] == 10);
+    REQUIRE(obj[key(8)] == 8);
+  }
+
+  SECTION("removing the last member keeps the index") {
+    SpyingAllocator spy;
+    JsonDocument doc2(&spy);
+    JsonObject obj2 = doc2.to<JsonObject>();
+    fill(obj2, 10);
+    checkContent(obj2, 10);
+
+    for (int i = 9; i >= 5; i--) {
+      obj2.remove(key(i));
+      spy.clearLog();
+      REQUIRE(obj2[key(i)].isNull());
+      REQUIRE(obj2[key(i - 1)] == i - 1);
+      REQUIRE(spy.log() == AllocatorLog{});
+    }
+
+    obj2[key(20)] = 20;
+    checkContent(obj2, 5);
+    REQUIRE(obj2[key(20)] == 20);
+  }
+
+  SECTION("remove(iterator)") {
+    fill(obj, 10);
+    checkContent(obj, 10);
+    for (auto it = obj.begin(); it != obj.end(); ++it) {
+      if (it->value().as<int>() % 2 == 0)
+        obj.remove(it);
+    }
+    checkContent(obj, 10, 2);
+  }
+
+  SECTION("clear()") {
+    fill(obj, 10);
+    checkContent(obj, 10);
+    obj.clear();
+    REQUIRE(obj[key(3)].isNull());
+    fill(obj, 5);
+    checkContent(obj, 5);
+  }
+
+  SECTION("nested objects") {
+    for (int i = 0; i < 10; i++)
+      fill(obj[key(i)].to<JsonObject>(), 10);
+    for (int i = 0; i < 10; i++)
+      checkContent(obj[key(i)], 10);
+    obj.remove(key(0));
+    obj[key(1)].to<JsonArray>();
+    for (int i = 2; i < 10; i++)
+      checkContent(obj[key(i)], 10);
+  }
+
+  SECTION("deserializeJson() with duplicate keys") {
+    std::string input = "{";
+    for (int i = 0; i < 100; i++)
+      input += "\"" + key(i % 50) + "\":" + std::to_string(i) + ",";
+    input += "\"end\":true}";
+
+    auto err = deserializeJson(doc, input);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.size() == 51);
+    for (int i = 0; i < 50; i++)
+      REQUIRE(doc[key(i)] == i + 50);
+    REQUIRE(doc["end"] == true);
+  }
+
+  SECTION("deserializeJson() with 10k keys") {
+    std::string input = "{";
+    for (int i = 0; i < 10000; i++) {
+      if (i)
+        input += ",";
+      input += "\"" + key(i) + "\":" + std::to_string(i);
+    }
+    input += "}";
+
+    auto err = deserializeJson(doc, input);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.size() == 10000);
+    checkContent(doc.as<JsonObject>(), 10000);
+  }
+
+  SECTION("copy of an indexed object") {
+    fill(obj, 10);
+    checkContent(obj, 10);
+    JsonDocument copy = doc;
+    doc.clear();
+    checkContent(copy.as<JsonObject>(), 10);
+  }
+}
@@ -0,0 +1,88 @@
+#define ARDUINOJSON_VERSION_NAMESPACE ShortestFloatFormatting
+#define ARDUINOJSON_ENABLE_SHORTEST_FLOAT_FORMATTING 1
+#define ARDUINOJSON_ENABLE_EXACT_FLOAT_PARSING 1
+#define ARDUINOJSON_ENABLE_NAN 1
+#define ARDUINOJSON_ENABLE_INFINITY 1
+#define ARDUINOJSON_USE_DOUBLE 1
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+#include <limits>
+#include <string.h>
+
+template <typename T>
+static std::string serialize(T value) {
+  JsonDocument doc;
+  doc.set(value);
+  std::string json;
+  serializeJson(doc, json);
+  REQUIRE(measureJson(doc) == json.size());
+  return json;
+}
+
+TEST_CASE("ARDUINOJSON_ENABLE_SHORTEST_FLOAT_FORMATTING == 1") {
+  SECTION("doubles") {
+    CHECK(serialize(0.0) == "0");
+    CHECK(serialize(-0.0) == "0");
+    CHECK(serialize(0.1) == "0.1");
+    CHECK(serialize(0.3) == "0.3");
+    CHECK(serialize(2.0 / 3) == "0.6666666666666666");
+    CHECK(serialize(3.141592653589793) == "3.141592653589793");
+    CHECK(serialize(-123.456) == "-123.456");
+    CHECK(serialize(42.0) == "42");
+    CHECK(serialize(9999999.999) == "9999999.999");
+    CHECK(serialize(1e7) == "1e7");
+    CHECK(serialize(1e23) == "1e23");
+    CHECK(serialize(1.5e300) == "1.5e300");
+    CHECK(serialize(0.0001) == "0.0001");
+    CHECK(serialize(0.000123) == "0.000123");
+    CHECK(serialize(1e-5) == "1e-5");
+    CHECK(serialize(1.7976931348623157e308) == "1.7976931348623157e308");
+    CHECK(serialize(2.2250738585072014e-308) == "2.2250738585072014e-308");
+    CHECK(serialize(4.9406564584124654e-324) == "4.9e-324");
+  }
+
+  SECTION("floats") {
+    CHECK(serialize(0.1f) == "0.1");
+    CHECK(serialize(24.3f) == "24.3");
+    CHECK(serialize(999.9f) == "999.9");
+    CHECK(serialize(3.14159265f) == "3.1415927");
+    CHECK(serialize(3.4028235e38f) == "3.4028235e38");
+    CHECK(serialize(1.17549435e-38f) == "1.1754944e-38");
+  }
+
+  SECTION("special values") {
+    CHECK(serialize(std::numeric_limits<double>::quiet_NaN()) == "NaN");
+    CHECK(serialize(std::numeric_limits<double>::infinity()) == "Infinity");
+    CHECK(serialize(-std::numeric_limits<double>::infinity()) == "-Infinity");
+  }
+
+  SECTION("round trip") {
+    uint64_t bits = 0x123456789ABCDEF;
+    for (int i = 0; i < 10000; i++) {
+      bits = bits * 6364136223846793005 + 1442695040888963407;
+      double expected;
+      memcpy(&expected, &bits, sizeof(expected));
+      if (expected != expected || expected - expected != 0)
+        continue;  // skip NaN and infinity
+
+      JsonDocument doc;
+      doc.add(expected);
+      std::string json;
+      serializeJson(doc, json);
+      CAPTURE(json);
+      deserializeJson(doc, json);
+      REQUIRE(doc[0].as<double>() == expected);
+    }
+  }
+
+  SECTION("serializeJsonPretty()") {
+    JsonDocument doc;
+    doc.add(0.1);
+    doc.add(1e-7);
+    std::string json;
+    serializeJsonPretty(doc, json);
+    REQUIRE(json == "[\r\n  0.1,\r\n  1e-7\r\n]");
+    REQUIRE(measureJsonPretty(doc) == json.size());
+  }
+}
@@ -0,0 +1,25 @@
+#define ARDUINOJSON_VERSION_NAMESPACE LazyDocumentDuplicateKeys
+#define ARDUINOJSON_LAZY_DOCUMENT_DUPLICATE_KEYS 1
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+
+TEST_CASE("ARDUINOJSON_LAZY_DOCUMENT_DUPLICATE_KEYS == 1") {
+  SECTION("duplicate keys return the last value, like deserializeJson()") {
+    const char* json = "{\"a\":1,\"b\":{\"a\":3},\"a\":2,\"c\":4}";
+    JsonLazyDocument doc(json);
+    JsonDocument reference;
+    deserializeJson(reference, json);
+
+    REQUIRE(doc["a"].as<int>() == 2);
+    REQUIRE(doc["a"].as<int>() == reference["a"].as<int>());
+    REQUIRE(doc["a"].as<int>() == 2);  // from the cache
+    REQUIRE(doc["b"]["a"].as<int>() == 3);
+  }
+
+  SECTION("duplicate keys in truncated input") {
+    JsonLazyDocument doc("{\"a\":1,\"a\":2,\"b\":[");
+
+    REQUIRE(doc["a"].as<int>() == 2);
+  }
+}
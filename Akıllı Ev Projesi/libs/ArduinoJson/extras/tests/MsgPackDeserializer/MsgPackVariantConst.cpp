@@ -0,0 +1,206 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+// Compares the view with JsonVariantConst after deserializeMsgPack()
+static void checkSameAsDocument(const std::string& input) {
+  CAPTURE(input);
+  JsonDocument doc;
+  deserializeMsgPack(doc, input);
+  JsonVariantConst expected = doc.as<JsonVariantConst>();
+  MsgPackVariantConst actual(input.data(), input.size());
+
+  CHECK(actual.isNull() == expected.isNull());
+  CHECK(actual.size() == expected.size());
+  CHECK(actual.as<bool>() == expected.as<bool>());
+  CHECK(actual.as<int>() == expected.as<int>());
+  CHECK(actual.as<unsigned char>() == expected.as<unsigned char>());
+  CHECK(actual.as<long long>() == expected.as<long long>());
+  CHECK(actual.as<unsigned long long>() == expected.as<unsigned long long>());
+  CHECK(actual.as<float>() == expected.as<float>());
+  CHECK(actual.as<double>() == expected.as<double>());
+  CHECK(actual.as<std::string>() == expected.as<std::string>());
+
+  CHECK(actual.is<bool>() == expected.is<bool>());
+  CHECK(actual.is<int>() == expected.is<int>());
+  CHECK(actual.is<unsigned char>() == expected.is<unsigned char>());
+  CHECK(actual.is<double>() == expected.is<double>());
+  CHECK(actual.is<JsonString>() == expected.is<JsonString>());
+  CHECK(actual.is<std::string>() == expected.is<std::string>());
+  CHECK(actual.is<JsonArrayConst>() == expected.is<JsonArrayConst>());
+  CHECK(actual.is<JsonObjectConst>() == expected.is<JsonObjectConst>());
+  CHECK(actual.is<MsgPackBinary>() == expected.is<MsgPackBinary>());
+  CHECK(actual.is<MsgPackExtension>() == expected.is<MsgPackExtension>());
+}
+
+#define INPUT(s) std::string(s, sizeof(s) - 1)
+
+TEST_CASE("MsgPackVariantConst") {
+  SECTION("same conversions as JsonVariantConst") {
+    const std::string inputs[] = {
+        INPUT("\xc0"),                                  // nil
+        INPUT("\xc2"),                                  // false
+        INPUT("\xc3"),                                  // true
+        INPUT("\x00"),                                  // 0
+        INPUT("\x7f"),                                  // 127
+        INPUT("\xe0"),                                  // -32
+        INPUT("\xcc\xff"),                              // uint 8
+        INPUT("\xcd\x30\x39"),                          // uint 16
+        INPUT("\xce\x12\x34\x56\x78"),                  // uint 32
+        INPUT("\xcf\x12\x34\x56\x78\x9a\xbc\xde\xf0"),  // uint 64
+        INPUT("\xcf\xff\xff\xff\xff\xff\xff\xff\xff"),  // uint 64
+        INPUT("\xd0\x80"),                              // int 8
+        INPUT("\xd1\xcf\xc7"),                          // int 16
+        INPUT("\xd2\xb6\x69\xfd\x2e"),                  // int 32
+        INPUT("\xd3\x80\x00\x00\x00\x00\x00\x00\x00"),  // int 64
+        INPUT("\xca\x40\x49\x0f\xdb"),                  // float 32
+        INPUT("\xcb\x40\x09\x21\xfb\x54\x44\x2d\x18"),  // float 64
+        INPUT("\xcb\x3f\xf8\x00\x00\x00\x00\x00\x00"),  // float 64 (1.5)
+        INPUT("\xa0"),                                  // ""
+        INPUT("\xa5hello"),                             // fixstr
+        INPUT("\xa3" "-42"),                            // numeric string
+        INPUT("\xa4" "3.25"),                           // numeric string
+        INPUT("\xd9\x05world"),                         // str 8
+        INPUT("\xc4\x03\x01\x02\x03"),                  // bin 8
+        INPUT("\xd6\x01\x01\x02\x03\x04"),              // fixext 4
+        INPUT("\x93\x01\x02\x03"),                      // fixarray
+        INPUT("\xdc\x00\x02\xa1" "a\xc3"),              // array 16
+        INPUT("\x82\xa3one\x01\xa3two\x02"),            // fixmap
+        INPUT("\xde\x00\x01\xa1x\x92\x01\xa1y"),        // map 16
+        INPUT("\xc1"),                                  // reserved
+        INPUT("\xcd\x30"),                              // truncated
+        INPUT(""),                                      // empty
+    };
+
+    for (auto& input : inputs)
+      checkSameAsDocument(input);
+  }
+
+  SECTION("unbound") {
+    MsgPackVariantConst variant;
+
+    REQUIRE(variant.isNull());
+    REQUIRE(variant.size() == 0);
+    REQUIRE(variant[0].isNull());
+    REQUIRE(variant["key"].isNull());
+    REQUIRE(variant.as<int>() == 0);
+    REQUIRE(variant.as<JsonString>().isNull());
+  }
+
+  SECTION("nested values") {
+    // {"name":"sensor","values":[1,2.5,"three"],"info":{"ok":true}}
+    const char input[] =
+        "\x83\xa4name\xa6sensor\xa6values\x93\x01\xcb\x40\x04\x00\x00\x00\x00"
+        "\x00\x00\xa5three\xa4info\x81\xa2ok\xc3";
+    MsgPackVariantConst root(input, sizeof(input) - 1);
+
+    REQUIRE(root.size() == 3);
+    REQUIRE(root["name"].as<std::string>() == "sensor");
+    REQUIRE(root["values"].size() == 3);
+    REQUIRE(root["values"][0].as<int>() == 1);
+    REQUIRE(root["values"][1].as<double>() == 2.5);
+    REQUIRE(root["values"][2].as<std::string>() == "three");
+    REQUIRE(root["values"][3].isNull());
+    REQUIRE(root["info"]["ok"].as<bool>() == true);
+    REQUIRE(root["missing"].isNull());
+    REQUIRE(root[0].isNull());
+    REQUIRE(root["values"]["name"].isNull());
+    REQUIRE(root.encodedSize() == sizeof(input) - 1);
+    REQUIRE(root["values"].encodedSize() == 17);
+
+    std::string key = "info";
+    REQUIRE(root[key]["ok"].is<bool>());
+
+    char buffer[] = "name";
+    REQUIRE(root[buffer].as<std::string>() == "sensor");
+
+    int value = root["values"][0];
+    REQUIRE(value == 1);
+  }
+
+  SECTION("strings point to the input") {
+    const char input[] = "\x91\xa5hello";
+    MsgPackVariantConst root(input, sizeof(input) - 1);
+
+    JsonString str = root[0].as<JsonString>();
+
+    REQUIRE(str == "hello");
+    REQUIRE(str.c_str() == input + 2);
+    REQUIRE(str.size() == 5);
+  }
+
+  SECTION("binaries point to the input") {
+    const char input[] = "\xc4\x03\x01\x02\x03";
+    MsgPackVariantConst root(input, sizeof(input) - 1);
+
+    auto binary = root.as<MsgPackBinary>();
+
+    REQUIRE(binary.data() == input + 2);
+    REQUIRE(binary.size() == 3);
+    REQUIRE(root.as<MsgPackExtension>().data() == nullptr);
+  }
+
+  SECTION("extensions point to the input") {
+    const char input[] = "\xc7\x02\x05\x01\x02";
+    MsgPackVariantConst root(input, sizeof(input) - 1);
+
+    auto extension = root.as<MsgPackExtension>();
+
+    REQUIRE(extension.type() == 5);
+    REQUIRE(extension.data() == input + 3);
+    REQUIRE(extension.size() == 2);
+  }
+
+  SECTION("duplicate keys return the first value") {
+    const char input[] = "\x82\xa1" "a\x01\xa1" "a\x02";
+    MsgPackVariantConst root(input, sizeof(input) - 1);
+
+    REQUIRE(root["a"].as<int>() == 1);
+  }
+
+  SECTION("non-string keys") {
+    const char input[] = "\x81\x01\x02";
+    MsgPackVariantConst root(input, sizeof(input) - 1);
+
+    REQUIRE(root["1"].isNull());
+  }
+
+  SECTION("truncated containers") {
+    // the size says 3 elements, but there are only 2
+    const char input[] = "\x93\x01\x02";
+    MsgPackVariantConst root(input, sizeof(input) - 1);
+
+    REQUIRE(root.isNull());
+    REQUIRE(root.size() == 0);
+    REQUIRE(root[0].isNull());
+    REQUIRE(root.encodedSize() == 0);
+  }
+
+  SECTION("truncated element") {
+    // the first string says 5 bytes, but there are only 4
+    const char input[] = "\x92\xa5" "abcd";
+    MsgPackVariantConst root(input, sizeof(input) - 1);
+
+    REQUIRE(root.size() == 2);
+    REQUIRE(root[0].isNull());
+    REQUIRE(root[1].isNull());
+  }
+
+  SECTION("deep nesting") {
+    // 100 nested arrays are beyond the nesting limit of deserializeMsgPack(),
+    // but the view doesn't recurse
+    std::string input(100, '\x91');
+    input += '\x2a';
+    MsgPackVariantConst variant(input.data(), input.size());
+
+    for (int i = 0; i < 100; i++)
+      variant = variant[0];
+
+    REQUIRE(variant.as<int>() == 42);
+  }
+}
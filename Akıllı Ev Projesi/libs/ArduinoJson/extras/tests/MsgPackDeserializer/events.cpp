@@ -0,0 +1,133 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <sstream>
+#include <string>
+
+#include "Literals.hpp"
+
+// Writes the events in a compact form, and skips the keys that start with '_'
+class EventLogger {
+ public:
+  bool startObject() {
+    log += "{";
+    return !skipCollections;
+  }
+
+  void endObject() {
+    log += "}";
+  }
+
+  bool startArray() {
+    log += "[";
+    return !skipCollections;
+  }
+
+  void endArray() {
+    log += "]";
+  }
+
+  bool key(JsonString key) {
+    log += std::string(key.c_str(), key.size());
+    log += ":";
+    return key.c_str()[0] != '_';
+  }
+
+  void value(JsonVariantConst value) {
+    if (value.is<MsgPackBinary>())
+      log += "bin" + std::to_string(value.as<MsgPackBinary>().size());
+    else
+      log += value.as<std::string>();
+    log += ",";
+  }
+
+  std::string log;
+  bool skipCollections = false;
+};
+
+TEST_CASE("deserializeMsgPackEvents()") {
+  EventLogger handler;
+
+  SECTION("values") {
+    auto err = deserializeMsgPackEvents(handler,
+                                        "\x98\xC0\xC3\xC2\x2A\xD0\xFF"
+                                        "\xCB\xBF\xF8\x00\x00\x00\x00\x00\x00"
+                                        "\xA5hello\xC4\x02\x01\x02"_s);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(handler.log == "[null,true,false,42,-1,-1.5,hello,bin2,]");
+  }
+
+  SECTION("nested") {
+    // {"a":{"b":[1,{}],"c":[]},"d":2}
+    auto err = deserializeMsgPackEvents(handler,
+                                        "\x82\xA1" "a\x82\xA1" "b\x92\x01\x80"
+                                        "\xA1" "c\x90\xA1" "d\x02");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(handler.log == "{a:{b:[1,{}]c:[]}d:2,}");
+  }
+
+  SECTION("16 and 32-bit sizes") {
+    auto err = deserializeMsgPackEvents(
+        handler, "\xDC\x00\x02\xDE\x00\x01\xA1x\xA2yz\xDD\x00\x00\x00\x00"_s);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(handler.log == "[{x:yz,}[]]");
+  }
+
+  SECTION("key() skips the value") {
+    // {"_a":{"b":[1,"]"]},"c":3,"_d":"x"}
+    auto err = deserializeMsgPackEvents(
+        handler, "\x83\xA2_a\x81\xA1" "b\x92\x01\xA1]\xA1" "c\x03\xA2_d\xA1x");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(handler.log == "{_a:c:3,_d:}");
+  }
+
+  SECTION("startArray() skips the array") {
+    handler.skipCollections = true;
+    auto err = deserializeMsgPackEvents(handler, "\x93\x01\x92\x02\x03\x81\xA1"
+                                                 "a\x04\x05");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(handler.log == "[");
+  }
+
+  SECTION("input types") {
+    std::istringstream stream("\x91\x01");
+    REQUIRE(deserializeMsgPackEvents(handler, stream) ==
+            DeserializationError::Ok);
+    REQUIRE(deserializeMsgPackEvents(handler, "\x91\x02"_s) ==
+            DeserializationError::Ok);
+    REQUIRE(deserializeMsgPackEvents(handler, "\x91\x03\x04", 2) ==
+            DeserializationError::Ok);
+    REQUIRE(handler.log == "[1,][2,][3,]");
+  }
+
+  SECTION("errors") {
+    REQUIRE(deserializeMsgPackEvents(handler, "", 0) ==
+            DeserializationError::EmptyInput);
+    REQUIRE(deserializeMsgPackEvents(handler, "\x92\x01", 2) ==
+            DeserializationError::IncompleteInput);
+    REQUIRE(deserializeMsgPackEvents(handler, "\x81\x01\x02", 3) ==
+            DeserializationError::InvalidInput);
+    REQUIRE(deserializeMsgPackEvents(handler, "\x91\xC1", 2) ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("nesting limit") {
+    DeserializationOption::NestingLimit nesting(1);
+
+    REQUIRE(deserializeMsgPackEvents(handler, "\x91\x01", nesting) ==
+            DeserializationError::Ok);
+    REQUIRE(deserializeMsgPackEvents(handler, "\x91\x91\x01", nesting) ==
+            DeserializationError::TooDeep);
+    REQUIRE(deserializeMsgPackEvents(handler, "\x81\xA2_a\x91\x01", nesting) ==
+            DeserializationError::TooDeep);
+  }
+}
@@ -1536,6 +1536,33 @@ TEST_CASE("Zero-copy mode") {  // issue #1697
   CHECK(doc.as<std::string>() == "{\"include\":1}");
 }
 
+TEST_CASE("deserializeMsgPack() compiled filter") {
+  JsonDocument filter;
+  filter["include"] = true;
+  filter["list"][0]["id"] = true;
+  filter["nested"]["*"]["keep"] = true;
+  DeserializationOption::CompiledFilter compiled = compileFilter(filter);
+
+  // {"ignore":1,"include":{"a":[1]},"list":[{"id":1,"x":2},{"id":3}],
+  //  "nested":{"a":{"keep":4,"drop":5},"b":6}}
+  const char input[] =
+      "\x84\xA6ignore\x01\xA7include\x81\xA1" "a\x91\x01\xA4list\x92\x82\xA2id"
+      "\x01\xA1x\x02\x81\xA2id\x03\xA6nested\x82\xA1" "a\x82\xA4keep\x04\xA4"
+      "drop\x05\xA1" "b\x06";
+
+  JsonDocument expected, actual;
+  REQUIRE(deserializeMsgPack(expected, input, sizeof(input) - 1,
+                             DeserializationOption::Filter(filter)) ==
+          DeserializationError::Ok);
+  REQUIRE(deserializeMsgPack(actual, input, sizeof(input) - 1, compiled) ==
+          DeserializationError::Ok);
+
+  REQUIRE(actual.as<std::string>() == expected.as<std::string>());
+  REQUIRE(actual.as<std::string>() ==
+          "{\"include\":{\"a\":[1]},\"list\":[{\"id\":1},{\"id\":3}],"
+          "\"nested\":{\"a\":{\"keep\":4},\"b\":null}}");
+}
+
 TEST_CASE("Overloads") {
   JsonDocument doc;
   JsonDocument filter;
@@ -1625,4 +1652,20 @@ TEST_CASE("Overloads") {
     deserializeMsgPack(doc, vla, NestingLimit(5), Filter(filter));
   }
 #endif
+
+  // deserializeMsgPack(..., CompiledFilter)
+
+  SECTION("const char*, CompiledFilter") {
+    deserializeMsgPack(doc, "{}", compileFilter(filter));
+  }
+
+  SECTION("const char*, size_t, CompiledFilter, NestingLimit") {
+    CompiledFilter compiled = compileFilter(filter);
+    deserializeMsgPack(doc, "{}", 2, compiled, NestingLimit(5));
+  }
+
+  SECTION("std::istream&, NestingLimit, CompiledFilter") {
+    std::stringstream s("{}");
+    deserializeMsgPack(doc, s, NestingLimit(5), compileFilter(filter));
+  }
 }
@@ -69,6 +69,20 @@ TEST_CASE("deserializeMsgPack(std::istream&)") {
 
     REQUIRE(err == DeserializationError::IncompleteInput);
   }
+
+  SECTION("concatenated documents") {
+    std::istringstream input(
+        "\x92\x01\x02\xA3"
+        "abc\x2A");
+
+    REQUIRE(deserializeMsgPack(doc, input) == DeserializationError::Ok);
+    REQUIRE(doc[1] == 2);
+    REQUIRE(deserializeMsgPack(doc, input) == DeserializationError::Ok);
+    REQUIRE(doc == "abc");
+    REQUIRE(deserializeMsgPack(doc, input) == DeserializationError::Ok);
+    REQUIRE(doc == 42);
+    REQUIRE(deserializeMsgPack(doc, input) == DeserializationError::EmptyInput);
+  }
 }
 
 #ifdef HAS_VARIABLE_LENGTH_ARRAY
@@ -0,0 +1,68 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+static std::string readInChunks(JsonVariantConst source, size_t chunkSize) {
+  MsgPackSerializationCursor cursor(source);
+  std::string result;
+  char buffer[1000];
+  while (size_t n = cursor.read(buffer, chunkSize)) {
+    REQUIRE(n <= chunkSize);
+    result.append(buffer, n);
+  }
+  REQUIRE(cursor.done());
+  return result;
+}
+
+TEST_CASE("MsgPackSerializationCursor") {
+  JsonDocument doc;
+
+  SECTION("same output as serializeMsgPack() for any chunk size") {
+    const char* inputs[] = {
+        "null",
+        "true",
+        "42",
+        "-3.14",
+        "123456789",
+        "\"hello\"",
+        "[]",
+        "{}",
+        "[1,2.5,\"three\",[true,false],null]",
+        "{\"a\":{\"b\":[1,{\"c\":\"d\"}]},\"e\":[],\"f\":{}}",
+        "[0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16]",
+    };
+
+    for (auto input : inputs) {
+      REQUIRE(deserializeJson(doc, input) == DeserializationError::Ok);
+      std::string expected;
+      serializeMsgPack(doc, expected);
+
+      for (size_t chunkSize : {1u, 2u, 3u, 7u, 1000u}) {
+        CAPTURE(input);
+        CAPTURE(chunkSize);
+        REQUIRE(readInChunks(doc, chunkSize) == expected);
+      }
+    }
+  }
+
+  SECTION("strings that span several chunks") {
+    doc["key"] = std::string(300, 'x');
+    std::string expected;
+    serializeMsgPack(doc, expected);
+
+    REQUIRE(readInChunks(doc, 7) == expected);
+  }
+
+  SECTION("raw strings that span several chunks") {
+    doc[0] = serialized(std::string(100, '\xC0'));
+    std::string expected;
+    serializeMsgPack(doc, expected);
+
+    REQUIRE(readInChunks(doc, 7) == expected);
+  }
+}
@@ -24,6 +24,7 @@ TEST_CASE("Test unsigned integer overflow") {
 
   REQUIRE(first.type() == NumberType::UnsignedInteger);
   REQUIRE(second.type() == NumberType::Double);
+  REQUIRE(second.asDouble() == Approx(first.convertTo<double>()));
 }
 
 TEST_CASE("Test signed integer overflow") {
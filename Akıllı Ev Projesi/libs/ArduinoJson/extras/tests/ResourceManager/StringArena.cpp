@@ -0,0 +1,85 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson/Memory/ResourceManager.hpp>
+#include <ArduinoJson/Memory/ResourceManagerImpl.hpp>
+#include <catch.hpp>
+
+#include <string>
+
+#include "Allocators.hpp"
+
+using namespace ArduinoJson::detail;
+using ArduinoJson::Allocator;
+
+static StringNode* createString(const char* s, Allocator* allocator) {
+  auto node = StringNode::create(strlen(s), allocator);
+  memcpy(node->data, s, node->length + 1);
+  return node;
+}
+
+static std::string content(const StringNode* node) {
+  return std::string(node->data, node->length);
+}
+
+TEST_CASE("StringArena") {
+  SpyingAllocator spy;
+  StringArena arena(&spy);
+  REQUIRE(arena.resize(256));
+  spy.clearLog();
+
+  SECTION("grows the most recent string in place") {
+    auto a = createString("hello", &arena);
+    auto b = StringNode::resize(a, 20, &arena);
+
+    REQUIRE(b == a);
+    REQUIRE(content(b).substr(0, 5) == "hello");
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("grows another string without touching its neighbors") {
+    auto a = createString("hello", &arena);
+    auto b = createString("world", &arena);
+
+    auto c = StringNode::resize(a, 20, &arena);
+
+    REQUIRE(c != a);
+    REQUIRE(content(c).substr(0, 5) == "hello");
+    REQUIRE(content(b) == "world");
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("grows a string beyond the end of the arena") {
+    auto a = createString("hello", &arena);
+    auto b = StringNode::resize(a, 300, &arena);
+
+    REQUIRE(content(b).substr(0, 5) == "hello");
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofString(300)),
+                         });
+
+    StringNode::destroy(b, &arena);
+  }
+
+  arena.release();
+}
+
+TEST_CASE("ResourceManager::reserve()") {
+  KillswitchAllocator killswitch;
+  ResourceManager resources(&killswitch);
+
+  SECTION("keeps the capacity on success") {
+    REQUIRE(resources.reserve(4, 100) == true);
+
+    REQUIRE(resources.keepsCapacity() == true);
+  }
+
+  SECTION("doesn't keep the capacity when the allocation fails") {
+    killswitch.on();
+
+    REQUIRE(resources.reserve(4, 100) == false);
+
+    REQUIRE(resources.keepsCapacity() == false);
+  }
+}
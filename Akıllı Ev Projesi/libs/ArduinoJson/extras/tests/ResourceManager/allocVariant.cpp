@@ -9,6 +9,39 @@
 
 using namespace ArduinoJson::detail;
 
+namespace {
+class LargeBlockFailingAllocator : public ArduinoJson::Allocator {
+ public:
+  LargeBlockFailingAllocator(size_t maxSize) : maxSize_(maxSize) {}
+  virtual ~LargeBlockFailingAllocator() {}
+
+  void* allocate(size_t n) override {
+    if (n > maxSize_) {
+      failures++;
+      return nullptr;
+    }
+    return DefaultAllocator::instance()->allocate(n);
+  }
+
+  void deallocate(void* p) override {
+    DefaultAllocator::instance()->deallocate(p);
+  }
+
+  void* reallocate(void* p, size_t n) override {
+    if (n > maxSize_) {
+      failures++;
+      return nullptr;
+    }
+    return DefaultAllocator::instance()->reallocate(p, n);
+  }
+
+  int failures = 0;
+
+ private:
+  size_t maxSize_;
+};
+}  // namespace
+
 TEST_CASE("ResourceManager::allocVariant()") {
   SECTION("Returns different pointer") {
     ResourceManager resources;
@@ -89,4 +122,23 @@ TEST_CASE("ResourceManager::allocVariant()") {
 
     REQUIRE(resources.overflowed() == true);
   }
+
+  SECTION("Pools don't grow above ARDUINOJSON_MAX_POOL_CAPACITY") {
+    // fails the allocation of a pool of 128 slots
+    LargeBlockFailingAllocator allocator(sizeofPool(64));
+    ResourceManager resources(&allocator);
+
+    // this test assumes SlotId is 8-bit and pools have 16 to 64 slots
+    REQUIRE(NULL_SLOT == 255);
+
+    for (SlotId i = 0; i < NULL_SLOT; i++) {
+      auto slot = resources.allocVariant();
+      REQUIRE(slot.id() == i);
+      REQUIRE(slot.ptr() != nullptr);
+      REQUIRE(resources.getVariant(i) == slot.ptr());
+    }
+
+    REQUIRE(allocator.failures == 0);
+    REQUIRE(resources.overflowed() == false);
+  }
 }
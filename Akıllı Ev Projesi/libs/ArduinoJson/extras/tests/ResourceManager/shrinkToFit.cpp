@@ -33,15 +33,21 @@ TEST_CASE("ResourceManager::shrinkToFit()") {
   }
 
   SECTION("more pools than initial count") {
-    for (size_t i = 0;
-         i < ARDUINOJSON_POOL_CAPACITY * ARDUINOJSON_INITIAL_POOL_COUNT + 1;
-         i++)
+    // the pools are twice as big as the previous ones, except the second one
+    size_t preallocatedSlots = ARDUINOJSON_POOL_CAPACITY
+                               << (ARDUINOJSON_INITIAL_POOL_COUNT - 1);
+    // then they stop growing
+    SlotCount lastPoolCapacity = ARDUINOJSON_MAX_POOL_CAPACITY;
+
+    for (size_t i = 0; i < preallocatedSlots + 1; i++)
       resources.allocVariant();
     REQUIRE(spyingAllocator.log() ==
             AllocatorLog{
-                Allocate(sizeofPool()) * ARDUINOJSON_INITIAL_POOL_COUNT,
-                Allocate(sizeofPoolList(ARDUINOJSON_INITIAL_POOL_COUNT * 2)),
-                Allocate(sizeofPool()),
+                Allocate(sizeofPool()) * 2,
+                Allocate(sizeofPool(ARDUINOJSON_POOL_CAPACITY * 2)),
+                Allocate(sizeofPool(ARDUINOJSON_POOL_CAPACITY * 4)),
+                Allocate(sizeofPoolList(MemoryPoolList<VariantData>::maxPools)),
+                Allocate(sizeofPool(lastPoolCapacity)),
             });
 
     spyingAllocator.clearLog();
@@ -49,9 +55,10 @@ TEST_CASE("ResourceManager::shrinkToFit()") {
 
     REQUIRE(spyingAllocator.log() ==
             AllocatorLog{
-                Reallocate(sizeofPool(), sizeofPool(1)),
-                Reallocate(sizeofPoolList(ARDUINOJSON_INITIAL_POOL_COUNT * 2),
-                           sizeofPoolList(ARDUINOJSON_INITIAL_POOL_COUNT + 1)),
+                Reallocate(sizeofPool(lastPoolCapacity), sizeofPool(1)),
+                Reallocate(
+                    sizeofPoolList(MemoryPoolList<VariantData>::maxPools),
+                    sizeofPoolList(ARDUINOJSON_INITIAL_POOL_COUNT + 1)),
             });
   }
 }
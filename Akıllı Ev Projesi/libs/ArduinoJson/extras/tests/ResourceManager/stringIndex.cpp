@@ -0,0 +1,165 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#define ARDUINOJSON_VERSION_NAMESPACE StringIndex
+#define ARDUINOJSON_ENABLE_STRING_INDEX 1
+#include <ArduinoJson/Memory/ResourceManager.hpp>
+#include <ArduinoJson/Memory/StringBuilder.hpp>
+#include <ArduinoJson/Strings/StringAdapters.hpp>
+#include <catch.hpp>
+
+#include <string>
+#include <vector>
+
+#include "Allocators.hpp"
+
+using namespace ArduinoJson::detail;
+
+static StringNode* saveString(ResourceManager& resources, const char* s) {
+  return resources.saveString(adaptString(s));
+}
+
+static StringNode* saveString(ResourceManager& resources, const char* s,
+                              size_t n) {
+  return resources.saveString(adaptString(s, n));
+}
+
+static std::string numbered(size_t i) {
+  return "string #" + std::to_string(i);
+}
+
+TEST_CASE("ARDUINOJSON_ENABLE_STRING_INDEX == 1") {
+  SpyingAllocator spy;
+  ResourceManager resources(&spy);
+
+  SECTION("Duplicates different strings") {
+    auto a = saveString(resources, "hello");
+    auto b = saveString(resources, "world");
+    REQUIRE(+a->data != +b->data);
+    REQUIRE(a->references == 1);
+    REQUIRE(b->references == 1);
+    REQUIRE(resources.size() == sizeofString("hello") + sizeofString("world"));
+  }
+
+  SECTION("Deduplicates identical strings") {
+    auto a = saveString(resources, "hello");
+    auto b = saveString(resources, "hello");
+    REQUIRE(a == b);
+    REQUIRE(a->references == 2);
+    REQUIRE(resources.size() == sizeofString("hello"));
+  }
+
+  SECTION("Deduplicates identical strings that contain NUL") {
+    auto a = saveString(resources, "hello\0world", 11);
+    auto b = saveString(resources, "hello\0world", 11);
+    REQUIRE(a == b);
+    REQUIRE(a->references == 2);
+  }
+
+  SECTION("Don't stop on first NUL") {
+    auto a = saveString(resources, "hello");
+    auto b = saveString(resources, "hello\0world", 11);
+    REQUIRE(a != b);
+  }
+
+  SECTION("getString() finds the strings saved by StringBuilder") {
+    StringBuilder builder(&resources);
+    VariantData a, b;
+
+    builder.startString();
+    builder.append("hello");
+    builder.save(&a);
+    builder.startString();
+    builder.append("hello");
+    builder.save(&b);
+
+    REQUIRE(+a.asString().c_str() == +b.asString().c_str());
+    REQUIRE(resources.getString(adaptString("hello"))->references == 2);
+  }
+
+  SECTION("Handles thousands of strings") {
+    const size_t n = 5000;
+    std::vector<StringNode*> nodes;
+    for (size_t i = 0; i < n; i++)
+      nodes.push_back(saveString(resources, numbered(i).c_str()));
+
+    for (size_t i = 0; i < n; i++) {
+      REQUIRE(saveString(resources, numbered(i).c_str()) == nodes[i]);
+      REQUIRE(nodes[i]->references == 2);
+    }
+
+    // release even strings
+    for (size_t i = 0; i < n; i += 2) {
+      resources.dereferenceString(nodes[i]);
+      resources.dereferenceString(nodes[i]);
+    }
+
+    for (size_t i = 0; i < n; i++) {
+      auto node = resources.getString(adaptString(numbered(i)));
+      if (i % 2)
+        REQUIRE(node == nodes[i]);
+      else
+        REQUIRE(node == nullptr);
+    }
+  }
+
+  SECTION("dereferenceString() destroys the string when unused") {
+    auto a = saveString(resources, "hello");
+    saveString(resources, "hello");
+    spy.clearLog();
+
+    resources.dereferenceString(a);
+    REQUIRE(spy.log() == AllocatorLog{});
+    REQUIRE(resources.size() == sizeofString("hello"));
+
+    resources.dereferenceString(a);
+    REQUIRE(spy.log() == AllocatorLog{
+                             Deallocate(sizeofString("hello")),
+                         });
+    REQUIRE(resources.size() == 0);
+    REQUIRE(resources.getString(adaptString("hello")) == nullptr);
+  }
+
+  SECTION("clear() releases strings and index") {
+    saveString(resources, "hello");
+    saveString(resources, "world");
+
+    resources.clear();
+
+    REQUIRE(resources.size() == 0);
+    REQUIRE(spy.allocatedBytes() == 0);
+  }
+
+  SECTION("swap() exchanges indexes") {
+    ResourceManager other(&spy);
+    auto a = saveString(resources, "hello");
+
+    swap(resources, other);
+
+    REQUIRE(resources.getString(adaptString("hello")) == nullptr);
+    REQUIRE(other.getString(adaptString("hello")) == a);
+  }
+}
+
+TEST_CASE("ARDUINOJSON_ENABLE_STRING_INDEX == 1 without memory for the index") {
+  TimebombAllocator timebomb(0);
+  ResourceManager resources(&timebomb);
+
+  SECTION("Falls back to the linked list") {
+    timebomb.setCountdown(1);  // allocate the string, but not the index
+    auto a = saveString(resources, "hello");
+    timebomb.setCountdown(1);
+    auto b = saveString(resources, "world");
+
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+    REQUIRE(saveString(resources, "hello") == a);
+    REQUIRE(a->references == 2);
+    REQUIRE(resources.size() == sizeofString("hello") + sizeofString("world"));
+
+    resources.dereferenceString(b);
+    REQUIRE(resources.getString(adaptString("world")) == nullptr);
+    REQUIRE(resources.size() == sizeofString("hello"));
+  }
+}
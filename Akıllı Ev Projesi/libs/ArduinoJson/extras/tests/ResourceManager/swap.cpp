@@ -11,9 +11,12 @@
 
 using namespace ArduinoJson::detail;
 
+// the pools are twice as big as the previous ones, except the second one
+static const size_t preallocatedSlots = ARDUINOJSON_POOL_CAPACITY
+                                        << (ARDUINOJSON_INITIAL_POOL_COUNT - 1);
+
 static void fullPreallocatedPools(ResourceManager& resources) {
-  for (int i = 0;
-       i < ARDUINOJSON_INITIAL_POOL_COUNT * ARDUINOJSON_POOL_CAPACITY; i++)
+  for (size_t i = 0; i < preallocatedSlots; i++)
     resources.allocVariant();
 }
 
@@ -51,9 +54,12 @@ TEST_CASE("ResourceManager::swap()") {
 
     REQUIRE(spy.log() ==
             AllocatorLog{
-                Allocate(sizeofPool()) * (ARDUINOJSON_INITIAL_POOL_COUNT + 1),
-                Allocate(sizeofPoolList(ARDUINOJSON_INITIAL_POOL_COUNT * 2)),
+                Allocate(sizeofPool()) * 2,
+                Allocate(sizeofPool(ARDUINOJSON_POOL_CAPACITY * 2)),
+                Allocate(sizeofPool(ARDUINOJSON_POOL_CAPACITY * 4)),
                 Allocate(sizeofPool()),
+                Allocate(sizeofPoolList(MemoryPoolList<VariantData>::maxPools)),
+                Allocate(sizeofPool(ARDUINOJSON_MAX_POOL_CAPACITY)),
             });
   }
 
@@ -72,9 +78,12 @@ TEST_CASE("ResourceManager::swap()") {
 
     REQUIRE(spy.log() ==
             AllocatorLog{
-                Allocate(sizeofPool()) * ARDUINOJSON_INITIAL_POOL_COUNT,
-                Allocate(sizeofPoolList(ARDUINOJSON_INITIAL_POOL_COUNT * 2)),
                 Allocate(sizeofPool()) * 2,
+                Allocate(sizeofPool(ARDUINOJSON_POOL_CAPACITY * 2)),
+                Allocate(sizeofPool(ARDUINOJSON_POOL_CAPACITY * 4)),
+                Allocate(sizeofPoolList(MemoryPoolList<VariantData>::maxPools)),
+                Allocate(sizeofPool(ARDUINOJSON_MAX_POOL_CAPACITY)),
+                Allocate(sizeofPool()),
             });
   }
 
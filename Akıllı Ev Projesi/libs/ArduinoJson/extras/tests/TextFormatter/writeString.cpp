@@ -7,6 +7,8 @@
 #include <ArduinoJson/Json/TextFormatter.hpp>
 #include <ArduinoJson/Serialization/Writers/StaticStringWriter.hpp>
 
+#include <string>
+
 using namespace ArduinoJson::detail;
 
 void check(const char* input, std::string expected) {
@@ -18,6 +20,22 @@ void check(const char* input, std::string expected) {
   REQUIRE(writer.bytesWritten() == expected.size());
 }
 
+// Records each call to write()
+class SpyingWriter {
+ public:
+  size_t write(uint8_t c) {
+    log += "[" + std::string(1, char(c)) + "]";
+    return 1;
+  }
+
+  size_t write(const uint8_t* s, size_t n) {
+    log += "[" + std::string(reinterpret_cast<const char*>(s), n) + "]";
+    return n;
+  }
+
+  std::string log;
+};
+
 TEST_CASE("TextFormatter::writeString()") {
   SECTION("EmptyString") {
     check("", "\"\"");
@@ -54,4 +72,27 @@ TEST_CASE("TextFormatter::writeString()") {
   SECTION("HorizontalTab") {
     check("\t", "\"\\t\"");
   }
+
+  SECTION("Mixed") {
+    check("hello\tworld\n", "\"hello\\tworld\\n\"");
+  }
+
+  SECTION("Control characters without escape sequence") {
+    check("\x01\x1f", "\"\x01\x1f\"");
+  }
+
+  SECTION("Writes runs of regular characters at once") {
+    SpyingWriter spy;
+    TextFormatter<SpyingWriter&> writer(spy);
+    writer.writeString("hello \"world\"!");
+    REQUIRE(spy.log == "[\"][hello ][\\][\"][world][\\][\"][!][\"]");
+  }
+
+  SECTION("Sized string with NUL") {
+    SpyingWriter spy;
+    TextFormatter<SpyingWriter&> writer(spy);
+    writer.writeString("ab\0cd", 5);
+    REQUIRE(spy.log == "[\"][ab][\\u0000][cd][\"]");
+    REQUIRE(writer.bytesWritten() == 12);
+  }
 }
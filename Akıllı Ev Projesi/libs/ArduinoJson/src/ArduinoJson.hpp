@@ -31,6 +31,10 @@
 #include "ArduinoJson/Variant/JsonVariantConst.hpp"
 
 #include "ArduinoJson/Document/JsonDocument.hpp"
+#include "ArduinoJson/Document/JsonDocumentPool.hpp"
+#include "ArduinoJson/Document/JsonSharedDocument.hpp"
+#include "ArduinoJson/Document/JsonSnapshot.hpp"
+#include "ArduinoJson/Memory/MonotonicArenaAllocator.hpp"
 
 #include "ArduinoJson/Array/ArrayImpl.hpp"
 #include "ArduinoJson/Array/ElementProxy.hpp"
@@ -45,12 +49,21 @@
 #include "ArduinoJson/Variant/VariantImpl.hpp"
 #include "ArduinoJson/Variant/VariantRefBaseImpl.hpp"
 
+#include "ArduinoJson/Cbor/CborDeserializer.hpp"
+#include "ArduinoJson/Deserialization/BufferedStream.hpp"
+#include "ArduinoJson/Cbor/CborSerializer.hpp"
 #include "ArduinoJson/Json/JsonDeserializer.hpp"
+#include "ArduinoJson/Json/JsonLazyDocument.hpp"
+#include "ArduinoJson/Json/JsonLines.hpp"
+#include "ArduinoJson/Json/JsonSerializationCursor.hpp"
 #include "ArduinoJson/Json/JsonSerializer.hpp"
+#include "ArduinoJson/Json/JsonStreamParser.hpp"
 #include "ArduinoJson/Json/PrettyJsonSerializer.hpp"
 #include "ArduinoJson/MsgPack/MsgPackBinary.hpp"
 #include "ArduinoJson/MsgPack/MsgPackDeserializer.hpp"
 #include "ArduinoJson/MsgPack/MsgPackExtension.hpp"
+#include "ArduinoJson/MsgPack/MsgPackSerializationCursor.hpp"
 #include "ArduinoJson/MsgPack/MsgPackSerializer.hpp"
+#include "ArduinoJson/MsgPack/MsgPackVariantConst.hpp"
 
 #include "ArduinoJson/compatibility.hpp"
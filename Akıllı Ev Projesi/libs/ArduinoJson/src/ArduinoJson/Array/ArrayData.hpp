@@ -5,6 +5,7 @@
 #pragma once
 
 #include <ArduinoJson/Collection/CollectionData.hpp>
+#include <ArduinoJson/Memory/ElementIndex.hpp>
 
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
@@ -31,6 +32,8 @@ class ArrayData : public CollectionData {
 
   VariantData* getOrAddElement(size_t index, ResourceManager* resources);
 
+  size_t size(const ResourceManager* resources) const;
+
   VariantData* getElement(size_t index, const ResourceManager* resources) const;
 
   static VariantData* getElement(const ArrayData* array, size_t index,
@@ -49,9 +52,7 @@ class ArrayData : public CollectionData {
     array->removeElement(index, resources);
   }
 
-  void remove(iterator it, ResourceManager* resources) {
-    CollectionData::removeOne(it, resources);
-  }
+  void remove(iterator it, ResourceManager* resources);
 
   static void remove(ArrayData* array, iterator it,
                      ResourceManager* resources) {
@@ -61,6 +62,16 @@ class ArrayData : public CollectionData {
 
  private:
   iterator at(size_t index, const ResourceManager* resources) const;
+  void appendOne(Slot<VariantData> slot, ResourceManager* resources);
+
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  ElementIndex* getElementIndex(const ResourceManager* resources) const;
+  ElementIndex* createElementIndex(const ResourceManager* resources) const;
+  iterator elementAt(const ElementIndex* index, size_t i,
+                     const ResourceManager* resources) const;
+  void removeIndexedElement(ElementIndex* index, size_t i,
+                            ResourceManager* resources);
+#endif
 };
 
 ARDUINOJSON_END_PRIVATE_NAMESPACE
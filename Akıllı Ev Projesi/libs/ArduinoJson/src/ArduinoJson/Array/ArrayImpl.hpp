@@ -12,6 +12,13 @@ ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
 inline ArrayData::iterator ArrayData::at(
     size_t index, const ResourceManager* resources) const {
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  auto elements = getElementIndex(resources);
+  if (!elements && index >= ARDUINOJSON_ARRAY_INDEX_THRESHOLD)
+    elements = createElementIndex(resources);
+  if (elements)
+    return elementAt(elements, index, resources);
+#endif
   auto it = createIterator(resources);
   while (!it.done() && index) {
     it.next(resources);
@@ -24,12 +31,24 @@ inline VariantData* ArrayData::addElement(ResourceManager* resources) {
   auto slot = resources->allocVariant();
   if (!slot)
     return nullptr;
-  CollectionData::appendOne(slot, resources);
+  appendOne(slot, resources);
   return slot.ptr();
 }
 
 inline VariantData* ArrayData::getOrAddElement(size_t index,
                                                ResourceManager* resources) {
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  auto it = at(index, resources);
+  if (!it.done())
+    return it.data();
+  VariantData* element = nullptr;
+  for (size_t n = size(resources); n <= index; n++) {
+    element = addElement(resources);
+    if (!element)
+      return nullptr;
+  }
+  return element;
+#else
   auto it = createIterator(resources);
   while (!it.done() && index > 0) {
     it.next(resources);
@@ -45,6 +64,16 @@ inline VariantData* ArrayData::getOrAddElement(size_t index,
     index--;
   }
   return element;
+#endif
+}
+
+inline size_t ArrayData::size(const ResourceManager* resources) const {
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  auto elements = resources->getElementIndex(head());
+  if (elements)
+    return elements->size();
+#endif
+  return CollectionData::size(resources);
 }
 
 inline VariantData* ArrayData::getElement(
@@ -53,9 +82,116 @@ inline VariantData* ArrayData::getElement(
 }
 
 inline void ArrayData::removeElement(size_t index, ResourceManager* resources) {
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  auto elements = getElementIndex(resources);
+  if (!elements)
+    elements = createElementIndex(resources);
+  if (elements) {
+    removeIndexedElement(elements, index, resources);
+    return;
+  }
+#endif
   remove(at(index, resources), resources);
 }
 
+inline void ArrayData::remove(iterator it, ResourceManager* resources) {
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  auto elements = resources->getElementIndex(head());
+  if (elements && !it.done()) {
+    if (!elements->stale()) {
+      if (it.currentId_ == (*elements)[0]) {
+        removeIndexedElement(elements, 0, resources);
+        return;
+      }
+      if (it.currentId_ == (*elements)[elements->size() - 1]) {
+        removeIndexedElement(elements, elements->size() - 1, resources);
+        return;
+      }
+    }
+    auto oldHead = head();
+    elements->removeAny(resources->allocator());
+    CollectionData::removeOne(it, resources);
+    if (oldHead != head())
+      resources->renameElementIndex(oldHead, head());
+    return;
+  }
+#endif
+  CollectionData::removeOne(it, resources);
+}
+
+inline void ArrayData::appendOne(Slot<VariantData> slot,
+                                 ResourceManager* resources) {
+  CollectionData::appendOne(slot, resources);
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  auto elements = resources->getElementIndex(head());
+  if (elements && !elements->append(slot.id(), resources->allocator()))
+    resources->destroyElementIndex(head());
+#endif
+}
+
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+// Returns the index of the array, rebuilt if elements were removed since the
+// last access, or nullptr if the array isn't indexed
+inline ElementIndex* ArrayData::getElementIndex(
+    const ResourceManager* resources) const {
+  auto elements = resources->getElementIndex(head());
+  if (elements && elements->stale()) {
+    elements->rebuild();
+    for (auto id = head(); id != NULL_SLOT;
+         id = resources->getVariant(id)->next())
+      elements->push(id);
+  }
+  return elements;
+}
+
+// Indexes the array if it's large enough to be worth it
+inline ElementIndex* ArrayData::createElementIndex(
+    const ResourceManager* resources) const {
+  auto it = createIterator(resources);
+  for (size_t n = 0; n < ARDUINOJSON_ARRAY_INDEX_THRESHOLD; n++) {
+    if (it.done())
+      return nullptr;
+    it.next(resources);
+  }
+  auto elements = resources->createElementIndex(head());
+  if (!elements)
+    return nullptr;
+  for (auto id = head(); id != NULL_SLOT;
+       id = resources->getVariant(id)->next()) {
+    if (!elements->append(id, resources->allocator())) {
+      resources->destroyElementIndex(head());
+      return nullptr;
+    }
+  }
+  return elements;
+}
+
+inline ArrayData::iterator ArrayData::elementAt(
+    const ElementIndex* elements, size_t i,
+    const ResourceManager* resources) const {
+  if (i >= elements->size())
+    return iterator();
+  auto id = (*elements)[i];
+  return iterator(resources->getVariant(id), id);
+}
+
+inline void ArrayData::removeIndexedElement(ElementIndex* elements, size_t i,
+                                            ResourceManager* resources) {
+  if (i >= elements->size())
+    return;
+  // the index gives the previous slot, so we don't need to walk the list
+  auto prevId = i ? (*elements)[i - 1] : NULL_SLOT;
+  auto it = elementAt(elements, i, resources);
+  auto oldHead = head();
+  if (!elements->remove(i, resources->allocator()))
+    elements->removeAny(resources->allocator());
+  CollectionData::removeOne(
+      it, Slot<VariantData>(resources->getVariant(prevId), prevId), resources);
+  if (oldHead != head())
+    resources->renameElementIndex(oldHead, head());
+}
+#endif
+
 template <typename T>
 inline bool ArrayData::addValue(const T& value, ResourceManager* resources) {
   ARDUINOJSON_ASSERT(resources != nullptr);
@@ -67,7 +203,7 @@ inline bool ArrayData::addValue(const T& value, ResourceManager* resources) {
     resources->freeVariant(slot);
     return false;
   }
-  CollectionData::appendOne(slot, resources);
+  appendOne(slot, resources);
   return true;
 }
 
@@ -0,0 +1,660 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Deserialization/deserialize.hpp>
+#include <ArduinoJson/Memory/ResourceManager.hpp>
+#include <ArduinoJson/Memory/StringBuffer.hpp>
+#include <ArduinoJson/MsgPack/endianness.hpp>
+#include <ArduinoJson/MsgPack/ieee754.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+#include <ArduinoJson/Variant/VariantData.hpp>
+
+#include <string.h>  // memcpy, memmove
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Parses a CBOR input (RFC 8949).
+// The byte strings become MsgPackBinary values, and the tags are ignored: the
+// tagged item is read as if it had no tag.
+template <typename TReader>
+class CborDeserializer {
+ public:
+  CborDeserializer(ResourceManager* resources, TReader reader)
+      : resources_(resources),
+        reader_(reader),
+        stringBuffer_(resources),
+        foundSomething_(false) {}
+
+  template <typename TFilter>
+  DeserializationError parse(VariantData& variant, TFilter filter,
+                             DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+    err = parseVariant(&variant, filter, nestingLimit);
+    return foundSomething_ ? err : DeserializationError::EmptyInput;
+  }
+
+ private:
+  // The major types, in the three high bits of the initial byte
+  enum : uint8_t {
+    majorUnsigned = 0,
+    majorNegative = 1,
+    majorBytes = 2,
+    majorText = 3,
+    majorArray = 4,
+    majorMap = 5,
+    majorTag = 6,
+    majorSimple = 7,
+  };
+
+  // The additional information, in the five low bits of the initial byte
+  static const uint8_t indefiniteLength = 31;
+
+  // Ends an indefinite-length item
+  static const uint8_t breakCode = 0xff;
+
+  template <typename TFilter>
+  DeserializationError::Code parseVariant(
+      VariantData* variant, TFilter filter,
+      DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+    uint8_t code;
+
+    err = readByte(code);
+    if (err)
+      return err;
+
+    return parseVariant(code, variant, filter, nestingLimit);
+  }
+
+  // code is the initial byte, which was already read
+  template <typename TFilter>
+  DeserializationError::Code parseVariant(
+      uint8_t code, VariantData* variant, TFilter filter,
+      DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    foundSomething_ = true;
+
+    err = skipTags(code);
+    if (err)
+      return err;
+
+    bool allowValue = filter.allowValue();
+
+    if (allowValue) {
+      // callers pass a null pointer only when value must be ignored
+      ARDUINOJSON_ASSERT(variant != 0);
+    }
+
+    uint8_t major = uint8_t(code >> 5);
+
+    if (major == majorSimple)
+      return readSimpleValue(code, allowValue ? variant : nullptr);
+
+    if ((code & 0x1f) == indefiniteLength) {
+      switch (major) {
+        case majorBytes:
+          return readIndefiniteBinary(allowValue ? variant : nullptr);
+
+        case majorText:
+          return readIndefiniteString(allowValue ? variant : nullptr);
+
+        case majorArray:
+          return readArray(variant, 0, true, filter, nestingLimit);
+
+        case majorMap:
+          return readObject(variant, 0, true, filter, nestingLimit);
+
+        default:  // integers can't have an indefinite length
+          return DeserializationError::InvalidInput;
+      }
+    }
+
+    uint64_t argument;
+    err = readArgument(code, argument);
+    if (err)
+      return err;
+
+    if (major == majorUnsigned) {
+      if (allowValue)
+        return setUnsignedInteger(variant, argument);
+      return DeserializationError::Ok;
+    }
+
+    if (major == majorNegative) {
+      if (allowValue)
+        return setNegativeInteger(variant, argument);
+      return DeserializationError::Ok;
+    }
+
+    size_t size;
+    err = toSize(argument, size);
+    if (err)
+      return err;
+
+    switch (major) {
+      case majorBytes:
+        if (allowValue)
+          return readBinary(variant, size);
+        else
+          return skipBytes(size);
+
+      case majorText:
+        if (allowValue)
+          return readString(variant, size);
+        else
+          return skipBytes(size);
+
+      case majorArray:
+        return readArray(variant, size, false, filter, nestingLimit);
+
+      default:
+        ARDUINOJSON_ASSERT(major == majorMap);
+        return readObject(variant, size, false, filter, nestingLimit);
+    }
+  }
+
+  // Reads the tags that precede an item, and updates code with the initial
+  // byte of the item
+  DeserializationError::Code skipTags(uint8_t& code) {
+    while (code >> 5 == majorTag) {
+      uint64_t tag;
+      auto err = readArgument(code, tag);
+      if (err)
+        return err;
+
+      err = readByte(code);
+      if (err)
+        return err;
+    }
+    return DeserializationError::Ok;
+  }
+
+  // Reads a simple value or a float; variant is null if it must be ignored
+  DeserializationError::Code readSimpleValue(uint8_t code,
+                                             VariantData* variant) {
+    switch (code & 0x1f) {
+      case 20:  // false
+      case 21:  // true
+        if (variant)
+          variant->setBoolean(code == 0xf5);
+        return DeserializationError::Ok;
+
+      case 24: {  // simple value in the next byte
+        uint8_t value;
+        auto err = readByte(value);
+        if (err)
+          return err;
+        if (value < 32)  // must use the short form
+          return DeserializationError::InvalidInput;
+        return DeserializationError::Ok;  // unassigned, becomes null
+      }
+
+      case 25:
+        if (variant)
+          return readHalf(variant);
+        else
+          return skipBytes(2);
+
+      case 26:
+        if (variant)
+          return readFloat<float>(variant);
+        else
+          return skipBytes(4);
+
+      case 27:
+        if (variant)
+          return readDouble<double>(variant);
+        else
+          return skipBytes(8);
+
+      case 28:
+      case 29:
+      case 30:
+      case indefiniteLength:  // a break outside of an indefinite-length item
+        return DeserializationError::InvalidInput;
+
+      default:  // null, undefined, and the unassigned simple values
+        return DeserializationError::Ok;
+    }
+  }
+
+  // Reads the argument that follows the initial byte: a count, a length, an
+  // integer, or a tag
+  DeserializationError::Code readArgument(uint8_t code, uint64_t& value) {
+    uint8_t info = code & 0x1f;
+    if (info < 24) {
+      value = info;
+      return DeserializationError::Ok;
+    }
+    if (info > 27)
+      return DeserializationError::InvalidInput;
+
+    uint8_t buffer[8];
+    auto width = uint8_t(1U << (info - 24));
+    auto err = readBytes(buffer, width);
+    if (err)
+      return err;
+
+    value = 0;
+    for (uint8_t i = 0; i < width; i++)
+      value = (value << 8) | buffer[i];
+    return DeserializationError::Ok;
+  }
+
+  static DeserializationError::Code toSize(uint64_t argument, size_t& size) {
+    size = size_t(argument);
+    if (size != argument)                     // integer overflow
+      return DeserializationError::NoMemory;  // (not testable on 64-bit)
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code readByte(uint8_t& value) {
+    int c = reader_.read();
+    if (c < 0)
+      return DeserializationError::IncompleteInput;
+    value = static_cast<uint8_t>(c);
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code readBytes(void* p, size_t n) {
+    if (reader_.readBytes(reinterpret_cast<char*>(p), n) == n)
+      return DeserializationError::Ok;
+    return DeserializationError::IncompleteInput;
+  }
+
+  template <typename T>
+  DeserializationError::Code readBytes(T& value) {
+    return readBytes(&value, sizeof(value));
+  }
+
+  DeserializationError::Code skipBytes(size_t n) {
+    for (; n; --n) {
+      if (reader_.read() < 0)
+        return DeserializationError::IncompleteInput;
+    }
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code setUnsignedInteger(VariantData* variant,
+                                                uint64_t value) {
+    auto truncatedValue = static_cast<JsonUInt>(value);
+    if (truncatedValue == value) {
+      if (!variant->setInteger(truncatedValue, resources_))
+        return DeserializationError::NoMemory;
+    }
+    // else set null on overflow
+    return DeserializationError::Ok;
+  }
+
+  // The value is -1 - argument
+  DeserializationError::Code setNegativeInteger(VariantData* variant,
+                                                uint64_t argument) {
+    if (argument > 0x7FFFFFFFFFFFFFFFU)  // set null on overflow
+      return DeserializationError::Ok;
+    auto value = -1 - static_cast<int64_t>(argument);
+    auto truncatedValue = static_cast<JsonInteger>(value);
+    if (truncatedValue == value) {
+      if (!variant->setInteger(truncatedValue, resources_))
+        return DeserializationError::NoMemory;
+    }
+    // else set null on overflow
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code readHalf(VariantData* variant) {
+    uint8_t bytes[2];
+    auto err = readBytes(bytes, 2);
+    if (err)
+      return err;
+
+    variant->setFloat(halfToFloat(bytes), resources_);
+    return DeserializationError::Ok;
+  }
+
+  template <typename T>
+  enable_if_t<sizeof(T) == 4, DeserializationError::Code> readFloat(
+      VariantData* variant) {
+    DeserializationError::Code err;
+    T value;
+
+    err = readBytes(value);
+    if (err)
+      return err;
+
+    fixEndianness(value);
+    variant->setFloat(value, resources_);
+
+    return DeserializationError::Ok;
+  }
+
+  template <typename T>
+  enable_if_t<sizeof(T) == 8, DeserializationError::Code> readDouble(
+      VariantData* variant) {
+    DeserializationError::Code err;
+    T value;
+
+    err = readBytes(value);
+    if (err)
+      return err;
+
+    fixEndianness(value);
+    if (variant->setFloat(value, resources_))
+      return DeserializationError::Ok;
+    else
+      return DeserializationError::NoMemory;
+  }
+
+  template <typename T>
+  enable_if_t<sizeof(T) == 4, DeserializationError::Code> readDouble(
+      VariantData* variant) {
+    DeserializationError::Code err;
+    uint8_t i[8];  // input is 8 bytes
+    T value;       // output is 4 bytes
+    uint8_t* o = reinterpret_cast<uint8_t*>(&value);
+
+    err = readBytes(i, 8);
+    if (err)
+      return err;
+
+    doubleToFloat(i, o);
+    fixEndianness(value);
+    variant->setFloat(value, resources_);
+
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code readString(VariantData* variant, size_t n) {
+    DeserializationError::Code err;
+
+    err = readString(n);
+    if (err)
+      return err;
+
+    stringBuffer_.save(variant);
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code readString(size_t n) {
+    char* p = stringBuffer_.reserve(n);
+    if (!p)
+      return DeserializationError::NoMemory;
+
+    return readBytes(p, n);
+  }
+
+  DeserializationError::Code readIndefiniteString(VariantData* variant) {
+    auto err = readChunks(majorText, variant == nullptr);
+    if (err)
+      return err;
+
+    if (variant)
+      stringBuffer_.save(variant);
+    return DeserializationError::Ok;
+  }
+
+  // Reads the chunks of an indefinite-length string in the string buffer, or
+  // skips them
+  DeserializationError::Code readChunks(uint8_t major, bool skip) {
+    DeserializationError::Code err;
+
+    if (!skip && !stringBuffer_.reserve(0))
+      return DeserializationError::NoMemory;
+
+    for (;;) {
+      uint8_t code;
+      err = readByte(code);
+      if (err)
+        return err;
+
+      if (code == breakCode)
+        return DeserializationError::Ok;
+
+      // the chunks are definite-length strings of the same type
+      if (code >> 5 != major || (code & 0x1f) == indefiniteLength)
+        return DeserializationError::InvalidInput;
+
+      uint64_t argument;
+      err = readArgument(code, argument);
+      if (err)
+        return err;
+
+      size_t size;
+      err = toSize(argument, size);
+      if (err)
+        return err;
+
+      if (skip) {
+        err = skipBytes(size);
+      } else {
+        char* p = stringBuffer_.extend(size);
+        if (!p)
+          return DeserializationError::NoMemory;
+        err = readBytes(p, size);
+      }
+      if (err)
+        return err;
+    }
+  }
+
+  // The byte strings are saved like MsgPackBinary: with a bin 8, 16, or 32
+  // header
+  static uint8_t binaryHeaderSize(size_t n) {
+    return n >= 0x10000 ? 5 : n >= 0x100 ? 3 : 2;
+  }
+
+  static void writeBinaryHeader(char* p, size_t n) {
+    uint8_t headerSize = binaryHeaderSize(n);
+    p[0] = char(headerSize == 5 ? 0xc6 : headerSize == 3 ? 0xc5 : 0xc4);
+    for (uint8_t i = 1; i < headerSize; i++)
+      p[i] = char(n >> (headerSize - i - 1) * 8 & 0xff);
+  }
+
+  DeserializationError::Code readBinary(VariantData* variant, size_t n) {
+    if (uint64_t(n) > 0xFFFFFFFF)  // doesn't fit in a bin 32
+      return DeserializationError::NoMemory;
+
+    uint8_t headerSize = binaryHeaderSize(n);
+    auto totalSize = size_t(headerSize + n);
+    if (totalSize < n)                        // integer overflow
+      return DeserializationError::NoMemory;  // (not testable on 64-bit)
+
+    char* p = stringBuffer_.reserve(totalSize);
+    if (!p)
+      return DeserializationError::NoMemory;
+
+    writeBinaryHeader(p, n);
+
+    auto err = readBytes(p + headerSize, n);
+    if (err)
+      return err;
+
+    stringBuffer_.saveRaw(variant);
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code readIndefiniteBinary(VariantData* variant) {
+    auto err = readChunks(majorBytes, variant == nullptr);
+    if (err || !variant)
+      return err;
+
+    // the size is only known now, so insert the header before the data
+    size_t n = stringBuffer_.str().size();
+    if (uint64_t(n) > 0xFFFFFFFF)  // doesn't fit in a bin 32
+      return DeserializationError::NoMemory;
+    uint8_t headerSize = binaryHeaderSize(n);
+    char* end = stringBuffer_.extend(headerSize);
+    if (!end)
+      return DeserializationError::NoMemory;
+    char* p = end - n;
+    memmove(p + headerSize, p, n);
+    writeBinaryHeader(p, n);
+
+    stringBuffer_.saveRaw(variant);
+    return DeserializationError::Ok;
+  }
+
+  template <typename TFilter>
+  DeserializationError::Code readArray(
+      VariantData* variant, size_t n, bool indefinite, TFilter filter,
+      DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    if (nestingLimit.reached())
+      return DeserializationError::TooDeep;
+
+    bool allowArray = filter.allowArray();
+
+    ArrayData* array;
+    if (allowArray) {
+      ARDUINOJSON_ASSERT(variant != 0);
+      array = &variant->toArray();
+    } else {
+      array = 0;
+    }
+
+    TFilter elementFilter = filter[0U];
+
+    for (size_t i = 0; indefinite || i < n; i++) {
+      uint8_t code;
+      err = readByte(code);
+      if (err)
+        return err;
+
+      if (indefinite && code == breakCode)
+        break;
+
+      VariantData* value;
+
+      if (elementFilter.allow()) {
+        ARDUINOJSON_ASSERT(array != 0);
+        value = array->addElement(resources_);
+        if (!value)
+          return DeserializationError::NoMemory;
+      } else {
+        value = 0;
+      }
+
+      err = parseVariant(code, value, elementFilter, nestingLimit.decrement());
+      if (err)
+        return err;
+    }
+
+    return DeserializationError::Ok;
+  }
+
+  template <typename TFilter>
+  DeserializationError::Code readObject(
+      VariantData* variant, size_t n, bool indefinite, TFilter filter,
+      DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    if (nestingLimit.reached())
+      return DeserializationError::TooDeep;
+
+    ObjectData* object;
+    if (filter.allowObject()) {
+      ARDUINOJSON_ASSERT(variant != 0);
+      object = &variant->toObject();
+    } else {
+      object = 0;
+    }
+
+    for (size_t i = 0; indefinite || i < n; i++) {
+      uint8_t code;
+      err = readByte(code);
+      if (err)
+        return err;
+
+      if (indefinite && code == breakCode)
+        break;
+
+      err = readKey(code);
+      if (err)
+        return err;
+
+      JsonString key = stringBuffer_.str();
+      TFilter memberFilter = filter[key.c_str()];
+      VariantData* member = 0;
+
+      if (memberFilter.allow()) {
+        ARDUINOJSON_ASSERT(object != 0);
+
+        auto keyVariant = object->addPair(&member, resources_);
+        if (!keyVariant)
+          return DeserializationError::NoMemory;
+
+        stringBuffer_.save(keyVariant);
+      }
+
+      err = parseVariant(member, memberFilter, nestingLimit.decrement());
+      if (err)
+        return err;
+    }
+
+    return DeserializationError::Ok;
+  }
+
+  // Reads a key in the string buffer; only text strings are supported
+  DeserializationError::Code readKey(uint8_t code) {
+    auto err = skipTags(code);
+    if (err)
+      return err;
+
+    if (code >> 5 != majorText)
+      return DeserializationError::InvalidInput;
+
+    if ((code & 0x1f) == indefiniteLength)
+      return readChunks(majorText, false);
+
+    uint64_t argument;
+    err = readArgument(code, argument);
+    if (err)
+      return err;
+
+    size_t size;
+    err = toSize(argument, size);
+    if (err)
+      return err;
+
+    return readString(size);
+  }
+
+  ResourceManager* resources_;
+  TReader reader_;
+  StringBuffer stringBuffer_;
+  bool foundSomething_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Parses a CBOR input and puts the result in a JsonDocument.
+// Supports the definite and indefinite-length items, and the same options as
+// deserializeMsgPack(): Filter, CompiledFilter, and NestingLimit.
+template <typename TDestination, typename... Args,
+          detail::enable_if_t<
+              detail::is_deserialize_destination<TDestination>::value, int> = 0>
+inline DeserializationError deserializeCbor(TDestination&& dst,
+                                            Args&&... args) {
+  using namespace detail;
+  return deserialize<CborDeserializer>(detail::forward<TDestination>(dst),
+                                       detail::forward<Args>(args)...);
+}
+
+// Parses a CBOR input and puts the result in a JsonDocument.
+template <typename TDestination, typename TChar, typename... Args,
+          detail::enable_if_t<
+              detail::is_deserialize_destination<TDestination>::value, int> = 0>
+inline DeserializationError deserializeCbor(TDestination&& dst, TChar* input,
+                                            Args&&... args) {
+  using namespace detail;
+  return deserialize<CborDeserializer>(detail::forward<TDestination>(dst),
+                                       input, detail::forward<Args>(args)...);
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -0,0 +1,229 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/MsgPack/endianness.hpp>
+#include <ArduinoJson/Polyfills/assert.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+#include <ArduinoJson/Serialization/CountingDecorator.hpp>
+#include <ArduinoJson/Serialization/measure.hpp>
+#include <ArduinoJson/Serialization/serialize.hpp>
+#include <ArduinoJson/Variant/VariantData.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Produces a CBOR output (RFC 8949), with definite lengths only.
+// The MsgPackBinary values become byte strings. The other raw strings, like
+// serialized() or MsgPackExtension, have no CBOR equivalent and become null.
+template <typename TWriter>
+class CborSerializer : public VariantDataVisitor<size_t> {
+ public:
+  static const bool producesText = false;
+
+  CborSerializer(TWriter writer, const ResourceManager* resources)
+      : writer_(writer), resources_(resources) {}
+
+  template <typename T>
+  enable_if_t<is_floating_point<T>::value && sizeof(T) == 4, size_t> visit(
+      T value32) {
+    if (canConvertNumber<JsonInteger>(value32)) {
+      JsonInteger truncatedValue = JsonInteger(value32);
+      if (value32 == T(truncatedValue))
+        return visit(truncatedValue);
+    }
+    writeByte(0xFA);
+    writeInteger(value32);
+    return bytesWritten();
+  }
+
+  template <typename T>
+  ARDUINOJSON_NO_SANITIZE("float-cast-overflow")
+  enable_if_t<is_floating_point<T>::value && sizeof(T) == 8, size_t> visit(
+      T value64) {
+    float value32 = float(value64);
+    if (value32 == value64)
+      return visit(value32);
+    writeByte(0xFB);
+    writeInteger(value64);
+    return bytesWritten();
+  }
+
+  size_t visit(const ArrayData& array) {
+    writeHead(majorArray, array.size(resources_));
+
+    auto slotId = array.head();
+    while (slotId != NULL_SLOT) {
+      auto slot = resources_->getVariant(slotId);
+      slot->accept(*this, resources_);
+      slotId = slot->next();
+    }
+
+    return bytesWritten();
+  }
+
+  size_t visit(const ObjectData& object) {
+    writeHead(majorMap, object.size(resources_));
+
+    auto slotId = object.head();
+    while (slotId != NULL_SLOT) {
+      auto slot = resources_->getVariant(slotId);
+      slot->accept(*this, resources_);
+      slotId = slot->next();
+    }
+
+    return bytesWritten();
+  }
+
+  size_t visit(const char* value) {
+    return visit(JsonString(value));
+  }
+
+  size_t visit(JsonString value) {
+    ARDUINOJSON_ASSERT(!value.isNull());
+
+    writeHead(majorText, value.size());
+    writeBytes(reinterpret_cast<const uint8_t*>(value.c_str()), value.size());
+    return bytesWritten();
+  }
+
+  size_t visit(RawString value) {
+    auto p = reinterpret_cast<const uint8_t*>(value.data());
+    auto n = value.size();
+
+    size_t headerSize = binaryHeaderSize(p, n);
+    if (!headerSize)
+      return visit(nullptr);
+    writeHead(majorBytes, n - headerSize);
+    writeBytes(p + headerSize, n - headerSize);
+    return bytesWritten();
+  }
+
+  size_t visit(JsonInteger value) {
+    if (value >= 0)
+      writeHead(majorUnsigned, static_cast<JsonUInt>(value));
+    else  // -1 - n, computed without overflow
+      writeHead(majorNegative, static_cast<JsonUInt>(-(value + 1)));
+    return bytesWritten();
+  }
+
+  size_t visit(JsonUInt value) {
+    writeHead(majorUnsigned, value);
+    return bytesWritten();
+  }
+
+  size_t visit(bool value) {
+    writeByte(value ? 0xF5 : 0xF4);
+    return bytesWritten();
+  }
+
+  size_t visit(nullptr_t) {
+    writeByte(0xF6);
+    return bytesWritten();
+  }
+
+ private:
+  // The major types, in the three high bits of the initial byte
+  enum : uint8_t {
+    majorUnsigned = 0,
+    majorNegative = 1,
+    majorBytes = 2,
+    majorText = 3,
+    majorArray = 4,
+    majorMap = 5,
+  };
+
+  // Returns the size of the header if the raw string is a MsgPackBinary,
+  // 0 otherwise
+  static size_t binaryHeaderSize(const uint8_t* p, size_t n) {
+    if (n >= 2 && p[0] == 0xc4 && size_t(p[1]) + 2 == n)
+      return 2;
+    if (n >= 3 && p[0] == 0xc5 && (size_t(p[1]) << 8 | p[2]) + 3 == n)
+      return 3;
+    if (n >= 5 && p[0] == 0xc6 &&
+        (size_t(p[1]) << 24 | size_t(p[2]) << 16 | size_t(p[3]) << 8 | p[4]) +
+                5 ==
+            n)
+      return 5;
+    return 0;
+  }
+
+  // Writes the initial byte and the argument in the shortest form
+  void writeHead(uint8_t major, JsonUInt value) {
+    uint8_t type = uint8_t(major << 5);
+    if (value < 24) {
+      writeByte(uint8_t(type | value));
+    } else if (value <= 0xFF) {
+      writeByte(type | 24);
+      writeInteger(uint8_t(value));
+    } else if (value <= 0xFFFF) {
+      writeByte(type | 25);
+      writeInteger(uint16_t(value));
+    }
+#if ARDUINOJSON_USE_LONG_LONG
+    else if (value <= 0xFFFFFFFF)
+#else
+    else
+#endif
+    {
+      writeByte(type | 26);
+      writeInteger(uint32_t(value));
+    }
+#if ARDUINOJSON_USE_LONG_LONG
+    else {
+      writeByte(type | 27);
+      writeInteger(uint64_t(value));
+    }
+#endif
+  }
+
+  size_t bytesWritten() const {
+    return writer_.count();
+  }
+
+  void writeByte(uint8_t c) {
+    writer_.write(c);
+  }
+
+  void writeBytes(const uint8_t* p, size_t n) {
+    writer_.write(p, n);
+  }
+
+  template <typename T>
+  void writeInteger(T value) {
+    fixEndianness(value);
+    writeBytes(reinterpret_cast<uint8_t*>(&value), sizeof(value));
+  }
+
+  CountingDecorator<TWriter> writer_;
+  const ResourceManager* resources_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Produces a CBOR document.
+template <
+    typename TDestination,
+    detail::enable_if_t<!detail::is_pointer<TDestination>::value, int> = 0>
+inline size_t serializeCbor(JsonVariantConst source, TDestination& output) {
+  using namespace ArduinoJson::detail;
+  return serialize<CborSerializer>(source, output);
+}
+
+// Produces a CBOR document.
+inline size_t serializeCbor(JsonVariantConst source, void* output,
+                            size_t size) {
+  using namespace ArduinoJson::detail;
+  return serialize<CborSerializer>(source, output, size);
+}
+
+// Computes the length of the document that serializeCbor() produces.
+inline size_t measureCbor(JsonVariantConst source) {
+  using namespace ArduinoJson::detail;
+  return measure<CborSerializer>(source);
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -17,6 +17,8 @@ class ResourceManager;
 
 class CollectionIterator {
   friend class CollectionData;
+  friend class ArrayData;
+  friend class ObjectData;
 
  public:
   CollectionIterator() : slot_(nullptr), currentId_(NULL_SLOT) {}
@@ -102,9 +104,10 @@ class CollectionData {
                   const ResourceManager* resources);
 
   void removeOne(iterator it, ResourceManager* resources);
+  void removeOne(iterator it, Slot<VariantData> prev,
+                 ResourceManager* resources);
   void removePair(iterator it, ResourceManager* resources);
 
- private:
   Slot<VariantData> getPreviousSlot(VariantData*, const ResourceManager*) const;
 };
 
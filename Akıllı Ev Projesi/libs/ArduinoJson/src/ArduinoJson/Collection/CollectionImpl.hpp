@@ -32,6 +32,9 @@ inline CollectionData::iterator CollectionData::createIterator(
 
 inline void CollectionData::appendOne(Slot<VariantData> slot,
                                       const ResourceManager* resources) {
+#if ARDUINOJSON_DOUBLY_LINKED_COLLECTIONS
+  slot->setPrev(tail_);
+#endif
   if (tail_ != NULL_SLOT) {
     auto tail = resources->getVariant(tail_);
     tail->setNext(slot.id());
@@ -46,6 +49,10 @@ inline void CollectionData::appendPair(Slot<VariantData> key,
                                        Slot<VariantData> value,
                                        const ResourceManager* resources) {
   key->setNext(value.id());
+#if ARDUINOJSON_DOUBLY_LINKED_COLLECTIONS
+  key->setPrev(tail_);
+  value->setPrev(key.id());
+#endif
 
   if (tail_ != NULL_SLOT) {
     auto tail = resources->getVariant(tail_);
@@ -58,6 +65,13 @@ inline void CollectionData::appendPair(Slot<VariantData> key,
 }
 
 inline void CollectionData::clear(ResourceManager* resources) {
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+  resources->destroyKeyIndex(head_);
+#endif
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  resources->destroyElementIndex(head_);
+#endif
+
   auto next = head_;
   while (next != NULL_SLOT) {
     auto currId = next;
@@ -72,6 +86,10 @@ inline void CollectionData::clear(ResourceManager* resources) {
 
 inline Slot<VariantData> CollectionData::getPreviousSlot(
     VariantData* target, const ResourceManager* resources) const {
+#if ARDUINOJSON_DOUBLY_LINKED_COLLECTIONS
+  auto prevId = target->prev();
+  return Slot<VariantData>(resources->getVariant(prevId), prevId);
+#else
   auto prev = Slot<VariantData>();
   auto currentId = head_;
   while (currentId != NULL_SLOT) {
@@ -82,20 +100,30 @@ inline Slot<VariantData> CollectionData::getPreviousSlot(
     currentId = currentSlot->next();
   }
   return prev;
+#endif
 }
 
 inline void CollectionData::removeOne(iterator it, ResourceManager* resources) {
   if (it.done())
     return;
-  auto curr = it.slot_;
-  auto prev = getPreviousSlot(curr, resources);
-  auto next = curr->next();
+  removeOne(it, getPreviousSlot(it.slot_, resources), resources);
+}
+
+// prev must be the slot before it, or null if it is the head
+inline void CollectionData::removeOne(iterator it, Slot<VariantData> prev,
+                                      ResourceManager* resources) {
+  ARDUINOJSON_ASSERT(!it.done());
+  auto next = it.slot_->next();
   if (prev)
     prev->setNext(next);
   else
     head_ = next;
   if (next == NULL_SLOT)
     tail_ = prev.id();
+#if ARDUINOJSON_DOUBLY_LINKED_COLLECTIONS
+  else
+    resources->getVariant(next)->setPrev(prev.id());
+#endif
   resources->freeVariant({it.slot_, it.currentId_});
 }
 
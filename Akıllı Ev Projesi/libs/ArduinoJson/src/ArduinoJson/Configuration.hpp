@@ -56,6 +56,24 @@
 #  endif
 #endif
 
+// Support deserializeJsonLinesParallel(), which requires <thread>.
+// Off by default because the standard library of some toolchains, like
+// arm-none-eabi, provides <thread> but can't create threads.
+#ifndef ARDUINOJSON_ENABLE_STD_THREAD
+#  define ARDUINOJSON_ENABLE_STD_THREAD 0
+#endif
+
+// Support JsonDocumentPool, which requires <atomic> and thread_local
+#ifndef ARDUINOJSON_ENABLE_DOCUMENT_POOL
+#  define ARDUINOJSON_ENABLE_DOCUMENT_POOL 0
+#endif
+
+// Use atomic reference counts in JsonSharedDocument, so that the handles can be
+// copied and destroyed on several threads
+#ifndef ARDUINOJSON_ENABLE_ATOMIC
+#  define ARDUINOJSON_ENABLE_ATOMIC 0
+#endif
+
 // Pointer size: a heuristic to set sensible defaults
 #ifndef ARDUINOJSON_SIZEOF_POINTER
 #  if defined(__SIZEOF_POINTER__)
@@ -119,6 +137,18 @@
 #  endif
 #endif
 
+// Maximum capacity of a variant pool (in slots)
+// The pools grow geometrically up to this capacity, then all have this
+// capacity, so that a large document doesn't need one large block of memory.
+// Must be ARDUINOJSON_POOL_CAPACITY times a power of two.
+#ifndef ARDUINOJSON_MAX_POOL_CAPACITY
+#  if ARDUINOJSON_SLOT_ID_SIZE <= 2
+#    define ARDUINOJSON_MAX_POOL_CAPACITY ARDUINOJSON_POOL_CAPACITY
+#  else
+#    define ARDUINOJSON_MAX_POOL_CAPACITY (ARDUINOJSON_POOL_CAPACITY * 64)
+#  endif
+#endif
+
 // Initial capacity of the pool list
 #ifndef ARDUINOJSON_INITIAL_POOL_COUNT
 #  define ARDUINOJSON_INITIAL_POOL_COUNT 4
@@ -145,6 +175,58 @@
 #  endif
 #endif
 
+// Index the string pool with a hash table, so that string deduplication runs
+// in constant time instead of scanning every stored string
+#ifndef ARDUINOJSON_ENABLE_STRING_INDEX
+#  define ARDUINOJSON_ENABLE_STRING_INDEX 0
+#endif
+
+// Index the keys of large objects with a hash table, so that member lookup
+// runs in constant time instead of scanning every key
+#ifndef ARDUINOJSON_ENABLE_OBJECT_INDEX
+#  define ARDUINOJSON_ENABLE_OBJECT_INDEX 0
+#endif
+
+// Number of members an object must have before it gets indexed
+#ifndef ARDUINOJSON_OBJECT_INDEX_THRESHOLD
+#  define ARDUINOJSON_OBJECT_INDEX_THRESHOLD 16
+#endif
+
+// Index the elements of large arrays, so that size() runs in constant time,
+// and access and removal by index in O(log N) instead of walking the linked
+// list (constant time until an element is removed from the middle).
+// Removing an element through an iterator, except the first or the last,
+// makes the next access by index rebuild the index in O(N).
+#ifndef ARDUINOJSON_ENABLE_ARRAY_INDEX
+#  define ARDUINOJSON_ENABLE_ARRAY_INDEX 0
+#endif
+
+// Number of elements an array must have before it gets indexed
+#ifndef ARDUINOJSON_ARRAY_INDEX_THRESHOLD
+#  define ARDUINOJSON_ARRAY_INDEX_THRESHOLD 16
+#endif
+
+// Link the slots of arrays and objects in both directions, so that removing
+// an element runs in constant time instead of searching the previous slot.
+// This makes each slot larger.
+#ifndef ARDUINOJSON_DOUBLY_LINKED_COLLECTIONS
+#  define ARDUINOJSON_DOUBLY_LINKED_COLLECTIONS 0
+#endif
+
+// Convert decimal numbers to the nearest float or double with the
+// Eisel-Lemire algorithm, instead of multiplying by powers of ten.
+// This requires a table of 128-bit powers of five (about 10KB of Flash).
+#ifndef ARDUINOJSON_ENABLE_EXACT_FLOAT_PARSING
+#  define ARDUINOJSON_ENABLE_EXACT_FLOAT_PARSING 0
+#endif
+
+// Write floats and doubles with the fewest digits that parse back to the
+// same value (Schubfach algorithm), instead of a fixed number of decimals.
+// This shares the table of ARDUINOJSON_ENABLE_EXACT_FLOAT_PARSING.
+#ifndef ARDUINOJSON_ENABLE_SHORTEST_FLOAT_FORMATTING
+#  define ARDUINOJSON_ENABLE_SHORTEST_FLOAT_FORMATTING 0
+#endif
+
 #ifdef ARDUINO
 
 // Enable support for Arduino's String class
@@ -265,6 +347,35 @@
 #  define ARDUINOJSON_STRING_BUFFER_SIZE 32
 #endif
 
+// Size of the buffer of BufferedStream, and of the buffer used when
+// deserializing from a Stream that can take characters back with unread()
+#ifndef ARDUINOJSON_READER_BUFFER_SIZE
+#  define ARDUINOJSON_READER_BUFFER_SIZE 64
+#endif
+
+// Size of the buffer used when serializing to a Print or a std::ostream
+// (0 to write directly to the destination)
+#ifndef ARDUINOJSON_WRITER_BUFFER_SIZE
+#  define ARDUINOJSON_WRITER_BUFFER_SIZE 32
+#endif
+
+// Number of positions that JsonLazyDocument remembers, to find the values
+// it already visited without reading the input again
+#ifndef ARDUINOJSON_LAZY_DOCUMENT_CACHE_SIZE
+#  if ARDUINOJSON_SIZEOF_POINTER <= 2
+#    define ARDUINOJSON_LAZY_DOCUMENT_CACHE_SIZE 4
+#  else
+#    define ARDUINOJSON_LAZY_DOCUMENT_CACHE_SIZE 8
+#  endif
+#endif
+
+// Make JsonLazyDocument return the last member when a key appears twice, like
+// deserializeJson(). By default, it returns the first one, because the last
+// one can only be found by skipping every member of the object.
+#ifndef ARDUINOJSON_LAZY_DOCUMENT_DUPLICATE_KEYS
+#  define ARDUINOJSON_LAZY_DOCUMENT_DUPLICATE_KEYS 0
+#endif
+
 #ifndef ARDUINOJSON_DEBUG
 #  ifdef __PLATFORMIO_BUILD_DEBUG__
 #    define ARDUINOJSON_DEBUG 1
@@ -0,0 +1,77 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Configuration.hpp>
+
+#if ARDUINOJSON_ENABLE_ARDUINO_STREAM
+
+#  include <Arduino.h>
+
+#  include <ArduinoJson/Namespace.hpp>
+
+#  include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Reads a Stream by blocks of ARDUINOJSON_READER_BUFFER_SIZE characters.
+// Pass it to deserializeJson(), deserializeMsgPack() or deserializeCbor()
+// instead of the Stream, so the parser doesn't make a virtual call for each
+// character.
+// A block is limited to the characters available(), so it waits for the
+// timeout of readBytes() only when the receive buffer is empty.
+// The characters after the end of a document stay in the buffer, and the
+// next call reads them first. Read the rest of the input through this
+// object, not through the Stream, or these characters are lost.
+class BufferedStream {
+ public:
+  explicit BufferedStream(Stream& stream)
+      : stream_(&stream), begin_(0), end_(0) {}
+
+  BufferedStream(const BufferedStream&) = delete;
+  BufferedStream& operator=(const BufferedStream&) = delete;
+
+  int available() {
+    return static_cast<int>(end_ - begin_) + stream_->available();
+  }
+
+  int read() {
+    if (begin_ == end_ && !refill())
+      return -1;
+    return static_cast<unsigned char>(buffer_[begin_++]);
+  }
+
+  size_t readBytes(char* buffer, size_t length) {
+    size_t n = end_ - begin_;
+    if (n > length)
+      n = length;
+    memcpy(buffer, buffer_ + begin_, n);
+    begin_ += n;
+    if (n < length)
+      n += stream_->readBytes(buffer + n, length - n);
+    return n;
+  }
+
+ private:
+  bool refill() {
+    size_t size = 1;
+    int available = stream_->available();
+    if (available > 0)
+      size = static_cast<size_t>(available);
+    if (size > sizeof(buffer_))
+      size = sizeof(buffer_);
+    begin_ = 0;
+    end_ = stream_->readBytes(buffer_, size);
+    return end_ > 0;
+  }
+
+  Stream* stream_;
+  size_t begin_, end_;
+  char buffer_[ARDUINOJSON_READER_BUFFER_SIZE];
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
+
+#endif
@@ -0,0 +1,358 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Deserialization/Filter.hpp>
+#include <ArduinoJson/Memory/Allocator.hpp>
+#include <ArduinoJson/Object/JsonObjectConst.hpp>
+#include <ArduinoJson/Polyfills/utility.hpp>
+#include <ArduinoJson/Strings/StringAdapters.hpp>
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+namespace DeserializationOption {
+class CompiledFilter;
+}
+ARDUINOJSON_END_PUBLIC_NAMESPACE
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// A level of a compiled filter
+struct CompiledFilterNode {
+  enum : uint8_t {
+    allowFlag = 1,
+    allowArrayFlag = 2,
+    allowObjectFlag = 4,
+    allowValueFlag = 8,
+  };
+
+  uint32_t element;    // the node for the elements of an array
+  uint32_t wildcard;   // the node for the members that are not in the table
+  uint32_t table;      // the index of the first entry of the table
+  uint32_t tableSize;  // 0 or a power of two
+  uint8_t flags;
+};
+
+// A slot of the open-addressing hash table of a node
+struct CompiledFilterEntry {
+  static const uint32_t empty = 0xFFFFFFFF;
+
+  uint32_t hash;
+  uint32_t node;  // empty if the slot is free
+  uint32_t key;   // the offset of the key in the character buffer
+  uint32_t keyLength;
+};
+
+// The header of the block that holds a compiled filter
+struct CompiledFilterData {
+  // Two nodes are shared by all the levels
+  static const uint32_t allowNothing = 0;
+  static const uint32_t allowAll = 1;  // "true" allows recursively
+
+  CompiledFilterNode* nodes;
+  CompiledFilterEntry* entries;
+  char* keys;
+  uint32_t root;
+};
+
+// Converts a filter document into a CompiledFilterData.
+// The same code runs twice: the first time to count the nodes, the entries,
+// and the characters; the second time to fill the block.
+class CompiledFilterBuilder {
+ public:
+  explicit CompiledFilterBuilder(CompiledFilterData* data = nullptr)
+      : data_(data) {}
+
+  uint32_t build(JsonVariantConst filter) {
+    nodeCount_ = 2;
+    entryCount_ = 0;
+    keyCount_ = 0;
+    if (data_) {
+      data_->nodes[CompiledFilterData::allowNothing] = {
+          CompiledFilterData::allowNothing, CompiledFilterData::allowNothing,
+          0, 0, 0};
+      data_->nodes[CompiledFilterData::allowAll] = {
+          CompiledFilterData::allowAll, CompiledFilterData::allowAll, 0, 0,
+          CompiledFilterNode::allowFlag | CompiledFilterNode::allowArrayFlag |
+              CompiledFilterNode::allowObjectFlag |
+              CompiledFilterNode::allowValueFlag};
+    }
+    return compile(filter);
+  }
+
+  uint32_t nodeCount() const {
+    return nodeCount_;
+  }
+
+  uint32_t entryCount() const {
+    return entryCount_;
+  }
+
+  uint32_t keyCount() const {
+    return keyCount_;
+  }
+
+ private:
+  uint32_t compile(JsonVariantConst filter) {
+    if (filter == true)
+      return CompiledFilterData::allowAll;
+
+    // use the predicates of the interpreted filter to get the same behavior
+    DeserializationOption::Filter interpreted(filter);
+    if (!interpreted.allow())
+      return CompiledFilterData::allowNothing;
+
+    uint32_t id = nodeCount_++;
+
+    JsonObjectConst object = filter.as<JsonObjectConst>();
+    uint32_t memberCount = 0;
+    for (JsonPairConst member : object) {
+      if (!member.value().isNull())
+        memberCount++;
+    }
+
+    // keep the load factor under 50%, so the probes are short
+    uint32_t tableSize = 0;
+    if (memberCount) {
+      tableSize = 1;
+      while (tableSize < 2 * memberCount)
+        tableSize *= 2;
+    }
+    uint32_t table = entryCount_;
+    entryCount_ += tableSize;
+    if (data_) {
+      for (uint32_t i = 0; i < tableSize; i++)
+        data_->entries[table + i].node = CompiledFilterEntry::empty;
+    }
+
+    uint32_t wildcard = compile(filter["*"]);
+    JsonVariantConst firstElement = filter[0];
+    uint32_t element =
+        firstElement.isNull() ? wildcard : compile(firstElement);
+
+    for (JsonPairConst member : object) {
+      // a null member falls back to the wildcard, like a missing one
+      if (member.value().isNull() || member.key() == "*")
+        continue;
+      uint32_t child = compile(member.value());
+      addMember(table, tableSize, member.key(), child);
+    }
+
+    if (data_) {
+      uint8_t flags = CompiledFilterNode::allowFlag;
+      if (interpreted.allowArray())
+        flags |= CompiledFilterNode::allowArrayFlag;
+      if (interpreted.allowObject())
+        flags |= CompiledFilterNode::allowObjectFlag;
+      if (interpreted.allowValue())
+        flags |= CompiledFilterNode::allowValueFlag;
+      data_->nodes[id] = {element, wildcard, table, tableSize, flags};
+    }
+
+    return id;
+  }
+
+  void addMember(uint32_t table, uint32_t tableSize, JsonString key,
+                 uint32_t node) {
+    auto adaptedKey = adaptString(key);
+    uint32_t keyLength = static_cast<uint32_t>(key.size());
+
+    if (!data_) {
+      keyCount_ += keyLength;
+      return;
+    }
+
+    uint32_t hash = stringHash(adaptedKey);
+    uint32_t mask = tableSize - 1;
+    for (uint32_t i = hash & mask;; i = (i + 1) & mask) {
+      CompiledFilterEntry& entry = data_->entries[table + i];
+      if (entry.node == CompiledFilterEntry::empty) {
+        stringGetChars(adaptedKey, data_->keys + keyCount_, keyLength);
+        entry = {hash, node, keyCount_, keyLength};
+        keyCount_ += keyLength;
+        return;
+      }
+      // like the interpreted filter, keep the first of the duplicate keys
+      if (entry.hash == hash &&
+          stringEquals(adaptedKey,
+                       adaptString(data_->keys + entry.key, entry.keyLength)))
+        return;
+    }
+  }
+
+  CompiledFilterData* data_;
+  uint32_t nodeCount_ = 0;
+  uint32_t entryCount_ = 0;
+  uint32_t keyCount_ = 0;
+};
+
+// The position in a compiled filter, passed to the deserializers as TFilter
+class CompiledFilterCursor {
+ public:
+  CompiledFilterCursor(const CompiledFilterData* data, uint32_t node)
+      : data_(data), node_(node) {}
+
+  // Returns the cursor at the root of the filter
+  static CompiledFilterCursor root(
+      const DeserializationOption::CompiledFilter& filter);
+
+  bool allow() const {
+    return hasFlag(CompiledFilterNode::allowFlag);
+  }
+
+  bool allowArray() const {
+    return hasFlag(CompiledFilterNode::allowArrayFlag);
+  }
+
+  bool allowObject() const {
+    return hasFlag(CompiledFilterNode::allowObjectFlag);
+  }
+
+  bool allowValue() const {
+    return hasFlag(CompiledFilterNode::allowValueFlag);
+  }
+
+  // The deserializers only pass 0, which selects the filter of the elements
+  template <typename TIndex>
+  enable_if_t<is_integral<TIndex>::value, CompiledFilterCursor> operator[](
+      const TIndex&) const {
+    if (!data_)
+      return *this;
+    return CompiledFilterCursor(data_, data_->nodes[node_].element);
+  }
+
+  template <typename TKey>
+  enable_if_t<!is_integral<TKey>::value, CompiledFilterCursor> operator[](
+      const TKey& key) const {
+    if (!data_)
+      return *this;
+    return CompiledFilterCursor(data_, findMember(adaptString(key)));
+  }
+
+ private:
+  bool hasFlag(uint8_t flag) const {
+    return data_ && (data_->nodes[node_].flags & flag) != 0;
+  }
+
+  template <typename TAdaptedString>
+  uint32_t findMember(TAdaptedString key) const {
+    const CompiledFilterNode& node = data_->nodes[node_];
+    if (node.tableSize == 0 || key.isNull())
+      return node.wildcard;
+    uint32_t hash = stringHash(key);
+    uint32_t mask = node.tableSize - 1;
+    for (uint32_t i = hash & mask;; i = (i + 1) & mask) {
+      const CompiledFilterEntry& entry = data_->entries[node.table + i];
+      if (entry.node == CompiledFilterEntry::empty)
+        return node.wildcard;
+      if (entry.hash == hash &&
+          stringEquals(key,
+                       adaptString(data_->keys + entry.key, entry.keyLength)))
+        return entry.node;
+    }
+  }
+
+  const CompiledFilterData* data_;
+  uint32_t node_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+namespace DeserializationOption {
+// An immutable copy of a filter document, with a hash table per level.
+// With a wide filter, each key of the input costs one lookup instead of a scan
+// of the filter's members.
+// It doesn't depend on the filter document, which can be destroyed.
+class CompiledFilter {
+ public:
+  CompiledFilter() {}
+
+  explicit CompiledFilter(
+      JsonVariantConst filter,
+      Allocator* allocator = detail::DefaultAllocator::instance())
+      : allocator_(allocator) {
+    using namespace detail;
+
+    CompiledFilterBuilder counter;
+    counter.build(filter);
+
+    // a single block: the header, the nodes, the entries, and the keys
+    size_t nodesOffset = sizeof(CompiledFilterData);
+    size_t entriesOffset =
+        nodesOffset + counter.nodeCount() * sizeof(CompiledFilterNode);
+    size_t keysOffset =
+        entriesOffset + counter.entryCount() * sizeof(CompiledFilterEntry);
+    char* block = reinterpret_cast<char*>(
+        allocator_->allocate(keysOffset + counter.keyCount()));
+    if (!block)
+      return;
+
+    data_ = reinterpret_cast<CompiledFilterData*>(block);
+    data_->nodes = reinterpret_cast<CompiledFilterNode*>(block + nodesOffset);
+    data_->entries =
+        reinterpret_cast<CompiledFilterEntry*>(block + entriesOffset);
+    data_->keys = block + keysOffset;
+    data_->root = CompiledFilterBuilder(data_).build(filter);
+  }
+
+  CompiledFilter(CompiledFilter&& src)
+      : allocator_(src.allocator_), data_(src.data_) {
+    src.data_ = nullptr;
+  }
+
+  CompiledFilter& operator=(CompiledFilter&& src) {
+    detail::swap_(allocator_, src.allocator_);
+    detail::swap_(data_, src.data_);
+    return *this;
+  }
+
+  CompiledFilter(const CompiledFilter&) = delete;
+  CompiledFilter& operator=(const CompiledFilter&) = delete;
+
+  ~CompiledFilter() {
+    if (data_)
+      allocator_->deallocate(data_);
+  }
+
+  // Returns true if the allocation failed.
+  // In that case, the filter allows nothing.
+  bool overflowed() const {
+    return data_ == nullptr;
+  }
+
+ private:
+  friend class detail::CompiledFilterCursor;
+
+  Allocator* allocator_ = nullptr;
+  detail::CompiledFilterData* data_ = nullptr;
+};
+}  // namespace DeserializationOption
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+inline CompiledFilterCursor CompiledFilterCursor::root(
+    const DeserializationOption::CompiledFilter& filter) {
+  if (!filter.data_)  // allow nothing
+    return CompiledFilterCursor(nullptr, CompiledFilterData::allowNothing);
+  return CompiledFilterCursor(filter.data_, filter.data_->root);
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Compiles a filter document for deserializeJson() and deserializeMsgPack().
+// Pass the result instead of DeserializationOption::Filter when the same
+// filter is used several times.
+inline DeserializationOption::CompiledFilter compileFilter(
+    JsonVariantConst filter,
+    Allocator* allocator = detail::DefaultAllocator::instance()) {
+  return DeserializationOption::CompiledFilter(filter, allocator);
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
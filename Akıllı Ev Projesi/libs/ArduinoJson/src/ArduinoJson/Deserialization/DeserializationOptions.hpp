@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <ArduinoJson/Deserialization/CompiledFilter.hpp>
 #include <ArduinoJson/Deserialization/Filter.hpp>
 #include <ArduinoJson/Deserialization/NestingLimit.hpp>
 
@@ -27,6 +28,18 @@ inline DeserializationOptions<TFilter> makeDeserializationOptions(
   return {filter, nestingLimit};
 }
 
+inline DeserializationOptions<CompiledFilterCursor> makeDeserializationOptions(
+    const DeserializationOption::CompiledFilter& filter,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  return {CompiledFilterCursor::root(filter), nestingLimit};
+}
+
+inline DeserializationOptions<CompiledFilterCursor> makeDeserializationOptions(
+    DeserializationOption::NestingLimit nestingLimit,
+    const DeserializationOption::CompiledFilter& filter) {
+  return {CompiledFilterCursor::root(filter), nestingLimit};
+}
+
 inline DeserializationOptions<AllowAllFilter> makeDeserializationOptions(
     DeserializationOption::NestingLimit nestingLimit = {}) {
   return {{}, nestingLimit};
@@ -72,6 +72,30 @@ struct AllowAllFilter {
     return AllowAllFilter();
   }
 };
+
+// Skips the whole value
+struct AllowNothingFilter {
+  bool allow() const {
+    return false;
+  }
+
+  bool allowArray() const {
+    return false;
+  }
+
+  bool allowObject() const {
+    return false;
+  }
+
+  bool allowValue() const {
+    return false;
+  }
+
+  template <typename TKey>
+  AllowNothingFilter operator[](const TKey&) const {
+    return AllowNothingFilter();
+  }
+};
 }  // namespace detail
 
 ARDUINOJSON_END_PUBLIC_NAMESPACE
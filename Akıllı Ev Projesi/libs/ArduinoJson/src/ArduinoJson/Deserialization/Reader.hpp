@@ -5,6 +5,7 @@
 #pragma once
 
 #include <ArduinoJson/Namespace.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
 #include <ArduinoJson/Polyfills/utility.hpp>
 
 #include <stdlib.h>  // for size_t
@@ -40,10 +41,12 @@ struct BoundedReader {
 ARDUINOJSON_END_PRIVATE_NAMESPACE
 
 #include <ArduinoJson/Deserialization/Readers/IteratorReader.hpp>
+#include <ArduinoJson/Deserialization/Readers/InSituReader.hpp>
 #include <ArduinoJson/Deserialization/Readers/RamReader.hpp>
 #include <ArduinoJson/Deserialization/Readers/VariantReader.hpp>
 
 #if ARDUINOJSON_ENABLE_ARDUINO_STREAM
+#  include <ArduinoJson/Deserialization/Readers/BufferedStreamReader.hpp>
 #  include <ArduinoJson/Deserialization/Readers/ArduinoStreamReader.hpp>
 #endif
 
@@ -71,4 +74,14 @@ BoundedReader<TChar*> makeReader(TChar* input, size_t inputSize) {
   return BoundedReader<TChar*>{input, inputSize};
 }
 
+// Readers that expose their buffer with position(), end() and seek().
+// end() returns nullptr if the buffer is null-terminated.
+template <typename TReader, typename = void>
+struct IsContiguousReader : false_type {};
+
+template <typename TReader>
+struct IsContiguousReader<
+    TReader, enable_if_t<is_same<decltype(declval<const TReader>().position()),
+                                 const char*>::value>> : true_type {};
+
 ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -8,23 +8,41 @@
 
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
+// Stream can't take characters back, so we can't read ahead of the parser.
+// This reader still makes one virtual call to read() per character; it only
+// skips the timeout of readBytes() while characters are available(), and
+// waits with readBytes() when none is.
+// Serial, WiFiClient, EthernetClient and the other core streams don't
+// implement unread(), so they are never buffered automatically (see
+// BufferedStreamReader.hpp). To read them by blocks, wrap them in a
+// BufferedStream (see BufferedStream.hpp).
 template <typename TSource>
-struct Reader<TSource, enable_if_t<is_base_of<Stream, TSource>::value>> {
+struct Reader<TSource, enable_if_t<is_base_of<Stream, TSource>::value &&
+                                   !CanUnread<TSource>::value>> {
  public:
-  explicit Reader(Stream& stream) : stream_(&stream) {}
+  explicit Reader(Stream& stream) : stream_(&stream), available_(0) {}
 
   int read() {
+    if (available_ > 0 || (available_ = stream_->available()) > 0) {
+      available_--;
+      int c = stream_->read();
+      if (c >= 0)
+        return c;
+      available_ = 0;
+    }
     // don't use stream_->read() as it ignores the timeout
     char c;
     return stream_->readBytes(&c, 1) ? static_cast<unsigned char>(c) : -1;
   }
 
   size_t readBytes(char* buffer, size_t length) {
+    available_ = 0;
     return stream_->readBytes(buffer, length);
   }
 
  private:
   Stream* stream_;
+  int available_;
 };
 
 ARDUINOJSON_END_PRIVATE_NAMESPACE
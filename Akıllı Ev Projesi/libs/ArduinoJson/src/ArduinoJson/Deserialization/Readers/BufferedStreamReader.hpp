@@ -0,0 +1,84 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <Arduino.h>
+
+#include <ArduinoJson/Polyfills/assert.hpp>
+
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// A Stream that can take characters back with unread(const char*, size_t).
+// The characters must be returned before the ones still in the stream.
+template <typename TSource, typename = void>
+struct CanUnread : false_type {};
+
+template <typename TSource>
+struct CanUnread<TSource,
+                 void_t<decltype(declval<TSource&>().unread(
+                     declval<const char*>(), declval<size_t>()))>>
+    : true_type {};
+
+// Reads the stream by blocks of ARDUINOJSON_READER_BUFFER_SIZE characters,
+// and gives the characters the parser didn't consume back to the stream
+// when it's destroyed, so the next document can be read from the same stream.
+// A block is limited to the characters available(), so it waits for the
+// timeout of readBytes() only when the receive buffer is empty.
+template <typename TSource>
+struct Reader<TSource, enable_if_t<is_base_of<Stream, TSource>::value &&
+                                   CanUnread<TSource>::value>> {
+ public:
+  explicit Reader(TSource& stream) : stream_(&stream), begin_(0), end_(0) {}
+
+  // The deserializer copies the reader before reading, never after
+  Reader(const Reader& src) : stream_(src.stream_), begin_(0), end_(0) {
+    ARDUINOJSON_ASSERT(src.begin_ == src.end_);
+  }
+
+  Reader& operator=(const Reader&) = delete;
+
+  ~Reader() {
+    if (begin_ < end_)
+      stream_->unread(buffer_ + begin_, end_ - begin_);
+  }
+
+  int read() {
+    if (begin_ == end_ && !refill())
+      return -1;
+    return static_cast<unsigned char>(buffer_[begin_++]);
+  }
+
+  size_t readBytes(char* buffer, size_t length) {
+    size_t n = end_ - begin_;
+    if (n > length)
+      n = length;
+    memcpy(buffer, buffer_ + begin_, n);
+    begin_ += n;
+    if (n < length)
+      n += stream_->readBytes(buffer + n, length - n);
+    return n;
+  }
+
+ private:
+  bool refill() {
+    size_t size = 1;
+    int available = stream_->available();
+    if (available > 0)
+      size = static_cast<size_t>(available);
+    if (size > sizeof(buffer_))
+      size = sizeof(buffer_);
+    begin_ = 0;
+    end_ = stream_->readBytes(buffer_, size);
+    return end_ > 0;
+  }
+
+  TSource* stream_;
+  size_t begin_, end_;
+  char buffer_[ARDUINOJSON_READER_BUFFER_SIZE];
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -0,0 +1,25 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Reads a mutable buffer that the deserializer is allowed to overwrite
+class InSituReader : public IteratorReader<const char*> {
+ public:
+  InSituReader(char* buffer, size_t size)
+      : IteratorReader<const char*>(buffer, buffer + size), buffer_(buffer) {}
+
+  // Returns the last character that was read
+  char* lastRead() const {
+    ARDUINOJSON_ASSERT(position() > buffer_);
+    return buffer_ + (position() - buffer_ - 1);
+  }
+
+ private:
+  char* buffer_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
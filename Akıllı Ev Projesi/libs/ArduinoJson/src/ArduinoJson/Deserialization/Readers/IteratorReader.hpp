@@ -29,14 +29,58 @@ class IteratorReader {
       buffer[i++] = *ptr_++;
     return i;
   }
+
+  // Lets the parser scan contiguous inputs in bulk
+  TIterator position() const {
+    return ptr_;
+  }
+
+  TIterator end() const {
+    return end_;
+  }
+
+  void seek(TIterator ptr) {
+    ptr_ = ptr;
+  }
+};
+
+// Containers that store their characters contiguously are read through a
+// pointer, so that the parser can scan them in bulk
+template <typename TSource, typename Enable = void>
+struct ContainerIterator {
+  using type = typename TSource::const_iterator;
+
+  static type begin(const TSource& source) {
+    return source.begin();
+  }
+
+  static type end(const TSource& source) {
+    return source.end();
+  }
+};
+
+template <typename TSource>
+struct ContainerIterator<
+    TSource, enable_if_t<is_same<decltype(declval<const TSource>().data()),
+                                 const char*>::value>> {
+  using type = const char*;
+
+  static type begin(const TSource& source) {
+    return source.data();
+  }
+
+  static type end(const TSource& source) {
+    return source.data() + source.size();
+  }
 };
 
 template <typename TSource>
 struct Reader<TSource, void_t<typename TSource::const_iterator>>
-    : IteratorReader<typename TSource::const_iterator> {
+    : IteratorReader<typename ContainerIterator<TSource>::type> {
   explicit Reader(const TSource& source)
-      : IteratorReader<typename TSource::const_iterator>(source.begin(),
-                                                         source.end()) {}
+      : IteratorReader<typename ContainerIterator<TSource>::type>(
+            ContainerIterator<TSource>::begin(source),
+            ContainerIterator<TSource>::end(source)) {}
 };
 
 ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -35,6 +35,19 @@ struct Reader<TSource*, enable_if_t<IsCharOrVoid<TSource>::value>> {
       buffer[i] = *ptr_++;
     return length;
   }
+
+  // Lets the parser scan the input in bulk
+  const char* position() const {
+    return ptr_;
+  }
+
+  const char* end() const {
+    return nullptr;  // unknown, the input must be null-terminated
+  }
+
+  void seek(const char* ptr) {
+    ptr_ = ptr;
+  }
 };
 
 template <typename TSource>
@@ -8,21 +8,52 @@
 
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
+// Reads straight from the std::streambuf, which is already a block buffer:
+// this avoids constructing a sentry for each character, and the characters
+// after the document remain in the stream.
+// Like std::istream::get(), it flushes tie() (once per document), sets eofbit
+// and failbit at the end of the input, and doesn't read a stream that is not
+// good(). Unlike get(), it doesn't update gcount().
 template <typename TSource>
 struct Reader<TSource, enable_if_t<is_base_of<std::istream, TSource>::value>> {
  public:
-  explicit Reader(std::istream& stream) : stream_(&stream) {}
+  explicit Reader(std::istream& stream) : stream_(&stream) {
+    std::istream::sentry sentry(stream, true);  // flushes tie()
+  }
 
   int read() {
-    return stream_->get();
+    auto buf = streambuf();
+    if (!buf)
+      return -1;
+    int c = buf->sbumpc();
+    if (c == std::char_traits<char>::eof()) {
+      stream_->setstate(std::ios::eofbit | std::ios::failbit);
+      return -1;
+    }
+    return c;
   }
 
   size_t readBytes(char* buffer, size_t length) {
-    stream_->read(buffer, static_cast<std::streamsize>(length));
-    return static_cast<size_t>(stream_->gcount());
+    auto buf = streambuf();
+    if (!buf)
+      return 0;
+    auto n = buf->sgetn(buffer, std::streamsize(length));
+    if (n < std::streamsize(length))
+      stream_->setstate(std::ios::eofbit | std::ios::failbit);
+    return size_t(n);
   }
 
  private:
+  // Returns null if the stream can't be read, like the sentry does
+  std::streambuf* streambuf() {
+    auto buf = stream_->rdbuf();
+    if (!buf || !stream_->good()) {
+      stream_->setstate(std::ios::failbit);
+      return nullptr;
+    }
+    return buf;
+  }
+
   std::istream* stream_;
 };
 
@@ -7,6 +7,7 @@
 #include <ArduinoJson/Deserialization/DeserializationError.hpp>
 #include <ArduinoJson/Deserialization/DeserializationOptions.hpp>
 #include <ArduinoJson/Deserialization/Reader.hpp>
+#include <ArduinoJson/Memory/ResourceManager.hpp>
 #include <ArduinoJson/Polyfills/utility.hpp>
 
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
@@ -29,6 +30,15 @@ using is_deserialize_destination =
     bool_constant<is_base_of<JsonDocument, remove_cv_t<T>>::value ||
                   IsVariant<T>::value>;
 
+template <typename TDestination>
+inline void clearDestination(TDestination& dst) {
+  dst.clear();
+}
+
+inline void clearDestination(JsonDocument& doc) {
+  doc.clear(VariantAttorney::getResourceManager(doc)->keepsCapacity());
+}
+
 template <typename TDestination>
 inline void shrinkJsonDocument(TDestination&) {
   // no-op by default
@@ -36,7 +46,9 @@ inline void shrinkJsonDocument(TDestination&) {
 
 #if ARDUINOJSON_AUTO_SHRINK
 inline void shrinkJsonDocument(JsonDocument& doc) {
-  doc.shrinkToFit();
+  // don't release the memory kept by reserve() or clear(true)
+  if (!VariantAttorney::getResourceManager(doc)->keepsCapacity())
+    doc.shrinkToFit();
 }
 #endif
 
@@ -48,7 +60,7 @@ DeserializationError doDeserialize(TDestination&& dst, TReader reader,
   if (!data)
     return DeserializationError::NoMemory;
   auto resources = VariantAttorney::getResourceManager(dst);
-  dst.clear();
+  clearDestination(dst);
   auto err = TDeserializer<TReader>(resources, reader)
                  .parse(*data, options.filter, options.nestingLimit);
   shrinkJsonDocument(dst);
@@ -61,7 +73,7 @@ template <
     enable_if_t<  // issue #1897
         !is_integral<typename first_or_void<Args...>::type>::value, int> = 0>
 DeserializationError deserialize(TDestination&& dst, TStream&& input,
-                                 Args... args) {
+                                 const Args&... args) {
   return doDeserialize<TDeserializer>(
       dst, makeReader(detail::forward<TStream>(input)),
       makeDeserializationOptions(args...));
@@ -71,9 +83,19 @@ template <template <typename> class TDeserializer, typename TDestination,
           typename TChar, typename Size, typename... Args,
           enable_if_t<is_integral<Size>::value, int> = 0>
 DeserializationError deserialize(TDestination&& dst, TChar* input,
-                                 Size inputSize, Args... args) {
+                                 Size inputSize, const Args&... args) {
   return doDeserialize<TDeserializer>(dst, makeReader(input, size_t(inputSize)),
                                       makeDeserializationOptions(args...));
 }
 
+template <template <typename> class TDeserializer, typename THandler,
+          typename TReader>
+DeserializationError deserializeEvents(
+    THandler& handler, TReader reader,
+    DeserializationOption::NestingLimit nestingLimit) {
+  ResourceManager resources;  // for the string buffer and the current value
+  return TDeserializer<TReader>(&resources, reader)
+      .parseEvents(handler, nestingLimit);
+}
+
 ARDUINOJSON_END_PRIVATE_NAMESPACE
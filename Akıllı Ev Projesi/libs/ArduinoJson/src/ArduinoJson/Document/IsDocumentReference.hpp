@@ -0,0 +1,27 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Array/JsonArray.hpp>
+#include <ArduinoJson/Object/JsonObject.hpp>
+#include <ArduinoJson/Variant/JsonVariant.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// The types that point to the memory of a JsonDocument, and therefore can't
+// be returned from a temporary one
+template <typename T>
+struct IsDocumentReference
+    : integral_constant<bool, is_same<T, const char*>::value ||
+                                  is_same<T, char*>::value ||
+                                  is_same<T, JsonString>::value ||
+                                  is_same<T, JsonVariantConst>::value ||
+                                  is_same<T, JsonVariant>::value ||
+                                  is_same<T, JsonArrayConst>::value ||
+                                  is_same<T, JsonArray>::value ||
+                                  is_same<T, JsonObjectConst>::value ||
+                                  is_same<T, JsonObject>::value> {};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
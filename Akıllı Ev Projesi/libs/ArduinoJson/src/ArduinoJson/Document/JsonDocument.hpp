@@ -64,7 +64,8 @@ class JsonDocument : public detail::VariantOperators<const JsonDocument&> {
     return resources_.allocator();
   }
 
-  // Reduces the capacity of the memory pool to match the current usage.
+  // Reduces the capacity of the memory pool to match the current usage, and
+  // releases the memory kept by reserve() or clear(true).
   // https://arduinojson.org/v7/api/jsondocument/shrinktofit/
   void shrinkToFit() {
     resources_.shrinkToFit();
@@ -85,12 +86,23 @@ class JsonDocument : public detail::VariantOperators<const JsonDocument&> {
   }
 
   // Empties the document and resets the memory pool
+  // If keepCapacity is true, the memory stays allocated for the next values,
+  // and deserializeJson() keeps it too.
   // https://arduinojson.org/v7/api/jsondocument/clear/
-  void clear() {
-    resources_.clear();
+  void clear(bool keepCapacity = false) {
+    resources_.clear(keepCapacity);
     data_.reset();
   }
 
+  // Allocates the memory for the specified number of values and bytes of
+  // strings, so that filling the document doesn't call the allocator.
+  // Each array element takes one value; each object member takes two.
+  // The memory stays allocated until clear() or shrinkToFit().
+  // Returns false if the allocation fails.
+  bool reserve(size_t values, size_t stringBytes = 0) {
+    return resources_.reserve(values, stringBytes);
+  }
+
   // Returns true if the root is of the specified type.
   // https://arduinojson.org/v7/api/jsondocument/is/
   template <typename T>
@@ -0,0 +1,307 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Configuration.hpp>
+
+#if ARDUINOJSON_ENABLE_DOCUMENT_POOL
+
+#  include <ArduinoJson/Document/JsonDocument.hpp>
+#  include <ArduinoJson/Memory/MonotonicArenaAllocator.hpp>
+
+#  include <atomic>
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// A thread-safe pool of documents, for programs that parse on several threads.
+// The documents keep their memory between two uses, so once the pool is warm,
+// the threads don't call the allocator anymore.
+// The idle documents are spread over several shards. Each thread has a home
+// shard and only looks at the other ones when its own is empty or full. Each
+// shard starts on its own cache line, so the threads rarely touch the same
+// cache lines. A slot of a shard is an atomic pointer that the threads
+// exchange without lock.
+// The pool must outlive the documents it hands out.
+class JsonDocumentPool {
+  struct Entry {
+    Entry(Allocator* allocator, size_t arenaBlockSize)
+        : arena(arenaBlockSize, allocator),
+          doc(arenaBlockSize ? &arena : allocator) {}
+
+    // Placement new
+    static void* operator new(size_t, void* p) noexcept {
+      return p;
+    }
+
+    static void operator delete(void*, void*) noexcept {}
+
+    MonotonicArenaAllocator arena;  // only used if arenaBlockSize > 0
+    JsonDocument doc;
+  };
+
+  struct Slot {
+    Slot() : entry(nullptr) {}
+
+    // Placement new
+    static void* operator new(size_t, void* p) noexcept {
+      return p;
+    }
+
+    static void operator delete(void*, void*) noexcept {}
+
+    std::atomic<Entry*> entry;
+  };
+
+ public:
+  struct Options {
+    // The capacity reserved in each document (see JsonDocument::reserve())
+    size_t values = 0;
+    size_t stringBytes = 0;
+
+    // If not 0, each document allocates from its own MonotonicArenaAllocator,
+    // whose blocks are kept between two uses of the document.
+    size_t arenaBlockSize = 0;
+
+    // The number of documents the pool keeps; the other ones are destroyed
+    size_t maxIdleDocuments = 64;
+
+    // The documents are split evenly between the shards, so there are no
+    // more shards than maxIdleDocuments
+    size_t shards = 16;
+  };
+
+  // A document borrowed from the pool.
+  // It goes back to the pool when the handle is destroyed or reset.
+  class Handle {
+   public:
+    Handle() {}
+
+    Handle(Handle&& src) : pool_(src.pool_), entry_(src.entry_) {
+      src.entry_ = nullptr;
+    }
+
+    Handle& operator=(Handle&& src) {
+      detail::swap_(pool_, src.pool_);
+      detail::swap_(entry_, src.entry_);
+      return *this;
+    }
+
+    ~Handle() {
+      reset();
+    }
+
+    // Returns null if the pool couldn't allocate the document
+    JsonDocument* get() const {
+      return entry_ ? &entry_->doc : nullptr;
+    }
+
+    JsonDocument& operator*() const {
+      ARDUINOJSON_ASSERT(entry_ != nullptr);
+      return entry_->doc;
+    }
+
+    JsonDocument* operator->() const {
+      ARDUINOJSON_ASSERT(entry_ != nullptr);
+      return &entry_->doc;
+    }
+
+    explicit operator bool() const {
+      return entry_ != nullptr;
+    }
+
+    // Returns the document to the pool
+    void reset() {
+      if (entry_)
+        pool_->release(entry_);
+      entry_ = nullptr;
+    }
+
+   private:
+    friend class JsonDocumentPool;
+
+    Handle(JsonDocumentPool* pool, Entry* entry) : pool_(pool), entry_(entry) {}
+
+    JsonDocumentPool* pool_ = nullptr;
+    Entry* entry_ = nullptr;
+  };
+
+  JsonDocumentPool() : JsonDocumentPool(Options()) {}
+
+  explicit JsonDocumentPool(
+      const Options& options,
+      Allocator* allocator = detail::DefaultAllocator::instance())
+      : options_(options),
+        allocator_(allocator),
+        shardCount_(options.shards ? options.shards : 1) {
+    size_t maxIdleDocuments = options.maxIdleDocuments;
+    if (maxIdleDocuments == 0)
+      return;
+    if (shardCount_ > maxIdleDocuments)
+      shardCount_ = maxIdleDocuments;
+
+    // round the shards up to a multiple of the cache line size
+    const size_t slotsPerLine = cacheLineSize / sizeof(Slot);
+    size_t largestShard = (maxIdleDocuments + shardCount_ - 1) / shardCount_;
+    shardStride_ =
+        (largestShard + slotsPerLine - 1) / slotsPerLine * slotsPerLine;
+
+    // allocate one more cache line to align the first shard
+    block_ = allocator_->allocate(shardCount_ * shardStride_ * sizeof(Slot) +
+                                  cacheLineSize - 1);
+    if (!block_) {  // the pool works, but doesn't keep the documents
+      shardStride_ = 0;
+      return;
+    }
+    size_t address = reinterpret_cast<size_t>(block_);
+    slots_ = reinterpret_cast<Slot*>((address + cacheLineSize - 1) &
+                                     ~(cacheLineSize - 1));
+    for (size_t i = 0; i < shardCount_ * shardStride_; i++)
+      new (&slots_[i]) Slot();
+  }
+
+  JsonDocumentPool(const JsonDocumentPool&) = delete;
+  JsonDocumentPool& operator=(const JsonDocumentPool&) = delete;
+
+  ~JsonDocumentPool() {
+    if (!slots_)
+      return;
+    for (size_t i = 0; i < shardCount_ * shardStride_; i++) {
+      Entry* entry =
+          slots_[i].entry.exchange(nullptr, std::memory_order_acquire);
+      if (entry)
+        destroy(entry);
+      slots_[i].~Slot();
+    }
+    allocator_->deallocate(block_);
+  }
+
+  // Returns an empty document, recycled from a previous acquire() if possible.
+  // The handle is empty if the allocation fails.
+  Handle acquire() {
+    Entry* entry = take();
+    if (!entry)
+      entry = create();
+    return Handle(this, entry);
+  }
+
+  // Returns the number of documents waiting in the pool.
+  // The value is only a snapshot when other threads use the pool.
+  size_t idleDocuments() const {
+    size_t n = 0;
+    for (size_t i = 0; i < shardCount_ * shardStride_; i++) {
+      if (slots_[i].entry.load(std::memory_order_relaxed))
+        n++;
+    }
+    return n;
+  }
+
+ private:
+  static const size_t cacheLineSize = 64;
+
+  // Takes an idle document, starting with the shard of the current thread
+  Entry* take() {
+    size_t home = homeShard();
+    for (size_t i = 0; i < shardCount_; i++) {
+      size_t index = (home + i) % shardCount_;
+      Slot* shard = slots_ + index * shardStride_;
+      for (size_t j = 0; j < shardSize(index); j++) {
+        // read before exchanging to avoid writing in the other cache lines
+        if (!shard[j].entry.load(std::memory_order_relaxed))
+          continue;
+        Entry* entry =
+            shard[j].entry.exchange(nullptr, std::memory_order_acquire);
+        if (entry)
+          return entry;
+      }
+    }
+    return nullptr;
+  }
+
+  // Puts a document in an empty slot, starting with the shard of the current
+  // thread. Returns false if all the slots are taken.
+  bool put(Entry* entry) {
+    size_t home = homeShard();
+    for (size_t i = 0; i < shardCount_; i++) {
+      size_t index = (home + i) % shardCount_;
+      Slot* shard = slots_ + index * shardStride_;
+      for (size_t j = 0; j < shardSize(index); j++) {
+        Entry* expected = nullptr;
+        if (shard[j].entry.load(std::memory_order_relaxed))
+          continue;
+        if (shard[j].entry.compare_exchange_strong(
+                expected, entry, std::memory_order_release,
+                std::memory_order_relaxed))
+          return true;
+      }
+    }
+    return false;
+  }
+
+  void release(Entry* entry) {
+    // empty the document in the thread that used it
+    if (options_.arenaBlockSize) {
+      entry->doc.clear();
+      entry->arena.reset();
+      reserve(entry);
+    } else {
+      entry->doc.clear(true);
+    }
+
+    if (!put(entry))
+      destroy(entry);
+  }
+
+  Entry* create() {
+    void* p = allocator_->allocate(sizeof(Entry));
+    if (!p)
+      return nullptr;
+    auto entry = new (p) Entry(allocator_, options_.arenaBlockSize);
+    reserve(entry);
+    return entry;
+  }
+
+  void reserve(Entry* entry) {
+    // if it fails, the document allocates on demand, like any other
+    if (options_.values || options_.stringBytes)
+      entry->doc.reserve(options_.values, options_.stringBytes);
+  }
+
+  void destroy(Entry* entry) {
+    entry->~Entry();
+    allocator_->deallocate(entry);
+  }
+
+  // Returns the number of slots used in a shard. The first shards take the
+  // remainder, so that the pool keeps exactly maxIdleDocuments.
+  size_t shardSize(size_t shard) const {
+    if (!slots_)
+      return 0;
+    size_t n = options_.maxIdleDocuments;
+    return n / shardCount_ + (shard < n % shardCount_ ? 1 : 0);
+  }
+
+  size_t homeShard() const {
+    return threadIndex() % shardCount_;
+  }
+
+  // Numbers the threads in the order they first use a pool
+  static size_t threadIndex() {
+    static std::atomic<size_t> threadCount(0);
+    static thread_local size_t index =
+        threadCount.fetch_add(1, std::memory_order_relaxed);
+    return index;
+  }
+
+  Options options_;
+  Allocator* allocator_;
+  void* block_ = nullptr;
+  Slot* slots_ = nullptr;  // block_ aligned on a cache line
+  size_t shardCount_;
+  size_t shardStride_ = 0;  // the shard size rounded up to a cache line
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
+
+#endif
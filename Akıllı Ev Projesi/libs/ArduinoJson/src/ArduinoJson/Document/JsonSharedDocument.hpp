@@ -0,0 +1,198 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Document/JsonDocument.hpp>
+
+#if ARDUINOJSON_ENABLE_ATOMIC
+#  include <atomic>
+#endif
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// The block that holds a shared document and the number of handles
+struct SharedDocumentData {
+  explicit SharedDocumentData(JsonDocument&& src)
+      : allocator(src.allocator()), doc(detail::move(src)) {}
+
+  // Placement new
+  static void* operator new(size_t, void* p) noexcept {
+    return p;
+  }
+
+  static void operator delete(void*, void*) noexcept {}
+
+#if ARDUINOJSON_ENABLE_ATOMIC
+  std::atomic<size_t> references{1};
+
+  void addReference() {
+    references.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Returns true if it was the last reference
+  bool removeReference() {
+    return references.fetch_sub(1, std::memory_order_acq_rel) == 1;
+  }
+
+  size_t referenceCount() const {
+    return references.load(std::memory_order_acquire);
+  }
+#else
+  size_t references = 1;
+
+  void addReference() {
+    references++;
+  }
+
+  bool removeReference() {
+    return --references == 0;
+  }
+
+  size_t referenceCount() const {
+    return references;
+  }
+#endif
+
+  // The allocator of the block; unshare() can move the document out
+  Allocator* allocator;
+  JsonDocument doc;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// A frozen document that several owners can share.
+// Copying a JsonSharedDocument is O(1): it only increments a reference count,
+// so a message can be handed to many consumers without copying it. The
+// document can't be modified while it's shared; call unshare() to get a
+// JsonDocument, which is only copied if another handle still uses it.
+// The sharing is for the whole document: there is no handle on a subtree,
+// and unshare() copies the entire document, even to modify a single value.
+// With ARDUINOJSON_ENABLE_ATOMIC, the handles can be copied and destroyed on
+// several threads, and the threads can read the document at the same time
+// (unless ARDUINOJSON_ENABLE_OBJECT_INDEX or ARDUINOJSON_ENABLE_ARRAY_INDEX is
+// set, because the reads fill the caches of the indexes).
+class JsonSharedDocument {
+ public:
+  JsonSharedDocument() {}
+
+  // Freezes the document; src is left empty.
+  // The block that holds the document comes from the document's allocator; if
+  // the allocation fails, the shared document is null and src is unchanged.
+  explicit JsonSharedDocument(JsonDocument&& src) {
+    void* p = src.allocator()->allocate(sizeof(detail::SharedDocumentData));
+    if (p)
+      data_ = new (p) detail::SharedDocumentData(detail::move(src));
+  }
+
+  JsonSharedDocument(const JsonSharedDocument& src) : data_(src.data_) {
+    if (data_)
+      data_->addReference();
+  }
+
+  JsonSharedDocument(JsonSharedDocument&& src) : data_(src.data_) {
+    src.data_ = nullptr;
+  }
+
+  ~JsonSharedDocument() {
+    release();
+  }
+
+  JsonSharedDocument& operator=(JsonSharedDocument src) {
+    detail::swap_(data_, src.data_);
+    return *this;
+  }
+
+  // Stops using the document; destroys it if it was the last handle.
+  void release() {
+    if (data_ && data_->removeReference()) {
+      Allocator* allocator = data_->allocator;
+      data_->~SharedDocumentData();
+      allocator->deallocate(data_);
+    }
+    data_ = nullptr;
+  }
+
+  // Returns a mutable document with the same content, and releases this
+  // handle. If no other handle uses the document, it's moved out, without
+  // copy; otherwise, it's copied, and the other handles keep the original.
+  JsonDocument unshare() {
+    if (!data_)
+      return JsonDocument();
+    if (data_->referenceCount() == 1) {
+      JsonDocument doc(detail::move(data_->doc));
+      release();
+      return doc;
+    }
+    JsonDocument doc(data_->doc);
+    release();
+    return doc;
+  }
+
+  // Returns the number of handles that share the document.
+  size_t useCount() const {
+    return data_ ? data_->referenceCount() : 0;
+  }
+
+  // Returns a reference to the root value.
+  JsonVariantConst root() const {
+    return data_ ? data_->doc.as<JsonVariantConst>() : JsonVariantConst();
+  }
+
+  operator JsonVariantConst() const {
+    return root();
+  }
+
+  // Returns true if there is no document, or if the root is null.
+  bool isNull() const {
+    return root().isNull();
+  }
+
+  // Returns the number of elements or members of the root.
+  size_t size() const {
+    return root().size();
+  }
+
+  // Casts the root to the specified type.
+  template <typename T>
+  T as() const {
+    return root().as<T>();
+  }
+
+  // Returns true if the root is of the specified type.
+  template <typename T>
+  bool is() const {
+    return root().is<T>();
+  }
+
+  // Gets the root array's element at specified index.
+  template <typename T,
+            detail::enable_if_t<detail::is_integral<T>::value, int> = 0>
+  JsonVariantConst operator[](T index) const {
+    return root()[index];
+  }
+
+  // Gets the root object's member with specified key.
+  template <typename TString,
+            detail::enable_if_t<detail::IsString<TString>::value, int> = 0>
+  JsonVariantConst operator[](const TString& key) const {
+    return root()[key];
+  }
+
+  // Gets the root object's member with specified key.
+  template <typename TChar,
+            detail::enable_if_t<detail::IsString<TChar*>::value &&
+                                    !detail::is_const<TChar>::value,
+                                int> = 0>
+  JsonVariantConst operator[](TChar* key) const {
+    return root()[key];
+  }
+
+ private:
+  detail::SharedDocumentData* data_ = nullptr;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
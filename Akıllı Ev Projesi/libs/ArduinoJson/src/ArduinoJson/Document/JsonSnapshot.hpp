@@ -0,0 +1,720 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Deserialization/DeserializationError.hpp>
+#include <ArduinoJson/Deserialization/NestingLimit.hpp>
+#include <ArduinoJson/Document/JsonDocument.hpp>
+#include <ArduinoJson/Memory/HashTable.hpp>
+
+#include <string.h>  // memcpy, memset
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// A snapshot is the image of the slots and the strings of a document:
+//   - the header,
+//   - the root variant, in a slot,
+//   - the slots, in the order of their ids, as in the memory pools,
+//   - the strings, as StringNodes,
+//   - the relocations: the offsets of the variants that point to a string,
+//     sorted, so that each variant is relocated once.
+// In a saved image, the string pointers hold offsets from the beginning of the
+// image; the loader adds the address of the image.
+struct SnapshotHeader {
+  static const uint8_t currentVersion = 1;
+  static const uint16_t byteOrderMark = 0x0102;
+
+  enum : uint8_t {
+    useDouble = 1,
+    useLongLong = 2,
+    doublyLinked = 4,
+  };
+
+  char magic[4];  // "AJSN"
+  uint8_t version;
+  uint8_t pointerSize;
+  uint8_t slotIdSize;
+  uint8_t stringLengthSize;
+  uint16_t byteOrder;  // byteOrderMark, in the byte order of the writer
+  uint16_t slotSize;
+  uint8_t features;
+  uint8_t reserved[3];
+  uint32_t size;      // the size of the whole image
+  uint32_t checksum;  // see snapshotChecksum()
+  uint32_t slotCount;
+  uint32_t stringsOffset;
+  uint32_t relocationsOffset;
+  uint32_t relocationCount;
+  size_t base;  // the address the strings point to, 0 in a saved image
+
+  static uint8_t currentFeatures() {
+    return uint8_t((ARDUINOJSON_USE_DOUBLE ? useDouble : 0) |
+                   (ARDUINOJSON_USE_LONG_LONG ? useLongLong : 0) |
+                   (ARDUINOJSON_DOUBLY_LINKED_COLLECTIONS ? doublyLinked : 0));
+  }
+
+  void init() {
+    memset(this, 0, sizeof(*this));
+    memcpy(magic, "AJSN", 4);
+    version = currentVersion;
+    pointerSize = sizeof(void*);
+    slotIdSize = sizeof(SlotId);
+    stringLengthSize = sizeof(StringNode::length_type);
+    byteOrder = byteOrderMark;
+    slotSize = uint16_t(ResourceManager::slotSize);
+    features = currentFeatures();
+  }
+
+  // Returns true if the image was written by a program with the same layout
+  bool isCompatible() const {
+    return version == currentVersion && pointerSize == sizeof(void*) &&
+           slotIdSize == sizeof(SlotId) &&
+           stringLengthSize == sizeof(StringNode::length_type) &&
+           byteOrder == byteOrderMark &&
+           slotSize == ResourceManager::slotSize &&
+           features == currentFeatures();
+  }
+};
+
+// The offsets in the image are multiples of this value
+const size_t snapshotAlignment = 8;
+
+inline size_t alignSnapshotOffset(size_t n) {
+  return (n + snapshotAlignment - 1) & ~(snapshotAlignment - 1);
+}
+
+const size_t snapshotRootOffset = alignSnapshotOffset(sizeof(SnapshotHeader));
+const size_t snapshotSlotsOffset =
+    snapshotRootOffset + alignSnapshotOffset(ResourceManager::slotSize);
+
+inline uint32_t getSnapshotRelocation(const char* image,
+                                      const SnapshotHeader& header, size_t i) {
+  uint32_t offset;
+  memcpy(&offset, image + header.relocationsOffset + i * sizeof(uint32_t),
+         sizeof(offset));
+  return offset;
+}
+
+inline void setSnapshotRelocation(char* image, const SnapshotHeader& header,
+                                  size_t i, uint32_t offset) {
+  memcpy(image + header.relocationsOffset + i * sizeof(uint32_t), &offset,
+         sizeof(offset));
+}
+
+inline void siftDownSnapshotRelocation(char* image,
+                                       const SnapshotHeader& header, size_t i,
+                                       size_t count) {
+  uint32_t value = getSnapshotRelocation(image, header, i);
+  for (;;) {
+    size_t child = 2 * i + 1;
+    if (child >= count)
+      break;
+    if (child + 1 < count && getSnapshotRelocation(image, header, child + 1) >
+                                 getSnapshotRelocation(image, header, child))
+      child++;
+    uint32_t childValue = getSnapshotRelocation(image, header, child);
+    if (childValue <= value)
+      break;
+    setSnapshotRelocation(image, header, i, childValue);
+    i = child;
+  }
+  setSnapshotRelocation(image, header, i, value);
+}
+
+// Sorts the relocations with a heap sort, which doesn't allocate
+inline void sortSnapshotRelocations(char* image, const SnapshotHeader& header) {
+  size_t count = header.relocationCount;
+  for (size_t i = count / 2; i > 0; i--)
+    siftDownSnapshotRelocation(image, header, i - 1, count);
+  for (size_t end = count; end > 1; end--) {
+    uint32_t largest = getSnapshotRelocation(image, header, 0);
+    setSnapshotRelocation(image, header, 0,
+                          getSnapshotRelocation(image, header, end - 1));
+    setSnapshotRelocation(image, header, end - 1, largest);
+    siftDownSnapshotRelocation(image, header, 0, end - 1);
+  }
+}
+
+// Adds bytes to a 32-bit FNV-1a hash
+inline uint32_t snapshotHash(uint32_t hash, const void* data, size_t size) {
+  auto bytes = reinterpret_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < size; i++) {
+    hash ^= bytes[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// Computes the 32-bit FNV-1a hash of the image as it was saved: with the
+// checksum and the base set to zero, and the string pointers holding offsets.
+// So it doesn't depend on the address the image was loaded at.
+// The relocations must be sorted and checked.
+inline uint32_t snapshotChecksum(const char* image,
+                                 const SnapshotHeader& header) {
+  SnapshotHeader saved = header;
+  saved.checksum = 0;
+  saved.base = 0;
+  uint32_t hash = snapshotHash(2166136261u, &saved, sizeof(saved));
+
+  // the string pointer is the first member of the variant
+  size_t position = sizeof(saved);
+  for (uint32_t i = 0; i < header.relocationCount; i++) {
+    size_t offset = getSnapshotRelocation(image, header, i);
+    auto variant = reinterpret_cast<const VariantData*>(image + offset);
+    auto node = reinterpret_cast<StringNode*>(
+        reinterpret_cast<size_t>(variant->stringNode()) - header.base);
+    hash = snapshotHash(hash, image + position, offset - position);
+    hash = snapshotHash(hash, &node, sizeof(node));
+    position = offset + sizeof(node);
+  }
+  return snapshotHash(hash, image + position, header.size - position);
+}
+
+// Writes the strings and the relocations of a snapshot.
+// Without an image, only measures them.
+class SnapshotWriter {
+  // A string already written in the image
+  struct StringEntry {
+    const char* data;  // in the document
+    size_t length;
+    size_t offset;  // in the image
+    uint32_t hash_;
+
+    uint32_t hash() const {
+      return hash_;
+    }
+
+    bool isEmpty() const {
+      return data == nullptr;
+    }
+
+    static StringEntry empty() {
+      return {nullptr, 0, 0, 0};
+    }
+  };
+
+  struct StringMatcher {
+    JsonString str;
+
+    bool operator()(const StringEntry& entry) const {
+      return stringEquals(adaptString(str),
+                          adaptString(entry.data, entry.length));
+    }
+  };
+
+ public:
+  SnapshotWriter(const ResourceManager* resources, char* image,
+                 size_t stringsOffset, size_t stringsCapacity,
+                 size_t relocationsOffset, size_t relocationsCapacity)
+      : resources_(resources),
+        image_(image),
+        stringsOffset_(stringsOffset),
+        stringsCapacity_(stringsCapacity),
+        relocationsOffset_(relocationsOffset),
+        relocationsCapacity_(relocationsCapacity) {}
+
+  ~SnapshotWriter() {
+    strings_.clear(resources_->allocator());
+  }
+
+  SnapshotWriter(const SnapshotWriter&) = delete;
+  SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+
+  // Visits the variant at the specified offset, and its children
+  void write(const VariantData& variant, size_t offset) {
+    switch (variant.type()) {
+      case VariantType::LinkedString:
+      case VariantType::OwnedString:
+        addString(variant.asString(), offset);
+        break;
+
+      case VariantType::RawString:
+        addString(variant.asRawString(), offset);
+        break;
+
+      case VariantType::Array:
+      case VariantType::Object:
+        for (SlotId id = variant.asCollection()->head(); id != NULL_SLOT;) {
+          const VariantData* child = resources_->getVariant(id);
+          write(*child, snapshotSlotsOffset + id * ResourceManager::slotSize);
+          id = child->next();
+        }
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  // Returns false if a string was too long, or if the image is smaller than
+  // measured
+  bool succeeded() const {
+    return !failed_;
+  }
+
+  size_t stringsSize() const {
+    return stringsSize_;
+  }
+
+  size_t relocationCount() const {
+    return relocationCount_;
+  }
+
+ private:
+  void addString(JsonString str, size_t variantOffset) {
+    size_t stringOffset = findOrWriteString(str);
+    if (failed_)
+      return;
+
+    if (image_) {
+      if (relocationCount_ >= relocationsCapacity_) {
+        failed_ = true;
+        return;
+      }
+      auto variant = reinterpret_cast<VariantData*>(image_ + variantOffset);
+      variant->relinkString(reinterpret_cast<StringNode*>(stringOffset));
+      uint32_t relocation = uint32_t(variantOffset);
+      memcpy(image_ + relocationsOffset_ + relocationCount_ * sizeof(uint32_t),
+             &relocation, sizeof(relocation));  // sorted by writeSnapshot()
+    }
+    relocationCount_++;
+  }
+
+  // Returns the offset of the string in the image.
+  // The keys that repeat in the document are only written once.
+  size_t findOrWriteString(JsonString str) {
+    if (str.size() > StringNode::maxLength) {
+      failed_ = true;
+      return 0;
+    }
+
+    uint32_t hash = stringHash(adaptString(str));
+    auto entry = strings_.find(hash, StringMatcher{str});
+    if (entry)
+      return entry->offset;
+
+    size_t offset = stringsOffset_ + stringsSize_;
+    size_t size = alignSnapshotOffset(sizeofString(str.size()));
+    if (image_) {
+      if (stringsSize_ + size > stringsCapacity_) {
+        failed_ = true;
+        return 0;
+      }
+      char* p = image_ + offset;
+      memset(p, 0, size);
+      auto node = reinterpret_cast<StringNode*>(p);
+      node->next = nullptr;
+      node->references = 1;
+      node->length = StringNode::length_type(str.size());
+      memcpy(node->data, str.c_str(), str.size());
+    }
+    stringsSize_ += size;
+
+    // if the table can't grow, the next occurrences are written again
+    strings_.insert({str.c_str(), str.size(), offset, hash},
+                    resources_->allocator());
+    return offset;
+  }
+
+  const ResourceManager* resources_;
+  char* image_;
+  size_t stringsOffset_, stringsCapacity_;
+  size_t relocationsOffset_, relocationsCapacity_;
+  size_t stringsSize_ = 0;
+  size_t relocationCount_ = 0;
+  bool failed_ = false;
+  HashTable<StringEntry> strings_;
+};
+
+// Writes the snapshot of a document in the buffer, or only measures it if the
+// buffer is null. Returns the size of the snapshot, or 0 on failure.
+inline size_t writeSnapshot(const VariantData* root,
+                            const ResourceManager* resources, char* buffer,
+                            size_t capacity) {
+  const size_t slotsSize = resources->slotCount() * ResourceManager::slotSize;
+  const size_t stringsOffset =
+      alignSnapshotOffset(snapshotSlotsOffset + slotsSize);
+
+  // measure the strings and the relocations
+  SnapshotWriter measurer(resources, nullptr, stringsOffset, 0, 0, 0);
+  measurer.write(*root, snapshotRootOffset);
+  if (!measurer.succeeded())
+    return 0;
+
+  size_t relocationsOffset = stringsOffset + measurer.stringsSize();
+  size_t size =
+      relocationsOffset + measurer.relocationCount() * sizeof(uint32_t);
+  if (size > 0xFFFFFFFF)
+    return 0;
+  if (!buffer)
+    return size;
+  if (size > capacity)
+    return 0;
+
+  memset(buffer, 0, snapshotSlotsOffset);
+  memcpy(buffer + snapshotRootOffset, root, sizeof(VariantData));
+  resources->copySlots(buffer + snapshotSlotsOffset);
+  memset(buffer + snapshotSlotsOffset + slotsSize, 0,
+         stringsOffset - snapshotSlotsOffset - slotsSize);
+
+  SnapshotWriter writer(resources, buffer, stringsOffset,
+                        measurer.stringsSize(), relocationsOffset,
+                        measurer.relocationCount());
+  writer.write(*root, snapshotRootOffset);
+  if (!writer.succeeded())
+    return 0;
+
+  SnapshotHeader header;
+  header.init();
+  header.size = uint32_t(size);
+  header.slotCount = uint32_t(resources->slotCount());
+  header.stringsOffset = uint32_t(stringsOffset);
+  header.relocationsOffset = uint32_t(relocationsOffset);
+  header.relocationCount = uint32_t(writer.relocationCount());
+  sortSnapshotRelocations(buffer, header);
+  header.checksum = snapshotChecksum(buffer, header);
+  memcpy(buffer, &header, sizeof(header));
+  return size;
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Returns the size of the snapshot of the document, or 0 if the document can't
+// be saved (a string is too long, or the image would exceed 4 GB)
+inline size_t measureSnapshot(const JsonDocument& doc) {
+  using namespace detail;
+  JsonVariantConst root = doc.as<JsonVariantConst>();
+  return writeSnapshot(VariantAttorney::getData(root),
+                       VariantAttorney::getResourceManager(root), nullptr, 0);
+}
+
+// Saves the slots and the strings of the document in the buffer, so that
+// JsonSnapshot can load them without parsing.
+// The image can only be loaded by a program with the same layout (pointer
+// size, slot id size, byte order, and configuration).
+// Returns the size of the image, or 0 if the buffer is too small.
+inline size_t serializeSnapshot(const JsonDocument& doc, void* buffer,
+                                size_t capacity) {
+  if (!buffer)
+    return 0;
+  using namespace detail;
+  JsonVariantConst root = doc.as<JsonVariantConst>();
+  return writeSnapshot(VariantAttorney::getData(root),
+                       VariantAttorney::getResourceManager(root),
+                       reinterpret_cast<char*>(buffer), capacity);
+}
+
+// A document that uses a snapshot image in place, without parsing or copying
+// it. Its values can be read but not modified.
+// The image is not read-only, though: load() relocates the strings, which
+// means it writes the address of the image in each string variant. So the
+// image must be writable, and it must stay alive while the snapshot uses it;
+// an image in Flash or in a read-only mapping can't be loaded. It can come
+// from a file read in a buffer, or from mmap() with MAP_PRIVATE, so that only
+// the pages that contain strings are copied and the file stays unchanged.
+class JsonSnapshot {
+ public:
+  // The snapshot doesn't allocate the values, but load() allocates the list
+  // of the pools in the image when they are more than
+  // ARDUINOJSON_INITIAL_POOL_COUNT, and the indexes
+  // (ARDUINOJSON_ENABLE_OBJECT_INDEX and ARDUINOJSON_ENABLE_ARRAY_INDEX)
+  // allocate their caches with this allocator when the values are read.
+  explicit JsonSnapshot(
+      Allocator* allocator = detail::DefaultAllocator::instance())
+      : resources_(allocator) {}
+
+  JsonSnapshot(const JsonSnapshot&) = delete;
+  JsonSnapshot& operator=(const JsonSnapshot&) = delete;
+
+  ~JsonSnapshot() {
+    resources_.detachSlots();
+  }
+
+  // Checks and loads an image produced by serializeSnapshot().
+  // It verifies the checksum and checks every slot id and every string it can
+  // reach, so reading the snapshot never goes outside of the image, even if
+  // the image is corrupted or forged. The nesting limit bounds the recursion
+  // of this check, like the one of deserializeJson().
+  // The image must be aligned on 8 bytes and writable: the string pointers are
+  // relocated in place, and restored if the check fails.
+  DeserializationError load(
+      void* image, size_t size,
+      DeserializationOption::NestingLimit nestingLimit = {}) {
+    using namespace detail;
+
+    unload();
+
+    if (!image || !size)
+      return DeserializationError::EmptyInput;
+    if (size < snapshotSlotsOffset)
+      return DeserializationError::IncompleteInput;
+    if (reinterpret_cast<size_t>(image) % snapshotAlignment != 0)
+      return DeserializationError::InvalidInput;
+
+    char* p = reinterpret_cast<char*>(image);
+    SnapshotHeader header;
+    memcpy(&header, p, sizeof(header));
+    if (memcmp(header.magic, "AJSN", 4) != 0 || !header.isCompatible())
+      return DeserializationError::InvalidInput;
+    if (header.size > size)
+      return DeserializationError::IncompleteInput;
+    if (!isConsistent(header) || !checkRelocations(p, header) ||
+        snapshotChecksum(p, header) != header.checksum)
+      return DeserializationError::InvalidInput;
+
+    // the image stays unchanged if it's already loaded at this address, so
+    // several snapshots can share it
+    if (!resources_.attachSlots(p + snapshotSlotsOffset, header.slotCount))
+      return DeserializationError::NoMemory;
+
+    size_t address = reinterpret_cast<size_t>(image);
+    relocate(p, header, header.base, address);
+    size_t slotsLeft = header.slotCount;  // stops the cycles
+    auto err = checkVariant(
+        p, header, address,
+        *reinterpret_cast<const VariantData*>(p + snapshotRootOffset),
+        nestingLimit, slotsLeft);
+    if (err) {
+      relocate(p, header, address, header.base);
+      resources_.detachSlots();
+      return err;
+    }
+    if (header.base != address) {
+      header.base = address;
+      memcpy(p, &header, sizeof(header));
+    }
+
+    root_ = reinterpret_cast<VariantData*>(p + snapshotRootOffset);
+    return DeserializationError::Ok;
+  }
+
+  // Stops using the image
+  void unload() {
+    resources_.detachSlots();
+    resources_.clear();  // the indexes of the previous image
+    root_ = nullptr;
+  }
+
+  // Returns a reference to the root value.
+  JsonVariantConst root() const {
+    return JsonVariantConst(root_, &resources_);
+  }
+
+  operator JsonVariantConst() const {
+    return root();
+  }
+
+  // Returns true if no image is loaded, or if the root is null.
+  bool isNull() const {
+    return root().isNull();
+  }
+
+  // Returns the number of elements or members of the root.
+  size_t size() const {
+    return root().size();
+  }
+
+  // Casts the root to the specified type.
+  template <typename T>
+  T as() const {
+    return root().as<T>();
+  }
+
+  // Returns true if the root is of the specified type.
+  template <typename T>
+  bool is() const {
+    return root().is<T>();
+  }
+
+  // Gets the root array's element at specified index.
+  template <typename T,
+            detail::enable_if_t<detail::is_integral<T>::value, int> = 0>
+  JsonVariantConst operator[](T index) const {
+    return root()[index];
+  }
+
+  // Gets the root object's member with specified key.
+  template <typename TString,
+            detail::enable_if_t<detail::IsString<TString>::value, int> = 0>
+  JsonVariantConst operator[](const TString& key) const {
+    return root()[key];
+  }
+
+  // Gets the root object's member with specified key.
+  template <typename TChar,
+            detail::enable_if_t<detail::IsString<TChar*>::value &&
+                                    !detail::is_const<TChar>::value,
+                                int> = 0>
+  JsonVariantConst operator[](TChar* key) const {
+    return root()[key];
+  }
+
+ private:
+  static bool isConsistent(const detail::SnapshotHeader& header) {
+    using namespace detail;
+    const size_t slotSize = ResourceManager::slotSize;
+    if (header.size < snapshotSlotsOffset ||
+        header.slotCount > (header.size - snapshotSlotsOffset) / slotSize)
+      return false;
+    // the ids go from 0 to NULL_SLOT - 1
+    if (size_t(header.slotCount) > size_t(NULL_SLOT))
+      return false;
+    size_t slotsEnd = snapshotSlotsOffset + header.slotCount * slotSize;
+    return slotsEnd <= header.stringsOffset &&
+           header.stringsOffset % snapshotAlignment == 0 &&
+           header.stringsOffset <= header.relocationsOffset &&
+           header.relocationsOffset <= header.size &&
+           header.relocationCount <=
+               (header.size - header.relocationsOffset) / sizeof(uint32_t);
+  }
+
+  // Returns true if the offset is the one of the root or of a slot
+  static bool isVariantOffset(const detail::SnapshotHeader& header,
+                              size_t offset) {
+    using namespace detail;
+    const size_t slotSize = ResourceManager::slotSize;
+    if (offset == snapshotRootOffset)
+      return true;
+    if (offset < snapshotSlotsOffset)
+      return false;
+    return (offset - snapshotSlotsOffset) % slotSize == 0 &&
+           (offset - snapshotSlotsOffset) / slotSize < header.slotCount;
+  }
+
+  // Returns true if a whole string node is at this offset, in the strings of
+  // the image
+  static bool isStringNode(const char* image,
+                           const detail::SnapshotHeader& header,
+                           size_t offset) {
+    using namespace detail;
+    if (offset < header.stringsOffset || offset % snapshotAlignment != 0 ||
+        offset > header.relocationsOffset ||
+        header.relocationsOffset - offset < sizeofString(0))
+      return false;
+    auto node = reinterpret_cast<const StringNode*>(image + offset);
+    return sizeofString(node->length) <= header.relocationsOffset - offset &&
+           node->data[node->length] == 0;
+  }
+
+  // Checks that the relocations are sorted, and that they point to owned or
+  // raw strings whose nodes are in the image.
+  // After this, relocate() can't fail and can be undone.
+  static bool checkRelocations(const char* image,
+                               const detail::SnapshotHeader& header) {
+    using namespace detail;
+    size_t previous = 0;
+    for (uint32_t i = 0; i < header.relocationCount; i++) {
+      size_t offset = getSnapshotRelocation(image, header, i);
+      if (offset <= previous || !isVariantOffset(header, offset))
+        return false;
+      previous = offset;
+      auto variant = reinterpret_cast<const VariantData*>(image + offset);
+      auto node = reinterpret_cast<size_t>(variant->stringNode());
+      if (!node || !isStringNode(image, header, node - header.base))
+        return false;
+    }
+    return true;
+  }
+
+  // Moves the string pointers from one address of the image to another
+  static void relocate(char* image, const detail::SnapshotHeader& header,
+                       size_t from, size_t to) {
+    using namespace detail;
+    if (from == to)
+      return;
+    for (uint32_t i = 0; i < header.relocationCount; i++) {
+      size_t offset = getSnapshotRelocation(image, header, i);
+      auto variant = reinterpret_cast<VariantData*>(image + offset);
+      size_t node = reinterpret_cast<size_t>(variant->stringNode());
+      variant->relinkString(reinterpret_cast<StringNode*>(node - from + to));
+    }
+  }
+
+  // Checks a variant of the relocated image and its children, so that reading
+  // them only touches the image. A variant that the relocations missed points
+  // outside of the image.
+  static DeserializationError::Code checkVariant(
+      const char* image, const detail::SnapshotHeader& header, size_t address,
+      const detail::VariantData& variant,
+      DeserializationOption::NestingLimit nestingLimit, size_t& slotsLeft) {
+    using namespace detail;
+    const size_t slotSize = ResourceManager::slotSize;
+    switch (variant.type()) {
+      case VariantType::Null:
+      case VariantType::Uint32:
+      case VariantType::Int32:
+      case VariantType::Float:
+        return DeserializationError::Ok;
+
+      case VariantType::Boolean:
+        if (variant.contentBytes()[0] > 1)
+          return DeserializationError::InvalidInput;
+        return DeserializationError::Ok;
+
+      case VariantType::TinyString:
+        for (size_t i = 0; i <= tinyStringMaxLength; i++) {
+          if (!variant.contentBytes()[i])
+            return DeserializationError::Ok;
+        }
+        return DeserializationError::InvalidInput;
+
+      case VariantType::OwnedString:
+      case VariantType::RawString:
+        if (!isStringNode(
+                image, header,
+                reinterpret_cast<size_t>(variant.stringNode()) - address))
+          return DeserializationError::InvalidInput;
+        return DeserializationError::Ok;
+
+#if ARDUINOJSON_USE_LONG_LONG
+      case VariantType::Uint64:
+      case VariantType::Int64:
+#endif
+#if ARDUINOJSON_USE_DOUBLE
+      case VariantType::Double:
+#endif
+#if ARDUINOJSON_USE_LONG_LONG || ARDUINOJSON_USE_DOUBLE
+#  if ARDUINOJSON_USE_EXTENSIONS
+        if (variant.extensionSlot() >= header.slotCount)
+          return DeserializationError::InvalidInput;
+#  endif
+        return DeserializationError::Ok;
+#endif
+
+      case VariantType::Object:
+      case VariantType::Array:
+        if (nestingLimit.reached())
+          return DeserializationError::TooDeep;
+        for (SlotId id = variant.asCollection()->head(); id != NULL_SLOT;) {
+          // in a tree, each slot is visited once at most
+          if (id >= header.slotCount || slotsLeft == 0)
+            return DeserializationError::InvalidInput;
+          slotsLeft--;
+          auto child = reinterpret_cast<const VariantData*>(
+              image + snapshotSlotsOffset + id * slotSize);
+#if ARDUINOJSON_DOUBLY_LINKED_COLLECTIONS
+          if (child->prev() != NULL_SLOT && child->prev() >= header.slotCount)
+            return DeserializationError::InvalidInput;
+#endif
+          auto err = checkVariant(image, header, address, *child,
+                                  nestingLimit.decrement(), slotsLeft);
+          if (err)
+            return err;
+          id = child->next();
+        }
+        return DeserializationError::Ok;
+
+      default:  // a linked string would point outside of the image
+        return DeserializationError::InvalidInput;
+    }
+  }
+
+  detail::ResourceManager resources_;
+  detail::VariantData* root_ = nullptr;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -6,9 +6,12 @@
 
 #include <ArduinoJson/Deserialization/deserialize.hpp>
 #include <ArduinoJson/Json/EscapeSequence.hpp>
+#include <ArduinoJson/Json/JsonGrammar.hpp>
 #include <ArduinoJson/Json/Latch.hpp>
+#include <ArduinoJson/Json/StringScanner.hpp>
 #include <ArduinoJson/Json/Utf16.hpp>
 #include <ArduinoJson/Json/Utf8.hpp>
+#include <ArduinoJson/Memory/InSituStringBuilder.hpp>
 #include <ArduinoJson/Memory/ResourceManager.hpp>
 #include <ArduinoJson/Numbers/parseNumber.hpp>
 #include <ArduinoJson/Polyfills/assert.hpp>
@@ -25,7 +28,9 @@ class JsonDeserializer {
       : stringBuilder_(resources),
         foundSomething_(false),
         latch_(reader),
-        resources_(resources) {}
+        resources_(resources) {
+    bindStringBuilder(stringBuilder_);
+  }
 
   template <typename TFilter>
   DeserializationError parse(VariantData& variant, TFilter filter,
@@ -42,6 +47,80 @@ class JsonDeserializer {
     return err;
   }
 
+  template <typename THandler>
+  DeserializationError parseEvents(
+      THandler& handler, DeserializationOption::NestingLimit nestingLimit) {
+    return emitVariant(handler, nestingLimit, true);
+  }
+
+  // The functions below let JsonLazyDocument walk an in-memory input one step
+  // at a time, without building the values.
+
+  // Returns the position of the next character
+  const char* position() const {
+    return latch_.position();
+  }
+
+  // Skips the spaces and the comments, and returns the next character, or 0
+  // if there is none
+  char peek() {
+    if (skipSpacesAndComments())
+      return 0;
+    return current();
+  }
+
+  // Skips the spaces and the comments, and consumes the next character if it's
+  // the expected one
+  bool accept(char expected) {
+    if (peek() != expected)
+      return false;
+    move();
+    return true;
+  }
+
+  DeserializationError::Code skip(
+      DeserializationOption::NestingLimit nestingLimit) {
+    return skipVariant(nestingLimit);
+  }
+
+  // Reads a key and the colon that follows it, and tells whether the key
+  // equals the specified one.
+  // The keys without escape sequences are compared in place.
+  template <typename TAdaptedString>
+  DeserializationError::Code matchKey(TAdaptedString key, bool& match) {
+    DeserializationError::Code err;
+
+    char stopChar = peek();
+    if (!stopChar)
+      return DeserializationError::IncompleteInput;
+
+    if (JsonGrammar::isQuote(stopChar)) {
+      move();
+      auto& reader = latch_.reader();
+      auto begin = reader.position();
+      auto end = findEndOfPlainChars(begin, reader.end(), stopChar);
+      if (end != reader.end() && *end == stopChar) {
+        match = stringEquals(key, adaptString(begin, size_t(end - begin)));
+        reader.seek(end + 1);
+      } else {
+        reader.seek(begin - 1);  // go back to the quote
+        stopChar = 0;
+      }
+    }
+
+    if (!JsonGrammar::isQuote(stopChar)) {
+      err = parseKey();
+      if (err)
+        return err;
+      match = stringEquals(key, adaptString(stringBuilder_.str()));
+    }
+
+    if (!accept(':'))
+      return DeserializationError::InvalidInput;
+
+    return DeserializationError::Ok;
+  }
+
  private:
   char current() {
     return latch_.current();
@@ -370,9 +449,178 @@ class JsonDeserializer {
     }
   }
 
+  template <typename THandler>
+  DeserializationError::Code emitVariant(
+      THandler& handler, DeserializationOption::NestingLimit nestingLimit,
+      bool isRoot = false) {
+    DeserializationError::Code err;
+
+    err = skipSpacesAndComments();
+    if (err)
+      return err;
+
+    VariantData value;
+
+    switch (current()) {
+      case '[':
+        return emitArray(handler, nestingLimit);
+
+      case '{':
+        return emitObject(handler, nestingLimit);
+
+      case '\"':
+      case '\'':
+        stringBuilder_.startString();
+        err = parseQuotedString();
+        if (err)
+          return err;
+        saveTemporaryString(value);
+        break;
+
+      case 't':
+        value.setBoolean(true);
+        err = skipKeyword("true");
+        break;
+
+      case 'f':
+        value.setBoolean(false);
+        err = skipKeyword("false");
+        break;
+
+      case 'n':
+        err = skipKeyword("null");
+        break;
+
+      default:
+        err = parseNumericValue(value);
+        // Like parse(), check the trailing characters after a root number,
+        // but before the handler sees it
+        if (!err && isRoot && latch_.last() != 0)
+          err = DeserializationError::InvalidInput;
+        break;
+    }
+
+    if (!err)
+      handler.value(JsonVariantConst(&value, resources_));
+    value.clear(resources_);
+    return err;
+  }
+
+  // The handler sees the string until the next string is parsed
+  void saveTemporaryString(VariantData& value) {
+    JsonString s = stringBuilder_.str();
+    if (strlen(s.c_str()) == s.size())
+      value.setLinkedString(s.c_str());
+    else  // the string contains NUL
+      stringBuilder_.save(&value);
+  }
+
+  template <typename THandler>
+  DeserializationError::Code emitArray(
+      THandler& handler, DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    if (nestingLimit.reached())
+      return DeserializationError::TooDeep;
+
+    if (!handler.startArray())
+      return skipArray(nestingLimit);
+
+    // Skip opening braket
+    ARDUINOJSON_ASSERT(current() == '[');
+    move();
+
+    // Skip spaces
+    err = skipSpacesAndComments();
+    if (err)
+      return err;
+
+    // Read each value
+    if (!eat(']')) {
+      for (;;) {
+        err = emitVariant(handler, nestingLimit.decrement());
+        if (err)
+          return err;
+
+        err = skipSpacesAndComments();
+        if (err)
+          return err;
+
+        if (eat(']'))
+          break;
+        if (!eat(','))
+          return DeserializationError::InvalidInput;
+      }
+    }
+
+    handler.endArray();
+    return DeserializationError::Ok;
+  }
+
+  template <typename THandler>
+  DeserializationError::Code emitObject(
+      THandler& handler, DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    if (nestingLimit.reached())
+      return DeserializationError::TooDeep;
+
+    if (!handler.startObject())
+      return skipObject(nestingLimit);
+
+    // Skip opening brace
+    ARDUINOJSON_ASSERT(current() == '{');
+    move();
+
+    // Skip spaces
+    err = skipSpacesAndComments();
+    if (err)
+      return err;
+
+    // Read each key value pair
+    if (!eat('}')) {
+      for (;;) {
+        err = parseKey();
+        if (err)
+          return err;
+
+        err = skipSpacesAndComments();
+        if (err)
+          return err;
+
+        if (!eat(':'))
+          return DeserializationError::InvalidInput;
+
+        if (handler.key(stringBuilder_.str()))
+          err = emitVariant(handler, nestingLimit.decrement());
+        else
+          err = skipVariant(nestingLimit.decrement());
+        if (err)
+          return err;
+
+        err = skipSpacesAndComments();
+        if (err)
+          return err;
+
+        if (eat('}'))
+          break;
+        if (!eat(','))
+          return DeserializationError::InvalidInput;
+
+        err = skipSpacesAndComments();
+        if (err)
+          return err;
+      }
+    }
+
+    handler.endObject();
+    return DeserializationError::Ok;
+  }
+
   DeserializationError::Code parseKey() {
+    bool quoted = JsonGrammar::isQuote(current());
     stringBuilder_.startString();
-    if (isQuote(current())) {
+    if (quoted) {
       return parseQuotedString();
     } else {
       return parseNonQuotedString();
@@ -402,6 +650,8 @@ class JsonDeserializer {
 
     move();
     for (;;) {
+      appendPlainChars(stopChar, IsContiguousReader<TReader>());
+
       char c = current();
       move();
       if (c == stopChar)
@@ -417,8 +667,8 @@ class JsonDeserializer {
           return DeserializationError::IncompleteInput;
 
         if (c == 'u') {
-#if ARDUINOJSON_DECODE_UNICODE
           move();
+#if ARDUINOJSON_DECODE_UNICODE
           uint16_t codeunit;
           err = parseHex4(codeunit);
           if (err)
@@ -427,6 +677,7 @@ class JsonDeserializer {
             Utf8::encodeCodepoint(codepoint.value(), stringBuilder_);
 #else
           stringBuilder_.append('\\');
+          stringBuilder_.append('u');
 #endif
           continue;
         }
@@ -451,12 +702,12 @@ class JsonDeserializer {
     char c = current();
     ARDUINOJSON_ASSERT(c);
 
-    if (canBeInNonQuotedString(c)) {  // no quotes
+    if (JsonGrammar::canBeInNonQuotedString(c)) {  // no quotes
       do {
         move();
         stringBuilder_.append(c);
         c = current();
-      } while (canBeInNonQuotedString(c));
+      } while (JsonGrammar::canBeInNonQuotedString(c));
     } else {
       return DeserializationError::InvalidInput;
     }
@@ -468,7 +719,7 @@ class JsonDeserializer {
   }
 
   DeserializationError::Code skipKey() {
-    if (isQuote(current())) {
+    if (JsonGrammar::isQuote(current())) {
       return skipQuotedString();
     } else {
       return skipNonQuotedString();
@@ -480,6 +731,8 @@ class JsonDeserializer {
 
     move();
     for (;;) {
+      skipPlainChars(stopChar, IsContiguousReader<TReader>());
+
       char c = current();
       move();
       if (c == stopChar)
@@ -487,17 +740,38 @@ class JsonDeserializer {
       if (c == '\0')
         return DeserializationError::IncompleteInput;
       if (c == '\\') {
-        if (current() != '\0')
-          move();
+        if (current() == '\0')
+          return DeserializationError::IncompleteInput;
+        move();
       }
     }
 
     return DeserializationError::Ok;
   }
 
+  // When the reader exposes its buffer, the characters that need no
+  // unescaping are consumed in one go, instead of one by one.
+
+  void appendPlainChars(char stopChar, true_type) {
+    auto& reader = latch_.reader();
+    auto begin = reader.position();
+    auto end = findEndOfPlainChars(begin, reader.end(), stopChar);
+    stringBuilder_.append(begin, size_t(end - begin));
+    reader.seek(end);
+  }
+
+  void appendPlainChars(char, false_type) {}
+
+  void skipPlainChars(char stopChar, true_type) {
+    auto& reader = latch_.reader();
+    reader.seek(findEndOfPlainChars(reader.position(), reader.end(), stopChar));
+  }
+
+  void skipPlainChars(char, false_type) {}
+
   DeserializationError::Code skipNonQuotedString() {
     char c = current();
-    while (canBeInNonQuotedString(c)) {
+    while (JsonGrammar::canBeInNonQuotedString(c)) {
       move();
       c = current();
     }
@@ -508,7 +782,7 @@ class JsonDeserializer {
     uint8_t n = 0;
 
     char c = current();
-    while (canBeInNumber(c) && n < 63) {
+    while (JsonGrammar::canBeInNumber(c) && n < 63) {
       move();
       buffer_[n++] = c;
       c = current();
@@ -550,7 +824,7 @@ class JsonDeserializer {
 
   DeserializationError::Code skipNumericValue() {
     char c = current();
-    while (canBeInNumber(c)) {
+    while (JsonGrammar::canBeInNumber(c)) {
       move();
       c = current();
     }
@@ -563,7 +837,7 @@ class JsonDeserializer {
       char digit = current();
       if (!digit)
         return DeserializationError::IncompleteInput;
-      uint8_t value = decodeHex(digit);
+      uint8_t value = JsonGrammar::decodeHex(digit);
       if (value > 0x0F)
         return DeserializationError::InvalidInput;
       result = uint16_t((result << 4) | value);
@@ -572,35 +846,6 @@ class JsonDeserializer {
     return DeserializationError::Ok;
   }
 
-  static inline bool isBetween(char c, char min, char max) {
-    return min <= c && c <= max;
-  }
-
-  static inline bool canBeInNumber(char c) {
-    return isBetween(c, '0', '9') || c == '+' || c == '-' || c == '.' ||
-#if ARDUINOJSON_ENABLE_NAN || ARDUINOJSON_ENABLE_INFINITY
-           isBetween(c, 'A', 'Z') || isBetween(c, 'a', 'z');
-#else
-           c == 'e' || c == 'E';
-#endif
-  }
-
-  static inline bool canBeInNonQuotedString(char c) {
-    return isBetween(c, '0', '9') || isBetween(c, '_', 'z') ||
-           isBetween(c, 'A', 'Z');
-  }
-
-  static inline bool isQuote(char c) {
-    return c == '\'' || c == '\"';
-  }
-
-  static inline uint8_t decodeHex(char c) {
-    if (c < 'A')
-      return uint8_t(c - '0');
-    c = char(c & ~0x20);  // uppercase
-    return uint8_t(c - 'A' + 10);
-  }
-
   DeserializationError::Code skipSpacesAndComments() {
     for (;;) {
       switch (current()) {
@@ -680,7 +925,14 @@ class JsonDeserializer {
     return DeserializationError::Ok;
   }
 
-  StringBuilder stringBuilder_;
+  void bindStringBuilder(StringBuilder&) {}
+
+  // In-situ strings are written behind the reader, in the input buffer
+  void bindStringBuilder(InSituStringBuilder& builder) {
+    builder.setReader(&latch_.reader());
+  }
+
+  typename StringBuilderFor<TReader>::type stringBuilder_;
   bool foundSomething_;
   Latch<TReader> latch_;
   ResourceManager* resources_;
@@ -717,4 +969,71 @@ inline DeserializationError deserializeJson(TDestination&& dst, TChar* input,
                                        input, detail::forward<Args>(args)...);
 }
 
+// Parses a JSON input in place, and puts the result in a JsonDocument.
+// The strings are unescaped in the input buffer and the document points to
+// them, so the buffer must outlive the document and its copies.
+template <typename TDestination, typename Size, typename... Args,
+          detail::enable_if_t<
+              detail::is_deserialize_destination<TDestination>::value &&
+                  detail::is_integral<Size>::value,
+              int> = 0>
+inline DeserializationError deserializeJsonInSitu(TDestination&& dst,
+                                                  char* input, Size inputSize,
+                                                  const Args&... args) {
+  using namespace detail;
+  return doDeserialize<JsonDeserializer>(
+      dst, InSituReader(input, size_t(inputSize)),
+      makeDeserializationOptions(args...));
+}
+
+// Parses a null-terminated JSON input in place, and puts the result in a
+// JsonDocument.
+template <typename TDestination, typename... Args,
+          detail::enable_if_t<
+              detail::is_deserialize_destination<TDestination>::value &&
+                  !detail::is_integral<
+                      typename detail::first_or_void<Args...>::type>::value,
+              int> = 0>
+inline DeserializationError deserializeJsonInSitu(TDestination&& dst,
+                                                  char* input,
+                                                  const Args&... args) {
+  return deserializeJsonInSitu(detail::forward<TDestination>(dst), input,
+                               input ? strlen(input) : 0, args...);
+}
+
+// Parses a JSON input and calls the handler for each value, without
+// building a document. The handler must have these member functions:
+//   bool startObject(), bool startArray(): return false to skip the value
+//   void endObject(), void endArray()
+//   bool key(JsonString): return false to skip the member
+//   void value(JsonVariantConst): a string, a number, a boolean, or null
+// The strings passed to the handler are only valid during the call.
+template <typename THandler, typename TInput>
+inline DeserializationError deserializeJsonEvents(
+    THandler& handler, TInput&& input,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  using namespace detail;
+  return deserializeEvents<JsonDeserializer>(
+      handler, makeReader(detail::forward<TInput>(input)), nestingLimit);
+}
+
+template <typename THandler, typename TChar>
+inline DeserializationError deserializeJsonEvents(
+    THandler& handler, TChar* input,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  using namespace detail;
+  return deserializeEvents<JsonDeserializer>(handler, makeReader(input),
+                                             nestingLimit);
+}
+
+template <typename THandler, typename TChar, typename Size,
+          detail::enable_if_t<detail::is_integral<Size>::value, int> = 0>
+inline DeserializationError deserializeJsonEvents(
+    THandler& handler, TChar* input, Size inputSize,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  using namespace detail;
+  return deserializeEvents<JsonDeserializer>(
+      handler, makeReader(input, size_t(inputSize)), nestingLimit);
+}
+
 ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -0,0 +1,545 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Document/IsDocumentReference.hpp>
+#include <ArduinoJson/Document/JsonDocument.hpp>
+#include <ArduinoJson/Json/JsonDeserializer.hpp>
+
+#include <string.h>  // strlen
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// The input of a JsonLazyDocument, and the positions of the values it already
+// found. The positions are offsets from the beginning of the input.
+class LazyJsonInput {
+  using Parser = JsonDeserializer<BoundedReader<const char*>>;
+
+  static_assert(ARDUINOJSON_LAZY_DOCUMENT_CACHE_SIZE > 0,
+                "ARDUINOJSON_LAZY_DOCUMENT_CACHE_SIZE must be at least 1");
+
+ public:
+  static const size_t npos = size_t(-1);
+
+  LazyJsonInput(const char* json, size_t size, Allocator* allocator)
+      : json_(json), size_(json ? size : 0), allocator_(allocator) {
+    ResourceManager resources(allocator_);
+    Parser parser(&resources, readerAt(0));
+    root_ = parser.peek() ? offsetOf(parser.position()) : npos;
+  }
+
+  size_t root() const {
+    return root_;
+  }
+
+  // Returns the first character of the value, or 0 if there is none
+  char typeAt(size_t value) const {
+    return value < size_ ? json_[value] : 0;
+  }
+
+  size_t elementAt(size_t array, size_t index) const {
+    if (typeAt(array) != '[')
+      return npos;
+
+    // start from the closest element we know
+    size_t i = 0, position = npos;
+    for (auto& entry : cache_) {
+      if (entry.parent == array && entry.kind == CacheKind::Element &&
+          entry.key <= index && (position == npos || entry.key >= i)) {
+        i = entry.key;
+        position = entry.value;
+      }
+    }
+
+    ResourceManager resources(allocator_);
+    Parser parser(&resources, readerAt(position == npos ? array : position));
+    if (position == npos) {
+      parser.accept('[');
+      char c = parser.peek();
+      if (!c || c == ']')
+        return npos;
+    }
+
+    for (; i < index; i++) {
+      if (parser.skip(nestingLimit()) || !parser.accept(','))
+        return npos;
+      if (!parser.peek())
+        return npos;
+    }
+
+    position = offsetOf(parser.position());
+    remember(array, CacheKind::Element, index, position);
+    return position;
+  }
+
+  // Returns the value of the first member with the specified key, or of the
+  // last one if ARDUINOJSON_LAZY_DOCUMENT_DUPLICATE_KEYS is set. In that case,
+  // the first lookup can't stop at the first match: it skips every member of
+  // the object. The next lookups of the same key only read the cache.
+  template <typename TAdaptedString>
+  size_t memberAt(size_t object, TAdaptedString key) const {
+    if (typeAt(object) != '{' || key.isNull())
+      return npos;
+
+    ResourceManager resources(allocator_);
+
+    // the members we already found
+    for (auto& entry : cache_) {
+      if (entry.parent != object || entry.kind != CacheKind::Member)
+        continue;
+      Parser parser(&resources, readerAt(entry.key));
+      bool match = false;
+      if (!parser.matchKey(key, match) && match)
+        return entry.value;
+    }
+
+    Parser parser(&resources, readerAt(object));
+    parser.accept('{');
+    if (parser.peek() == '}')
+      return npos;
+
+    size_t keyPosition = npos, position = npos;
+    for (;;) {
+      if (!parser.peek())
+        break;
+      size_t currentKey = offsetOf(parser.position());
+
+      bool match = false;
+      if (parser.matchKey(key, match) || !parser.peek())
+        break;
+
+      if (match) {
+        keyPosition = currentKey;
+        position = offsetOf(parser.position());
+#if !ARDUINOJSON_LAZY_DOCUMENT_DUPLICATE_KEYS
+        break;
+#endif
+      }
+
+      if (parser.skip(nestingLimit()) || !parser.accept(','))
+        break;
+    }
+
+    if (position != npos)
+      remember(object, CacheKind::Member, keyPosition, position);
+    return position;
+  }
+
+  // Returns the number of elements or members, or 0 if the value is invalid
+  size_t sizeAt(size_t value) const {
+    char open = typeAt(value);
+    if (open != '[' && open != '{')
+      return 0;
+    char close = open == '[' ? ']' : '}';
+
+    for (auto& entry : cache_) {
+      if (entry.parent == value && entry.kind == CacheKind::Size)
+        return entry.value;
+    }
+
+    ResourceManager resources(allocator_);
+    Parser parser(&resources, readerAt(value));
+    parser.accept(open);
+
+    size_t n = 0;
+    if (!parser.accept(close)) {
+      for (;;) {
+        bool match;
+        if (open == '{' && parser.matchKey(adaptString(""), match))
+          return 0;
+        if (parser.skip(nestingLimit()))
+          return 0;
+        n++;
+        if (parser.accept(close))
+          break;
+        if (!parser.accept(','))
+          return 0;
+      }
+    }
+
+    remember(value, CacheKind::Size, 0, n);
+    return n;
+  }
+
+  // Returns the position after the value, or npos if it's invalid
+  size_t endOf(size_t value) const {
+    if (value >= size_)
+      return npos;
+    ResourceManager resources(allocator_);
+    Parser parser(&resources, readerAt(value));
+    if (parser.skip(nestingLimit()))
+      return npos;
+    return offsetOf(parser.position());
+  }
+
+  // Parses a number the way JsonDeserializer does
+  Number numberAt(size_t value) const {
+    char buffer[64];
+    uint8_t n = 0;
+    for (size_t i = value;
+         i < size_ && n < 63 && JsonGrammar::canBeInNumber(json_[i]); i++)
+      buffer[n++] = json_[i];
+    buffer[n] = 0;
+    return parseNumber(buffer);
+  }
+
+  // Deserializes the value in a JsonDocument
+  void parseAt(size_t value, JsonDocument& doc) const {
+    size_t end = endOf(value);
+    if (end != npos)
+      deserializeJson(doc, json_ + value, end - value);
+  }
+
+  Allocator* allocator() const {
+    return allocator_;
+  }
+
+ private:
+  enum class CacheKind : uint8_t {
+    Element,  // key is the index
+    Member,   // key is the position of the key
+    Size,     // value is the size
+  };
+
+  struct CacheEntry {
+    size_t parent = npos;
+    size_t key = 0;
+    size_t value = 0;
+    CacheKind kind = CacheKind::Element;
+  };
+
+  static DeserializationOption::NestingLimit nestingLimit() {
+    return DeserializationOption::NestingLimit();
+  }
+
+  BoundedReader<const char*> readerAt(size_t position) const {
+    return BoundedReader<const char*>(json_ + position, size_ - position);
+  }
+
+  size_t offsetOf(const char* p) const {
+    return size_t(p - json_);
+  }
+
+  // Replaces the oldest entry
+  void remember(size_t parent, CacheKind kind, size_t key, size_t value) const {
+    auto& entry = cache_[nextEntry_];
+    entry.parent = parent;
+    entry.kind = kind;
+    entry.key = key;
+    entry.value = value;
+    if (++nextEntry_ == ARDUINOJSON_LAZY_DOCUMENT_CACHE_SIZE)
+      nextEntry_ = 0;
+  }
+
+  const char* json_;
+  size_t size_;
+  Allocator* allocator_;
+  size_t root_;
+  mutable CacheEntry cache_[ARDUINOJSON_LAZY_DOCUMENT_CACHE_SIZE];
+  mutable size_t nextEntry_ = 0;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// A read-only reference to a value in a JsonLazyDocument.
+class JsonLazyVariantConst {
+  using Input = detail::LazyJsonInput;
+
+ public:
+  // Creates an unbound reference.
+  JsonLazyVariantConst() : input_(nullptr), position_(Input::npos) {}
+
+  // INTERNAL USE ONLY
+  JsonLazyVariantConst(const Input* input, size_t position)
+      : input_(input), position_(input ? position : Input::npos) {}
+
+  // Returns true if the value is null, or if the reference is unbound.
+  bool isNull() const {
+    return type() == 'n' || type() == 0;
+  }
+
+  // Returns the number of elements of an array, the number of members of an
+  // object, or 0.
+  size_t size() const {
+    return input_ ? input_->sizeAt(position_) : 0;
+  }
+
+  // Casts the value to the specified type.
+  // The numbers and the booleans are read in place; the other types go
+  // through a temporary JsonDocument and Converter<T>.
+  template <typename T>
+  T as() const {
+    return as(type_tag<T>());
+  }
+
+  // Returns true if the value is of the specified type.
+  template <typename T>
+  bool is() const {
+    return is(type_tag<T>());
+  }
+
+  template <typename T>
+  operator T() const {
+    return as<T>();
+  }
+
+  // Gets array's element at specified index.
+  template <typename T,
+            detail::enable_if_t<detail::is_integral<T>::value, int> = 0>
+  JsonLazyVariantConst operator[](T index) const {
+    if (!input_)
+      return JsonLazyVariantConst();
+    return JsonLazyVariantConst(input_,
+                                input_->elementAt(position_, size_t(index)));
+  }
+
+  // Gets object's member with specified key.
+  template <typename TString,
+            detail::enable_if_t<detail::IsString<TString>::value, int> = 0>
+  JsonLazyVariantConst operator[](const TString& key) const {
+    return getMember(detail::adaptString(key));
+  }
+
+  // Gets object's member with specified key.
+  template <typename TChar,
+            detail::enable_if_t<detail::IsString<TChar*>::value &&
+                                    !detail::is_const<TChar>::value,
+                                int> = 0>
+  JsonLazyVariantConst operator[](TChar* key) const {
+    return getMember(detail::adaptString(key));
+  }
+
+ private:
+  template <typename T>
+  struct type_tag {};
+
+  char type() const {
+    return input_ ? input_->typeAt(position_) : 0;
+  }
+
+  bool isNumber() const {
+    switch (type()) {
+      case 0:
+      case '[':
+      case '{':
+      case '"':
+      case '\'':
+      case 't':
+      case 'f':
+      case 'n':
+        return false;
+      default:
+        return true;
+    }
+  }
+
+  template <typename TAdaptedString>
+  JsonLazyVariantConst getMember(TAdaptedString key) const {
+    if (!input_)
+      return JsonLazyVariantConst();
+    return JsonLazyVariantConst(input_, input_->memberAt(position_, key));
+  }
+
+  bool as(type_tag<bool>) const {
+    switch (type()) {
+      case 't':
+        return true;
+      case 0:
+      case 'f':
+      case 'n':
+        return false;
+      default:
+        if (isNumber())
+          return input_->numberAt(position_).convertTo<double>() != 0;
+        return true;
+    }
+  }
+
+  template <typename T>
+  detail::enable_if_t<detail::is_integral<T>::value ||
+                          detail::is_floating_point<T>::value,
+                      T>
+  as(type_tag<T>) const {
+    switch (type()) {
+      case 't':
+        return T(1);
+      case '"':
+      case '\'':
+        return parse<T>();  // to decode the escape sequences
+      default:
+        if (isNumber())
+          return input_->numberAt(position_).convertTo<T>();
+        return T(0);
+    }
+  }
+
+  // Other types, like std::string or the custom converters
+  template <typename T>
+  detail::enable_if_t<!detail::is_integral<T>::value &&
+                          !detail::is_floating_point<T>::value,
+                      T>
+  as(type_tag<T>) const {
+    static_assert(!detail::IsDocumentReference<T>::value,
+                  "JsonLazyVariantConst can't return a reference; "
+                  "use as<std::string>() or deserializeJson()");
+    return parse<T>();
+  }
+
+  bool is(type_tag<bool>) const {
+    return type() == 't' || type() == 'f';
+  }
+
+  template <typename T>
+  detail::enable_if_t<detail::is_integral<T>::value, bool> is(
+      type_tag<T>) const {
+    if (!isNumber())
+      return false;
+    auto number = input_->numberAt(position_);
+    switch (number.type()) {
+      case detail::NumberType::SignedInteger:
+        return detail::canConvertNumber<T>(number.asSignedInteger());
+      case detail::NumberType::UnsignedInteger:
+        return detail::canConvertNumber<T>(number.asUnsignedInteger());
+      default:
+        return false;
+    }
+  }
+
+  template <typename T>
+  detail::enable_if_t<detail::is_floating_point<T>::value, bool> is(
+      type_tag<T>) const {
+    return isNumber() &&
+           input_->numberAt(position_).type() != detail::NumberType::Invalid;
+  }
+
+  template <typename T>
+  detail::enable_if_t<detail::IsString<T>::value, bool> is(type_tag<T>) const {
+    return type() == '"' || type() == '\'';
+  }
+
+  bool is(type_tag<JsonArrayConst>) const {
+    return type() == '[';
+  }
+
+  bool is(type_tag<JsonArray>) const {
+    return type() == '[';
+  }
+
+  bool is(type_tag<JsonObjectConst>) const {
+    return type() == '{';
+  }
+
+  bool is(type_tag<JsonObject>) const {
+    return type() == '{';
+  }
+
+  // Other types, like the custom converters
+  template <typename T>
+  detail::enable_if_t<!detail::is_integral<T>::value &&
+                          !detail::is_floating_point<T>::value &&
+                          !detail::IsString<T>::value,
+                      bool>
+  is(type_tag<T>) const {
+    if (!input_)
+      return JsonVariantConst().is<T>();
+    JsonDocument doc(input_->allocator());
+    input_->parseAt(position_, doc);
+    return doc.is<T>();
+  }
+
+  template <typename T>
+  T parse() const {
+    if (!input_)
+      return JsonVariantConst().as<T>();
+    JsonDocument doc(input_->allocator());
+    input_->parseAt(position_, doc);
+    return doc.as<T>();
+  }
+
+  const Input* input_;
+  size_t position_;
+};
+
+// A read-only JSON document that parses only the values the program reads.
+// It keeps a pointer to the input, which must outlive the document, and
+// remembers the positions of the last values it found, so that reading them
+// again, or reading the next element of an array, is cheap. Its size doesn't
+// depend on the size of the input.
+// Unlike deserializeJson(), it doesn't validate the parts of the input that it
+// skips, and it returns the first member when a key appears twice (see
+// ARDUINOJSON_LAZY_DOCUMENT_DUPLICATE_KEYS).
+// It's not thread-safe, even for reading, because of the cache.
+class JsonLazyDocument {
+ public:
+  explicit JsonLazyDocument(
+      const char* json,
+      Allocator* allocator = detail::DefaultAllocator::instance())
+      : input_(json, json ? strlen(json) : 0, allocator) {}
+
+  JsonLazyDocument(const char* json, size_t size,
+                   Allocator* allocator = detail::DefaultAllocator::instance())
+      : input_(json, size, allocator) {}
+
+  // The variants point to the input object
+  JsonLazyDocument(const JsonLazyDocument&) = delete;
+  JsonLazyDocument& operator=(const JsonLazyDocument&) = delete;
+
+  // Returns a reference to the root value.
+  JsonLazyVariantConst root() const {
+    return JsonLazyVariantConst(&input_, input_.root());
+  }
+
+  // Returns true if the input contains no value, or if it's null.
+  bool isNull() const {
+    return root().isNull();
+  }
+
+  // Returns the number of elements or members of the root.
+  size_t size() const {
+    return root().size();
+  }
+
+  // Casts the root to the specified type.
+  template <typename T>
+  T as() const {
+    return root().as<T>();
+  }
+
+  // Returns true if the root is of the specified type.
+  template <typename T>
+  bool is() const {
+    return root().is<T>();
+  }
+
+  // Gets the root array's element at specified index.
+  template <typename T,
+            detail::enable_if_t<detail::is_integral<T>::value, int> = 0>
+  JsonLazyVariantConst operator[](T index) const {
+    return root()[index];
+  }
+
+  // Gets the root object's member with specified key.
+  template <typename TString,
+            detail::enable_if_t<detail::IsString<TString>::value, int> = 0>
+  JsonLazyVariantConst operator[](const TString& key) const {
+    return root()[key];
+  }
+
+  // Gets the root object's member with specified key.
+  template <typename TChar,
+            detail::enable_if_t<detail::IsString<TChar*>::value &&
+                                    !detail::is_const<TChar>::value,
+                                int> = 0>
+  JsonLazyVariantConst operator[](TChar* key) const {
+    return root()[key];
+  }
+
+ private:
+  detail::LazyJsonInput input_;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -0,0 +1,432 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Document/JsonDocument.hpp>
+#include <ArduinoJson/Json/JsonDeserializer.hpp>
+#include <ArduinoJson/Json/JsonSerializer.hpp>
+#include <ArduinoJson/Serialization/BufferingDecorator.hpp>
+
+#include <string.h>  // memchr
+
+#if ARDUINOJSON_ENABLE_STD_THREAD
+#  include <atomic>
+#  include <condition_variable>
+#  include <mutex>
+#  include <new>
+#  include <thread>
+#endif
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+inline bool isJsonLineSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+// Calls f(line, length) for each line of [begin, end) that isn't blank.
+// The lines are trimmed, because a float at the root can't be followed by
+// anything. Stops at the first error returned by f.
+template <typename TFunction>
+DeserializationError forEachJsonLine(const char* begin, const char* end,
+                                     TFunction f) {
+  while (begin < end) {
+    auto eol = reinterpret_cast<const char*>(
+        memchr(begin, '\n', size_t(end - begin)));
+    if (!eol)
+      eol = end;
+    auto first = begin;
+    auto last = eol;
+    while (first < last && isJsonLineSpace(*first))
+      first++;
+    while (last > first && isJsonLineSpace(last[-1]))
+      last--;
+    if (first < last) {
+      auto err = f(first, size_t(last - first));
+      if (err)
+        return err;
+    }
+    begin = eol + 1;
+  }
+  return DeserializationError::Ok;
+}
+
+template <typename THandler, typename TOptions>
+DeserializationError deserializeLines(JsonDocument& doc, const char* input,
+                                      size_t inputSize, THandler& handler,
+                                      TOptions options) {
+  // keep the memory of the document from one record to the next
+  doc.clear(true);
+  return forEachJsonLine(
+      input, input + inputSize,
+      [&](const char* line, size_t n) -> DeserializationError {
+        auto err = doDeserialize<JsonDeserializer>(doc, makeReader(line, n),
+                                                   options);
+        if (!err)
+          handler(doc);
+        return err;
+      });
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Parses newline-delimited JSON (JSON Lines, NDJSON), and calls
+// handler(JsonDocument&) for each record. Blank lines are ignored.
+// The same document is used for all the records and keeps its memory from one
+// to the next. Stops at the first error.
+template <typename TString, typename THandler, typename... Args,
+          detail::enable_if_t<
+              detail::is_same<detail::AdaptedString<const TString&>,
+                              detail::RamString>::value &&
+                  !detail::is_integral<THandler>::value,
+              int> = 0>
+inline DeserializationError deserializeJsonLines(JsonDocument& doc,
+                                                 const TString& input,
+                                                 THandler handler,
+                                                 const Args&... args) {
+  auto s = detail::adaptString(input);
+  return detail::deserializeLines(doc, s.data(), s.size(), handler,
+                                  detail::makeDeserializationOptions(args...));
+}
+
+template <typename TChar, typename Size, typename THandler, typename... Args,
+          detail::enable_if_t<detail::is_integral<Size>::value, int> = 0>
+inline DeserializationError deserializeJsonLines(JsonDocument& doc,
+                                                 TChar* input, Size inputSize,
+                                                 THandler handler,
+                                                 const Args&... args) {
+  return detail::deserializeLines(doc, reinterpret_cast<const char*>(input),
+                                  size_t(inputSize), handler,
+                                  detail::makeDeserializationOptions(args...));
+}
+
+// Writes newline-delimited JSON (JSON Lines, NDJSON).
+// The lines are gathered in a buffer of N bytes and sent to the destination
+// in batches, so the destination receives few large writes.
+template <typename TDestination, size_t N = 512>
+class JsonLinesWriter {
+  using Buffer = detail::BufferingDecorator<detail::Writer<TDestination>, N>;
+
+ public:
+  explicit JsonLinesWriter(TDestination& destination)
+      : buffer_(detail::Writer<TDestination>(destination)) {}
+
+  ~JsonLinesWriter() {
+    flush();
+  }
+
+  // Writes the value on one line.
+  // Returns the number of bytes written, including the newline.
+  size_t write(JsonVariantConst source) {
+    size_t n = detail::doSerialize<detail::JsonSerializer>(
+        source, detail::Writer<Buffer>(buffer_));
+    return n + buffer_.write('\n');
+  }
+
+  // Sends the pending lines to the destination.
+  // Returns false if some bytes couldn't be written since the beginning.
+  bool flush() {
+    return buffer_.flush() == 0;
+  }
+
+ private:
+  Buffer buffer_;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
+
+#if ARDUINOJSON_ENABLE_STD_THREAD
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+struct JsonLinesOptions {
+  // The number of threads, including the calling one
+  // (0 means std::thread::hardware_concurrency())
+  size_t threads = 0;
+
+  // The input is cut in chunks of about this size, aligned on the lines.
+  // Each worker parses one chunk at a time.
+  size_t chunkSize = 1 << 20;
+
+  // If true, the handler is called for one record at a time, in the order of
+  // the input. Each worker keeps the records of its chunk until the previous
+  // chunks are done.
+  // If false, the workers call the handler concurrently, as soon as they
+  // parse a record, so the handler must be thread-safe.
+  bool ordered = false;
+
+  // The capacity reserved in the documents of the workers
+  // (see JsonDocument::reserve())
+  size_t values = 0;
+  size_t stringBytes = 0;
+
+  Allocator* allocator = detail::DefaultAllocator::instance();
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// The documents of a worker, recycled from one chunk to the next
+class JsonLinesBatch {
+ public:
+  explicit JsonLinesBatch(const JsonLinesOptions& options)
+      : options_(options) {}
+
+  JsonLinesBatch(const JsonLinesBatch&) = delete;
+  JsonLinesBatch& operator=(const JsonLinesBatch&) = delete;
+
+  ~JsonLinesBatch() {
+    for (size_t i = 0; i < created_; i++) {
+      docs_[i]->~JsonDocument();
+      options_.allocator->deallocate(docs_[i]);
+    }
+    if (docs_)
+      options_.allocator->deallocate(docs_);
+  }
+
+  // Returns the document for the next record, or null if allocation fails
+  JsonDocument* next() {
+    if (count_ == created_ && !create())
+      return nullptr;
+    return docs_[count_++];
+  }
+
+  // Removes the last document returned by next()
+  void pop() {
+    ARDUINOJSON_ASSERT(count_ > 0);
+    count_--;
+  }
+
+  size_t size() const {
+    return count_;
+  }
+
+  JsonDocument& operator[](size_t i) const {
+    ARDUINOJSON_ASSERT(i < count_);
+    return *docs_[i];
+  }
+
+  void clear() {
+    count_ = 0;
+  }
+
+ private:
+  bool create() {
+    if (created_ == capacity_) {
+      size_t newCapacity = capacity_ ? capacity_ * 2 : 16;
+      auto newDocs = reinterpret_cast<JsonDocument**>(
+          options_.allocator->reallocate(docs_,
+                                         newCapacity * sizeof(JsonDocument*)));
+      if (!newDocs)
+        return false;
+      docs_ = newDocs;
+      capacity_ = newCapacity;
+    }
+
+    void* p = options_.allocator->allocate(sizeof(JsonDocument));
+    if (!p)
+      return false;
+    auto doc = new (p) JsonDocument(options_.allocator);
+    // keep the memory from one chunk to the next
+    if (!options_.values && !options_.stringBytes)
+      doc->clear(true);
+    else if (!doc->reserve(options_.values, options_.stringBytes))
+      doc->clear(true);  // let it allocate on demand
+    docs_[created_++] = doc;
+    return true;
+  }
+
+  const JsonLinesOptions& options_;
+  JsonDocument** docs_ = nullptr;
+  size_t count_ = 0;
+  size_t created_ = 0;
+  size_t capacity_ = 0;
+};
+
+template <typename THandler, typename TOptions>
+class ParallelJsonLinesParser {
+ public:
+  ParallelJsonLinesParser(const char* input, size_t inputSize,
+                          THandler& handler, TOptions deserializationOptions,
+                          const JsonLinesOptions& options)
+      : begin_(input),
+        end_(input + inputSize),
+        handler_(handler),
+        deserializationOptions_(deserializationOptions),
+        options_(options),
+        chunkSize_(options.chunkSize ? options.chunkSize : 1),
+        chunkCount_((inputSize + chunkSize_ - 1) / chunkSize_),
+        nextChunk_(0),
+        errorChunk_(chunkCount_),
+        error_(DeserializationError::Ok) {}
+
+  DeserializationError run() {
+    size_t threadCount = options_.threads;
+    if (!threadCount)
+      threadCount = std::thread::hardware_concurrency();
+    if (threadCount > chunkCount_)
+      threadCount = chunkCount_;
+
+    // the calling thread is one of the workers
+    std::thread* threads = nullptr;
+    if (threadCount > 1) {
+      size_t bytes = (threadCount - 1) * sizeof(std::thread);
+      threads =
+          reinterpret_cast<std::thread*>(options_.allocator->allocate(bytes));
+      if (!threads)
+        threadCount = 1;
+    }
+    for (size_t i = 0; i + 1 < threadCount; i++)
+      new (&threads[i]) std::thread(&ParallelJsonLinesParser::work, this);
+    work();
+    for (size_t i = 0; i + 1 < threadCount; i++) {
+      threads[i].join();
+      threads[i].~thread();
+    }
+    if (threads)
+      options_.allocator->deallocate(threads);
+
+    return error_;
+  }
+
+ private:
+  void work() {
+    JsonLinesBatch batch(options_);
+    for (;;) {
+      size_t chunk = nextChunk_.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= chunkCount_)
+        return;
+
+      batch.clear();
+      DeserializationError err = DeserializationError::Ok;
+      if (chunk < errorChunk_.load(std::memory_order_relaxed))
+        err = parseChunk(chunk, batch);
+
+      if (options_.ordered)
+        emitInOrder(chunk, batch, err);
+      else if (err)
+        setError(chunk, err);
+    }
+  }
+
+  // Parses the records of the chunk. In ordered mode, they stay in the batch;
+  // otherwise, they're passed to the handler right away.
+  DeserializationError parseChunk(size_t chunk, JsonLinesBatch& batch) {
+    return forEachJsonLine(
+        chunkStart(chunk), chunkStart(chunk + 1),
+        [&](const char* line, size_t n) -> DeserializationError {
+          JsonDocument* doc = batch.next();
+          if (!doc)
+            return DeserializationError::NoMemory;
+          auto err = doDeserialize<JsonDeserializer>(
+              *doc, makeReader(line, n), deserializationOptions_);
+          if (err) {
+            batch.pop();
+            return err;
+          }
+          if (!options_.ordered) {
+            handler_(*doc);
+            batch.clear();  // the next record reuses the same document
+          }
+          return err;
+        });
+  }
+
+  // Waits for the previous chunks, then calls the handler for the records
+  void emitInOrder(size_t chunk, JsonLinesBatch& batch,
+                   DeserializationError err) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    turnChanged_.wait(lock, [&]() { return turn_ == chunk; });
+    if (chunk < errorChunk_.load(std::memory_order_relaxed)) {
+      for (size_t i = 0; i < batch.size(); i++)
+        handler_(batch[i]);
+      if (err) {
+        error_ = err;
+        errorChunk_.store(chunk, std::memory_order_relaxed);
+      }
+    }
+    turn_++;
+    turnChanged_.notify_all();
+  }
+
+  // Keeps the error of the first chunk
+  void setError(size_t chunk, DeserializationError err) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (chunk < errorChunk_.load(std::memory_order_relaxed)) {
+      error_ = err;
+      errorChunk_.store(chunk, std::memory_order_relaxed);
+    }
+  }
+
+  // Returns the beginning of the first line that starts in the chunk
+  const char* chunkStart(size_t chunk) const {
+    if (chunk == 0)
+      return begin_;
+    if (chunk >= chunkCount_)
+      return end_;
+    // the line starts in the chunk if the previous character is a newline
+    auto p = begin_ + chunk * chunkSize_ - 1;
+    auto eol = reinterpret_cast<const char*>(
+        memchr(p, '\n', size_t(end_ - p)));
+    return eol ? eol + 1 : end_;
+  }
+
+  const char* begin_;
+  const char* end_;
+  THandler& handler_;
+  TOptions deserializationOptions_;
+  const JsonLinesOptions& options_;
+  size_t chunkSize_;
+  size_t chunkCount_;
+
+  std::atomic<size_t> nextChunk_;
+  std::atomic<size_t> errorChunk_;  // chunkCount_ if no error
+
+  std::mutex mutex_;
+  std::condition_variable turnChanged_;
+  size_t turn_ = 0;  // the next chunk to emit, in ordered mode
+  DeserializationError error_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Parses newline-delimited JSON (JSON Lines, NDJSON) on several threads, and
+// calls handler(JsonDocument&) for each record. Blank lines are ignored.
+// Each worker has its own documents, which keep their memory from one record
+// to the next. Stops at the first error; in unordered mode, the handler may
+// already have received some of the records that follow the error.
+template <typename TString, typename THandler, typename... Args,
+          detail::enable_if_t<
+              detail::is_same<detail::AdaptedString<const TString&>,
+                              detail::RamString>::value,
+              int> = 0>
+inline DeserializationError deserializeJsonLinesParallel(
+    const TString& input, THandler handler, const JsonLinesOptions& options,
+    const Args&... args) {
+  auto s = detail::adaptString(input);
+  return deserializeJsonLinesParallel(s.data(), s.size(), handler, options,
+                                      args...);
+}
+
+template <typename TChar, typename Size, typename THandler, typename... Args,
+          detail::enable_if_t<detail::is_integral<Size>::value, int> = 0>
+inline DeserializationError deserializeJsonLinesParallel(
+    TChar* input, Size inputSize, THandler handler,
+    const JsonLinesOptions& options, const Args&... args) {
+  auto deserializationOptions = detail::makeDeserializationOptions(args...);
+  return detail::ParallelJsonLinesParser<THandler,
+                                         decltype(deserializationOptions)>(
+             reinterpret_cast<const char*>(input), size_t(inputSize), handler,
+             deserializationOptions, options)
+      .run();
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
+
+#endif
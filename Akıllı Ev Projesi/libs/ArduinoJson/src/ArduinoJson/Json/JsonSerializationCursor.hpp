@@ -0,0 +1,110 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Json/JsonSerializer.hpp>
+#include <ArduinoJson/Serialization/SerializationCursor.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+template <typename TWriter>
+class JsonCursorFormat : public JsonSerializer<TWriter> {
+  using base = JsonSerializer<TWriter>;
+
+ public:
+  JsonCursorFormat(TWriter writer, const ResourceManager* resources)
+      : base(writer, resources) {}
+
+  void writeStart(bool isObject, size_t) {
+    base::write(isObject ? '{' : '[');
+  }
+
+  void writeSeparator(bool first, bool isValue, size_t) {
+    if (isValue)
+      base::write(':');
+    else if (!first)
+      base::write(',');
+  }
+
+  void writeEnd(bool isObject, bool, size_t) {
+    base::write(isObject ? '}' : ']');
+  }
+
+  void writeStringStart(size_t) {
+    base::write('\"');
+  }
+
+  void writeStringPart(const char* s, size_t n) {
+    base::writeStringContent(s, n);
+  }
+
+  void writeStringEnd() {
+    base::write('\"');
+  }
+};
+
+template <typename TWriter>
+class PrettyJsonCursorFormat : public JsonSerializer<TWriter> {
+  using base = JsonSerializer<TWriter>;
+
+ public:
+  PrettyJsonCursorFormat(TWriter writer, const ResourceManager* resources)
+      : base(writer, resources) {}
+
+  void writeStart(bool isObject, size_t) {
+    base::write(isObject ? '{' : '[');
+  }
+
+  void writeSeparator(bool first, bool isValue, size_t depth) {
+    if (isValue) {
+      base::write(": ");
+    } else {
+      base::write(first ? "\r\n" : ",\r\n");
+      indent(depth);
+    }
+  }
+
+  void writeEnd(bool isObject, bool empty, size_t depth) {
+    if (!empty) {
+      base::write("\r\n");
+      indent(depth - 1);
+    }
+    base::write(isObject ? '}' : ']');
+  }
+
+  void writeStringStart(size_t) {
+    base::write('\"');
+  }
+
+  void writeStringPart(const char* s, size_t n) {
+    base::writeStringContent(s, n);
+  }
+
+  void writeStringEnd() {
+    base::write('\"');
+  }
+
+ private:
+  void indent(size_t depth) {
+    for (size_t i = 0; i < depth; i++)
+      base::write(ARDUINOJSON_TAB);
+  }
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Produces a minified JSON document in chunks of any size.
+// Each call to read() resumes where the previous one stopped, so the
+// document is serialized only once.
+using JsonSerializationCursor =
+    detail::SerializationCursor<detail::JsonCursorFormat>;
+
+// Produces a prettified JSON document in chunks of any size.
+using PrettyJsonSerializationCursor =
+    detail::SerializationCursor<detail::PrettyJsonCursorFormat>;
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
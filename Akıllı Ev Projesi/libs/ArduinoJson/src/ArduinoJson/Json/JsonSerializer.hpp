@@ -116,6 +116,10 @@ class JsonSerializer : public VariantDataVisitor<size_t> {
     formatter_.writeRaw(s);
   }
 
+  void writeStringContent(const char* s, size_t n) {
+    formatter_.writeStringContent(s, n);
+  }
+
  private:
   TextFormatter<TWriter> formatter_;
 
@@ -0,0 +1,575 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Deserialization/deserialize.hpp>
+#include <ArduinoJson/Json/EscapeSequence.hpp>
+#include <ArduinoJson/Json/JsonGrammar.hpp>
+#include <ArduinoJson/Json/StringScanner.hpp>
+#include <ArduinoJson/Json/Utf16.hpp>
+#include <ArduinoJson/Json/Utf8.hpp>
+#include <ArduinoJson/Memory/ResourceManager.hpp>
+#include <ArduinoJson/Memory/StringBuilder.hpp>
+#include <ArduinoJson/Numbers/parseNumber.hpp>
+#include <ArduinoJson/Variant/VariantData.hpp>
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Parses a JSON input that arrives in chunks, and puts the result in a
+// JsonDocument.
+// Unlike deserializeJson(), it keeps its position between the chunks, so the
+// input doesn't need to be buffered. The document must outlive the parser.
+class JsonStreamParser {
+  using Code = DeserializationError::Code;
+  using Filter = DeserializationOption::Filter;
+  using NestingLimit = DeserializationOption::NestingLimit;
+
+ public:
+  explicit JsonStreamParser(JsonDocument& doc, NestingLimit nestingLimit = {})
+      : JsonStreamParser(doc, Filter(JsonVariantConst()), nestingLimit, false) {
+  }
+
+  JsonStreamParser(JsonDocument& doc, Filter filter,
+                   NestingLimit nestingLimit = {})
+      : JsonStreamParser(doc, filter, nestingLimit, true) {}
+
+  JsonStreamParser(JsonDocument& doc, NestingLimit nestingLimit, Filter filter)
+      : JsonStreamParser(doc, filter, nestingLimit, true) {}
+
+  JsonStreamParser(const JsonStreamParser&) = delete;
+  JsonStreamParser& operator=(const JsonStreamParser&) = delete;
+
+  ~JsonStreamParser() {
+    if (frames_)
+      resources_->allocator()->deallocate(frames_);
+  }
+
+  // Parses the next chunk of the input.
+  // Returns Ok, unless the input read so far is invalid.
+  DeserializationError feed(const char* input, size_t inputSize) {
+    const char* p = input;
+    const char* end = input + inputSize;
+    while (p < end && !error_) {
+      if (state_ == State::String) {
+        // consume the characters that need no unescaping in one go
+        const char* q = detail::findEndOfPlainChars(p, end, stopChar_);
+        if (saving_)
+          stringBuilder_.append(p, size_t(q - p));
+        p = q;
+        if (p == end)
+          break;
+      }
+      if (*p == '\0')  // like deserializeJson(), stop at the null-terminator
+        return finish();
+      if (step(*p))
+        p++;
+    }
+    return error_;
+  }
+
+  DeserializationError feed(const uint8_t* input, size_t inputSize) {
+    return feed(reinterpret_cast<const char*>(input), inputSize);
+  }
+
+  // Tells the parser that the input is complete.
+  // Returns the same errors as deserializeJson().
+  DeserializationError finish() {
+    if (!error_ && state_ != State::Done) {
+      if (state_ == State::Number && depth_ == 0)
+        endNumber();
+      else
+        error_ = foundSomething_ || inComment()
+                     ? DeserializationError::IncompleteInput
+                     : DeserializationError::EmptyInput;
+    }
+    detail::shrinkJsonDocument(doc_);
+    return error_;
+  }
+
+ private:
+  enum class State : uint8_t {
+    Value,
+    ArrayStart,
+    ArrayElement,
+    ObjectStart,
+    ObjectKey,
+    Colon,
+    AfterValue,
+    String,
+    Escape,
+    Hex,
+    NonQuotedKey,
+    Number,
+    Keyword,
+#if ARDUINOJSON_ENABLE_COMMENTS
+    CommentStart,
+    BlockComment,
+    BlockCommentStar,
+    LineComment,
+#endif
+    Done,
+  };
+
+  // An array or an object that is still open.
+  // collection is null when the filter skips it.
+  struct Frame {
+    detail::CollectionData* collection;
+    Filter filter;  // for objects, the filter of the object itself
+                    // for arrays, the filter of the elements
+    NestingLimit nestingLimit;  // the limit for the children
+    bool isObject;
+  };
+
+  JsonStreamParser(JsonDocument& doc, Filter filter, NestingLimit nestingLimit,
+                   bool filtering)
+      : doc_(doc),
+        resources_(detail::VariantAttorney::getResourceManager(doc)),
+        stringBuilder_(resources_),
+        filter_(filter),
+        nestingLimit_(nestingLimit),
+        filtering_(filtering) {
+    value_ = detail::VariantAttorney::getOrCreateData(doc);
+    if (!value_)
+      error_ = DeserializationError::NoMemory;
+    detail::clearDestination(doc);
+  }
+
+  // Returns false if c must be processed again in the new state
+  bool step(char c) {
+    if (skipsSpaces()) {
+      switch (c) {
+        case ' ':
+        case '\t':
+        case '\r':
+        case '\n':
+          return true;
+#if ARDUINOJSON_ENABLE_COMMENTS
+        case '/':
+          commentReturnState_ = state_;
+          state_ = State::CommentStart;
+          return true;
+#endif
+        default:
+          foundSomething_ = true;
+      }
+    }
+
+    switch (state_) {
+      case State::Value:
+        return startValue(c);
+
+      case State::ArrayStart:
+        if (c == ']')
+          return pop();
+        state_ = State::ArrayElement;
+        return false;
+
+      case State::ArrayElement:
+        return startElement();
+
+      case State::ObjectStart:
+        if (c == '}')
+          return pop();
+        state_ = State::ObjectKey;
+        return false;
+
+      case State::ObjectKey:
+        return startKey(c);
+
+      case State::Colon:
+        if (c != ':')
+          return fail(DeserializationError::InvalidInput);
+        return startMember();
+
+      case State::AfterValue:
+        if (c == (top().isObject ? '}' : ']'))
+          return pop();
+        if (c != ',')
+          return fail(DeserializationError::InvalidInput);
+        state_ = top().isObject ? State::ObjectKey : State::ArrayElement;
+        return true;
+
+      case State::String:
+        if (c == stopChar_)
+          return endString();
+        if (c == '\\')
+          state_ = State::Escape;
+        else if (saving_)
+          stringBuilder_.append(c);
+        return true;
+
+      case State::Escape:
+        return unescape(c);
+
+      case State::Hex:
+        return appendHex(c);
+
+      case State::NonQuotedKey:
+        if (detail::JsonGrammar::canBeInNonQuotedString(c)) {
+          if (saving_)
+            stringBuilder_.append(c);
+          return true;
+        }
+        if (saving_ && !stringBuilder_.isValid())
+          return fail(DeserializationError::NoMemory);
+        state_ = State::Colon;
+        return false;
+
+      case State::Number:
+        if (detail::JsonGrammar::canBeInNumber(c) &&
+            (!saving_ || numberLength_ < sizeof(number_) - 1)) {
+          if (saving_)
+            number_[numberLength_++] = c;
+          return true;
+        }
+        endNumber();
+        return false;
+
+      case State::Keyword:
+        if (c != *keyword_)
+          return fail(DeserializationError::InvalidInput);
+        if (*++keyword_ == '\0')
+          endValue();
+        return true;
+
+#if ARDUINOJSON_ENABLE_COMMENTS
+      case State::CommentStart:
+        if (c == '*')
+          state_ = State::BlockComment;
+        else if (c == '/')
+          state_ = State::LineComment;
+        else
+          return fail(DeserializationError::InvalidInput);
+        return true;
+
+      case State::BlockComment:
+        if (c == '*')
+          state_ = State::BlockCommentStar;
+        return true;
+
+      case State::BlockCommentStar:
+        if (c == '/')
+          state_ = commentReturnState_;
+        else if (c != '*')
+          state_ = State::BlockComment;
+        return true;
+
+      case State::LineComment:
+        if (c == '\n')
+          state_ = commentReturnState_;
+        return true;
+#endif
+
+      case State::Done:
+        // like deserializeJson(), reject the characters after a root number,
+        // because it can't tell where the number ends
+        if (rootNumber_)
+          return fail(DeserializationError::InvalidInput);
+        return true;
+    }
+    return true;
+  }
+
+  bool skipsSpaces() const {
+    return state_ <= State::AfterValue;
+  }
+
+  bool inComment() const {
+    return state_ > State::Keyword && state_ != State::Done;
+  }
+
+  bool startValue(char c) {
+    bool allowValue = value_ && (!filtering_ || filter_.allowValue());
+    switch (c) {
+      case '[':
+        return push(value_ && (!filtering_ || filter_.allowArray()), false);
+
+      case '{':
+        return push(value_ && (!filtering_ || filter_.allowObject()), true);
+
+      case '\"':
+      case '\'':
+        startString(c, allowValue, false);
+        return true;
+
+      case 't':
+        if (allowValue)
+          value_->setBoolean(true);
+        return startKeyword("true");
+
+      case 'f':
+        if (allowValue)
+          value_->setBoolean(false);
+        return startKeyword("false");
+
+      case 'n':
+        // the variant should already by null, except if the same object key was
+        // used twice, as in {"a":1,"a":null}
+        return startKeyword("null");
+
+      default:
+        if (!detail::JsonGrammar::canBeInNumber(c))
+          return fail(DeserializationError::InvalidInput);
+        saving_ = allowValue;
+        numberLength_ = 0;
+        state_ = State::Number;
+        return false;
+    }
+  }
+
+  bool startKeyword(const char* keyword) {
+    keyword_ = keyword + 1;  // the first character was already checked
+    state_ = State::Keyword;
+    return true;
+  }
+
+  void startString(char stopChar, bool saving, bool isKey) {
+    stopChar_ = stopChar;
+    saving_ = saving;
+    isKey_ = isKey;
+    if (saving)
+      stringBuilder_.startString();
+#if ARDUINOJSON_DECODE_UNICODE
+    codepoint_ = detail::Utf16::Codepoint();
+#endif
+    state_ = State::String;
+  }
+
+  bool startKey(char c) {
+    bool saving = top().collection != nullptr;
+    if (detail::JsonGrammar::isQuote(c)) {
+      startString(c, saving, true);
+      return true;
+    }
+    if (!detail::JsonGrammar::canBeInNonQuotedString(c))
+      return fail(DeserializationError::InvalidInput);
+    saving_ = saving;
+    if (saving)
+      stringBuilder_.startString();
+    state_ = State::NonQuotedKey;
+    return false;
+  }
+
+  bool endString() {
+    if (saving_ && !stringBuilder_.isValid())
+      return fail(DeserializationError::NoMemory);
+    if (isKey_) {
+      state_ = State::Colon;
+    } else {
+      if (saving_)
+        stringBuilder_.save(value_);
+      endValue();
+    }
+    return true;
+  }
+
+  bool unescape(char c) {
+    state_ = State::String;
+    if (!saving_)  // like skipQuotedString(), skip any escaped character
+      return true;
+    if (c == 'u') {
+#if ARDUINOJSON_DECODE_UNICODE
+      codeunit_ = 0;
+      hexLength_ = 0;
+      state_ = State::Hex;
+#else
+      stringBuilder_.append('\\');
+      stringBuilder_.append('u');
+#endif
+      return true;
+    }
+    c = detail::EscapeSequence::unescapeChar(c);
+    if (c == '\0')
+      return fail(DeserializationError::InvalidInput);
+    stringBuilder_.append(c);
+    return true;
+  }
+
+  bool appendHex(char c) {
+    uint8_t value = detail::JsonGrammar::decodeHex(c);
+    if (value > 0x0F)
+      return fail(DeserializationError::InvalidInput);
+    codeunit_ = uint16_t((codeunit_ << 4) | value);
+    if (++hexLength_ < 4)
+      return true;
+#if ARDUINOJSON_DECODE_UNICODE
+    if (codepoint_.append(codeunit_))
+      detail::Utf8::encodeCodepoint(codepoint_.value(), stringBuilder_);
+#endif
+    state_ = State::String;
+    return true;
+  }
+
+  void endNumber() {
+    if (saving_) {
+      number_[numberLength_] = 0;
+      Code err = setNumber(detail::parseNumber(number_));
+      if (err) {
+        fail(err);
+        return;
+      }
+      rootNumber_ = depth_ == 0;
+    }
+    endValue();
+  }
+
+  Code setNumber(detail::Number number) {
+    bool ok;
+    switch (number.type()) {
+      case detail::NumberType::UnsignedInteger:
+        ok = value_->setInteger(number.asUnsignedInteger(), resources_);
+        break;
+
+      case detail::NumberType::SignedInteger:
+        ok = value_->setInteger(number.asSignedInteger(), resources_);
+        break;
+
+      case detail::NumberType::Float:
+        ok = value_->setFloat(number.asFloat(), resources_);
+        break;
+
+#if ARDUINOJSON_USE_DOUBLE
+      case detail::NumberType::Double:
+        ok = value_->setFloat(number.asDouble(), resources_);
+        break;
+#endif
+
+      default:
+        return DeserializationError::InvalidInput;
+    }
+    return ok ? DeserializationError::Ok : DeserializationError::NoMemory;
+  }
+
+  void endValue() {
+    state_ = depth_ ? State::AfterValue : State::Done;
+  }
+
+  bool startElement() {
+    const Frame& frame = top();
+    value_ = nullptr;
+    filter_ = frame.filter;
+    if (frame.collection && (!filtering_ || filter_.allow())) {
+      value_ = static_cast<detail::ArrayData*>(frame.collection)
+                   ->addElement(resources_);
+      if (!value_)
+        return fail(DeserializationError::NoMemory);
+    }
+    state_ = State::Value;
+    return false;
+  }
+
+  bool startMember() {
+    const Frame& frame = top();
+    value_ = nullptr;
+    state_ = State::Value;
+    if (!frame.collection)
+      return true;
+
+    JsonString key = stringBuilder_.str();
+    if (filtering_) {
+      filter_ = frame.filter[key];
+      if (!filter_.allow())
+        return true;
+    }
+
+    auto object = static_cast<detail::ObjectData*>(frame.collection);
+    auto member = object->getMember(detail::adaptString(key), resources_);
+    if (!member) {
+      auto keyVariant = object->addPair(&member, resources_);
+      if (!keyVariant)
+        return fail(DeserializationError::NoMemory);
+      stringBuilder_.save(keyVariant);
+    } else {
+      member->clear(resources_);
+    }
+    value_ = member;
+    return true;
+  }
+
+  // Opens an array or an object; keep is false when the filter skips it
+  bool push(bool keep, bool isObject) {
+    NestingLimit nestingLimit = depth_ ? top().nestingLimit : nestingLimit_;
+    if (nestingLimit.reached())
+      return fail(DeserializationError::TooDeep);
+
+    if (depth_ == capacity_) {
+      size_t newCapacity = capacity_ ? capacity_ * 2 : 4;
+      auto newFrames = reinterpret_cast<Frame*>(
+          resources_->allocator()->reallocate(frames_,
+                                              newCapacity * sizeof(Frame)));
+      if (!newFrames)
+        return fail(DeserializationError::NoMemory);
+      frames_ = newFrames;
+      capacity_ = newCapacity;
+    }
+
+    Frame& frame = frames_[depth_++];
+    frame.collection = nullptr;
+    frame.filter = (isObject || !filtering_) ? filter_ : filter_[0UL];
+    frame.nestingLimit = nestingLimit.decrement();
+    frame.isObject = isObject;
+    if (keep) {
+      if (isObject)
+        frame.collection = &value_->toObject();
+      else
+        frame.collection = &value_->toArray();
+    }
+
+    state_ = isObject ? State::ObjectStart : State::ArrayStart;
+    return true;
+  }
+
+  bool pop() {
+    ARDUINOJSON_ASSERT(depth_ > 0);
+    depth_--;
+    endValue();
+    return true;
+  }
+
+  const Frame& top() const {
+    ARDUINOJSON_ASSERT(depth_ > 0);
+    return frames_[depth_ - 1];
+  }
+
+  bool fail(Code err) {
+    error_ = err;
+    return true;
+  }
+
+  JsonDocument& doc_;
+  detail::ResourceManager* resources_;
+  detail::StringBuilder stringBuilder_;
+  detail::VariantData* value_;  // null when the filter skips the value
+  Filter filter_;               // the filter of the value
+  NestingLimit nestingLimit_;   // the limit for the root
+  bool filtering_;
+  bool foundSomething_ = false;
+  bool rootNumber_ = false;  // the root is a number that the filter kept
+  Code error_ = DeserializationError::Ok;
+  State state_ = State::Value;
+  State commentReturnState_ = State::Value;
+
+  // the stack of open arrays and objects
+  Frame* frames_ = nullptr;
+  size_t depth_ = 0;
+  size_t capacity_ = 0;
+
+  // the current string or key
+  char stopChar_ = 0;
+  bool saving_ = false;  // false when the filter skips the value
+  bool isKey_ = false;
+  uint8_t hexLength_ = 0;
+  uint16_t codeunit_ = 0;
+#if ARDUINOJSON_DECODE_UNICODE
+  detail::Utf16::Codepoint codepoint_;
+#endif
+
+  // the current keyword or number
+  const char* keyword_ = nullptr;
+  uint8_t numberLength_ = 0;
+  char number_[64];
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -32,6 +32,21 @@ class Latch {
     return current_;
   }
 
+  // Gives direct access to the reader, when no character is pending
+  TReader& reader() {
+    ARDUINOJSON_ASSERT(!loaded_);
+    return reader_;
+  }
+
+  // Returns the position of the pending character, or the position of the
+  // reader if there is none. Only for the readers that expose their buffer.
+  const char* position() const {
+    auto p = reader_.position();
+    if (loaded_ && current_)
+      --p;
+    return p;
+  }
+
  private:
   void load() {
     ARDUINOJSON_ASSERT(!ended_);
@@ -0,0 +1,50 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Polyfills/integer.hpp>
+
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+#if ARDUINOJSON_SIZEOF_POINTER >= 8
+using ScannerWord = uint64_t;
+#elif ARDUINOJSON_SIZEOF_POINTER >= 4
+using ScannerWord = uint32_t;
+#endif
+
+// Returns the first character of [p, end) that ends a run of plain characters
+// in a quoted string: stopChar, a backslash, or NUL.
+// If end is nullptr, the input must be null-terminated.
+inline const char* findEndOfPlainChars(const char* p, const char* end,
+                                       char stopChar) {
+#if ARDUINOJSON_SIZEOF_POINTER >= 4
+  // test one word at a time, see "Determine if a word has a zero byte" in
+  // https://graphics.stanford.edu/~seander/bithacks.html
+  if (end) {
+    const ScannerWord ones = ScannerWord(-1) / 0xFF;  // 0x0101...
+    const ScannerWord highBits = ones * 0x80;
+    const ScannerWord quotes = ones * static_cast<unsigned char>(stopChar);
+    const ScannerWord backslashes = ones * '\\';
+    while (size_t(end - p) >= sizeof(ScannerWord)) {
+      ScannerWord w;
+      memcpy(&w, p, sizeof(w));  // unaligned load
+      ScannerWord q = w ^ quotes;
+      ScannerWord b = w ^ backslashes;
+      ScannerWord zeros = ((w - ones) & ~w) | ((q - ones) & ~q) |
+                          ((b - ones) & ~b);
+      if (zeros & highBits)
+        break;
+      p += sizeof(ScannerWord);
+    }
+  }
+#endif
+  while (p != end && *p != stopChar && *p != '\\' && *p != '\0')
+    p++;
+  return p;
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
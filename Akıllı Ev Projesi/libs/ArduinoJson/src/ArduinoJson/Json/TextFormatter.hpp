@@ -10,6 +10,7 @@
 #include <ArduinoJson/Json/EscapeSequence.hpp>
 #include <ArduinoJson/Numbers/FloatParts.hpp>
 #include <ArduinoJson/Numbers/JsonInteger.hpp>
+#include <ArduinoJson/Numbers/shortestDecimal.hpp>
 #include <ArduinoJson/Polyfills/assert.hpp>
 #include <ArduinoJson/Polyfills/attributes.hpp>
 #include <ArduinoJson/Polyfills/type_traits.hpp>
@@ -36,22 +37,54 @@ class TextFormatter {
       writeRaw("false");
   }
 
+  // Writes the characters that need no escaping by runs, with one call to
+  // TWriter::write() per run
   void writeString(const char* value) {
     ARDUINOJSON_ASSERT(value != NULL);
     writeRaw('\"');
-    while (*value)
+    for (;;) {
+      const char* run = value;
+      while (!needsEscaping(*value))
+        value++;
+      if (value != run)
+        writeRaw(run, value);
+      if (!*value)
+        break;
       writeChar(*value++);
+    }
     writeRaw('\"');
   }
 
   void writeString(const char* value, size_t n) {
-    ARDUINOJSON_ASSERT(value != NULL);
     writeRaw('\"');
-    while (n--)
-      writeChar(*value++);
+    writeStringContent(value, n);
     writeRaw('\"');
   }
 
+  // Writes the characters of a string, without the quotes
+  void writeStringContent(const char* value, size_t n) {
+    ARDUINOJSON_ASSERT(value != NULL);
+    const char* end = value + n;
+    while (value != end) {
+      const char* run = value;
+      while (value != end && !needsEscaping(*value))
+        value++;
+      if (value != run)
+        writeRaw(run, value);
+      if (value != end)
+        writeChar(*value++);
+    }
+  }
+
+  // Returns true if writeChar() writes something else than c
+  static bool needsEscaping(char c) {
+    if (c == '\"' || c == '\\')
+      return true;
+    if (static_cast<unsigned char>(c) >= 0x20)
+      return false;
+    return c == 0 || EscapeSequence::escapeChar(c) != 0;
+  }
+
   void writeChar(char c) {
     char specialChar = EscapeSequence::escapeChar(c);
     if (specialChar) {
@@ -66,30 +99,18 @@ class TextFormatter {
 
   template <typename T>
   void writeFloat(T value) {
+#if ARDUINOJSON_ENABLE_SHORTEST_FLOAT_FORMATTING
+    if (writeSpecialFloat(value))
+      return;
+    writeShortestFloat(value);
+#else
     writeFloat(JsonFloat(value), sizeof(T) >= 8 ? 9 : 6);
+#endif
   }
 
   void writeFloat(JsonFloat value, int8_t decimalPlaces) {
-    if (isnan(value))
-      return writeRaw(ARDUINOJSON_ENABLE_NAN ? "NaN" : "null");
-
-#if ARDUINOJSON_ENABLE_INFINITY
-    if (value < 0.0) {
-      writeRaw('-');
-      value = -value;
-    }
-
-    if (isinf(value))
-      return writeRaw("Infinity");
-#else
-    if (isinf(value))
-      return writeRaw("null");
-
-    if (value < 0.0) {
-      writeRaw('-');
-      value = -value;
-    }
-#endif
+    if (writeSpecialFloat(value))
+      return;
 
     auto parts = decomposeFloat(value, decimalPlaces);
 
@@ -149,6 +170,96 @@ class TextFormatter {
     writeRaw(begin, end);
   }
 
+  // Writes NaN, Infinity and the minus sign.
+  // Returns true if the value was fully written.
+  template <typename T>
+  bool writeSpecialFloat(T& value) {
+    if (isnan(value)) {
+      writeRaw(ARDUINOJSON_ENABLE_NAN ? "NaN" : "null");
+      return true;
+    }
+
+#if ARDUINOJSON_ENABLE_INFINITY
+    if (value < 0) {
+      writeRaw('-');
+      value = -value;
+    }
+
+    if (isinf(value)) {
+      writeRaw("Infinity");
+      return true;
+    }
+#else
+    if (isinf(value)) {
+      writeRaw("null");
+      return true;
+    }
+
+    if (value < 0) {
+      writeRaw('-');
+      value = -value;
+    }
+#endif
+
+    return false;
+  }
+
+#if ARDUINOJSON_ENABLE_SHORTEST_FLOAT_FORMATTING
+  // Writes the shortest decimal that parses back to value.
+  // Uses the same exponentiation thresholds as writeFloat(JsonFloat, int8_t).
+  template <typename T>
+  void writeShortestFloat(T value) {
+    if (value == 0)
+      return writeRaw('0');
+
+    auto decimal = shortestDecimal(value);
+
+    char buffer[20];
+    char* end = buffer + sizeof(buffer);
+    char* begin = end;
+    // write the digits in reverse order, by chunks of eight to use 32-bit math
+    auto n = decimal.significand;
+    while (n >= 100000000) {
+      auto chunk = uint32_t(n % 100000000);
+      n /= 100000000;
+      for (int i = 0; i < 8; i++) {
+        *--begin = char(chunk % 10 + '0');
+        chunk /= 10;
+      }
+    }
+    for (auto chunk = uint32_t(n); chunk; chunk /= 10)
+      *--begin = char(chunk % 10 + '0');
+
+    // the power of ten of the first digit
+    int exponent = decimal.exponent + int(end - begin) - 1;
+
+    if (value >= ARDUINOJSON_POSITIVE_EXPONENTIATION_THRESHOLD ||
+        value <= ARDUINOJSON_NEGATIVE_EXPONENTIATION_THRESHOLD) {
+      writeRaw(*begin++);
+      if (begin != end) {
+        writeRaw('.');
+        writeRaw(begin, end);
+      }
+      writeRaw('e');
+      writeInteger(exponent);
+    } else if (exponent < 0) {
+      writeRaw("0.");
+      for (int i = exponent + 1; i < 0; i++)
+        writeRaw('0');
+      writeRaw(begin, end);
+    } else if (decimal.exponent >= 0) {
+      writeRaw(begin, end);
+      for (int i = 0; i < decimal.exponent; i++)
+        writeRaw('0');
+    } else {
+      char* dot = begin + exponent + 1;
+      writeRaw(begin, dot);
+      writeRaw('.');
+      writeRaw(dot, end);
+    }
+  }
+#endif
+
   void writeRaw(const char* s) {
     writer_.write(reinterpret_cast<const uint8_t*>(s), strlen(s));
   }
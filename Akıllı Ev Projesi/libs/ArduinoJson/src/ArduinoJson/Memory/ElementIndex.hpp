@@ -0,0 +1,244 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/Allocator.hpp>
+#include <ArduinoJson/Memory/MemoryPool.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// The slots of the elements of an array, in order, and the number of
+// elements.
+// Removing the first or the last element only moves the bounds of the table.
+// Removing another element by position leaves a hole in the table, and a
+// Fenwick tree of the remaining elements finds the position of an element in
+// O(log N) until the holes are compacted, once they outnumber half of the
+// elements. So a removal costs O(log N), amortized.
+// Removing an element by slot only marks the table stale, because its
+// position is unknown; the array rebuilds the table from the linked list the
+// next time it's accessed by index.
+class ElementIndex {
+ public:
+  static const size_t initialCapacity = 16;
+
+  // Placement new
+  static void* operator new(size_t, void* p) noexcept {
+    return p;
+  }
+
+  static void operator delete(void*, void*) noexcept {}
+
+  ~ElementIndex() {
+    ARDUINOJSON_ASSERT(ids_ == nullptr);
+    ARDUINOJSON_ASSERT(ranks_ == nullptr);
+  }
+
+  // Returns the number of elements, even if the table is stale
+  size_t size() const {
+    return count_;
+  }
+
+  bool stale() const {
+    return stale_;
+  }
+
+  SlotId operator[](size_t i) const {
+    ARDUINOJSON_ASSERT(!stale_);
+    ARDUINOJSON_ASSERT(i < count_);
+    return ids_[positionOf(i)];
+  }
+
+  // Returns false if allocation fails
+  bool append(SlotId id, Allocator* allocator) {
+    ARDUINOJSON_ASSERT(id != NULL_SLOT);
+    if (stale_) {
+      // the next rebuild() writes the whole table
+      if (count_ == capacity_ && !grow(allocator))
+        return false;
+      count_++;
+      return true;
+    }
+    if (end_ == capacity_) {
+      // the compaction is paid by the removals that left the free space
+      if (end_ - count_ > 0 && end_ - count_ >= capacity_ / 2)
+        compact(allocator);
+      else if (!grow(allocator))
+        return false;
+    }
+    ids_[end_] = id;
+    if (ranks_)
+      updateRanks(end_, true);
+    end_++;
+    count_++;
+    return true;
+  }
+
+  // Removes the element at position i.
+  // Returns false if allocation fails; the table is unchanged then.
+  bool remove(size_t i, Allocator* allocator) {
+    ARDUINOJSON_ASSERT(!stale_);
+    ARDUINOJSON_ASSERT(i < count_);
+    if (!ranks_ && i == 0) {
+      begin_++;
+    } else if (!ranks_ && i == count_ - 1) {
+      end_--;
+    } else {
+      if (!ranks_ && !createRanks(allocator))
+        return false;
+      size_t position = positionOf(i);
+      ids_[position] = NULL_SLOT;
+      updateRanks(position, false);
+    }
+    count_--;
+    if (ranks_ && end_ - begin_ - count_ > count_ / 2)
+      compact(allocator);
+    return true;
+  }
+
+  // Removes an element without updating the table
+  void removeAny(Allocator* allocator) {
+    ARDUINOJSON_ASSERT(count_ > 0);
+    count_--;
+    stale_ = true;
+    destroyRanks(allocator);
+  }
+
+  // Empties the table, so that the caller can push() the size() elements.
+  // It doesn't allocate: the table is already large enough.
+  void rebuild() {
+    ARDUINOJSON_ASSERT(count_ <= capacity_);
+    ARDUINOJSON_ASSERT(ranks_ == nullptr);
+    begin_ = 0;
+    end_ = 0;
+    stale_ = false;
+  }
+
+  void push(SlotId id) {
+    ARDUINOJSON_ASSERT(end_ < count_);
+    ids_[end_++] = id;
+  }
+
+  void clear(Allocator* allocator) {
+    destroyRanks(allocator);
+    if (ids_)
+      allocator->deallocate(ids_);
+    ids_ = nullptr;
+    begin_ = 0;
+    end_ = 0;
+    count_ = 0;
+    capacity_ = 0;
+    stale_ = false;
+  }
+
+ private:
+  bool grow(Allocator* allocator) {
+    size_t newCapacity = capacity_ ? capacity_ * 2 : initialCapacity;
+    auto newIds = reinterpret_cast<SlotId*>(
+        allocator->reallocate(ids_, newCapacity * sizeof(SlotId)));
+    if (!newIds)
+      return false;
+    ids_ = newIds;
+    capacity_ = newCapacity;
+    if (ranks_) {
+      destroyRanks(allocator);
+      if (!createRanks(allocator)) {
+        compact(allocator);  // no holes, so no need for the ranks
+        ARDUINOJSON_ASSERT(end_ < capacity_);
+      }
+    }
+    return true;
+  }
+
+  // Moves the elements to the beginning of the table, without the holes
+  void compact(Allocator* allocator) {
+    size_t n = 0;
+    for (size_t i = begin_; i < end_; i++) {
+      if (ids_[i] != NULL_SLOT)
+        ids_[n++] = ids_[i];
+    }
+    ARDUINOJSON_ASSERT(n == count_);
+    begin_ = 0;
+    end_ = n;
+    destroyRanks(allocator);
+
+    // keep the table proportional to the elements, so that building the
+    // ranks stays proportional too
+    size_t newCapacity = capacity_;
+    while (newCapacity > initialCapacity && newCapacity / 4 >= count_)
+      newCapacity /= 2;
+    if (newCapacity == capacity_)
+      return;
+    auto newIds = reinterpret_cast<SlotId*>(
+        allocator->reallocate(ids_, newCapacity * sizeof(SlotId)));
+    if (!newIds)
+      return;
+    ids_ = newIds;
+    capacity_ = newCapacity;
+  }
+
+  // Returns the position in the table of the element i
+  size_t positionOf(size_t i) const {
+    if (!ranks_)
+      return begin_ + i;
+    // find the last position whose prefix count is <= i
+    size_t position = 0;
+    for (size_t step = highestBit(capacity_); step; step >>= 1) {
+      if (position + step <= capacity_ && ranks_[position + step - 1] <= i) {
+        position += step;
+        i -= ranks_[position - 1];
+      }
+    }
+    return position;
+  }
+
+  // ranks_ is a Fenwick tree: ranks_[k - 1] counts the elements in the
+  // positions k - lowbit(k) to k - 1
+  bool createRanks(Allocator* allocator) {
+    ARDUINOJSON_ASSERT(ranks_ == nullptr);
+    ranks_ = reinterpret_cast<SlotCount*>(
+        allocator->allocate(capacity_ * sizeof(SlotCount)));
+    if (!ranks_)
+      return false;
+    for (size_t k = 0; k < capacity_; k++)
+      ranks_[k] = SlotCount(k >= begin_ && k < end_ && ids_[k] != NULL_SLOT);
+    for (size_t k = 1; k <= capacity_; k++) {
+      size_t parent = k + (k & (~k + 1));
+      if (parent <= capacity_)
+        ranks_[parent - 1] = SlotCount(ranks_[parent - 1] + ranks_[k - 1]);
+    }
+    return true;
+  }
+
+  void destroyRanks(Allocator* allocator) {
+    if (ranks_)
+      allocator->deallocate(ranks_);
+    ranks_ = nullptr;
+  }
+
+  void updateRanks(size_t position, bool added) {
+    for (size_t k = position + 1; k <= capacity_; k += k & (~k + 1)) {
+      if (added)
+        ranks_[k - 1]++;
+      else
+        ranks_[k - 1]--;
+    }
+  }
+
+  static size_t highestBit(size_t n) {
+    size_t bit = 1;
+    while (bit <= n / 2)
+      bit <<= 1;
+    return bit;
+  }
+
+  SlotId* ids_ = nullptr;  // NULL_SLOT marks a hole
+  SlotCount* ranks_ = nullptr;  // only when there are holes
+  size_t begin_ = 0, end_ = 0;  // the used part of the table
+  size_t count_ = 0;
+  size_t capacity_ = 0;
+  bool stale_ = false;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -0,0 +1,163 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/Allocator.hpp>
+#include <ArduinoJson/Polyfills/assert.hpp>
+#include <ArduinoJson/Polyfills/integer.hpp>
+#include <ArduinoJson/Polyfills/utility.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// A hash table with open addressing and linear probing.
+// TEntry must be trivially copyable and provide:
+//   uint32_t hash() const;
+//   bool isEmpty() const;
+//   static TEntry empty();
+template <typename TEntry>
+class HashTable {
+ public:
+  static const size_t initialCapacity = 16;  // must be a power of two
+
+  HashTable() = default;
+  HashTable(const HashTable&) = delete;
+  HashTable& operator=(const HashTable&) = delete;
+
+  ~HashTable() {
+    ARDUINOJSON_ASSERT(entries_ == nullptr);
+  }
+
+  friend void swap(HashTable& a, HashTable& b) {
+    swap_(a.entries_, b.entries_);
+    swap_(a.capacity_, b.capacity_);
+    swap_(a.count_, b.count_);
+  }
+
+  size_t count() const {
+    return count_;
+  }
+
+  size_t capacity() const {
+    return capacity_;
+  }
+
+  const TEntry& operator[](size_t i) const {
+    ARDUINOJSON_ASSERT(i < capacity_);
+    return entries_[i];
+  }
+
+  // Returns the first entry with the specified hash for which matches(entry)
+  // returns true, or nullptr
+  template <typename TMatcher>
+  TEntry* find(uint32_t hash, const TMatcher& matches) const {
+    if (!entries_)
+      return nullptr;
+    for (size_t i = bucketOf(hash); !entries_[i].isEmpty(); i = nextBucket(i)) {
+      if (entries_[i].hash() == hash && matches(entries_[i]))
+        return &entries_[i];
+    }
+    return nullptr;
+  }
+
+  // Returns false if the table is full and cannot grow
+  bool insert(const TEntry& entry, Allocator* allocator) {
+    ARDUINOJSON_ASSERT(!entry.isEmpty());
+    if ((count_ + 1) * 4 > capacity_ * 3)
+      grow(allocator);  // keep going with the current table if it fails
+    if (count_ + 1 >= capacity_)  // always keep an empty bucket
+      return false;
+    place(entry);
+    count_++;
+    return true;
+  }
+
+  // Returns false if no entry matched
+  template <typename TMatcher>
+  bool remove(uint32_t hash, const TMatcher& matches) {
+    auto entry = find(hash, matches);
+    if (!entry)
+      return false;
+    count_--;
+
+    // backward shift deletion: move up the entries that were displaced by the
+    // removed one, so that lookups never stop at a hole
+    auto i = size_t(entry - entries_);
+    for (;;) {
+      entries_[i] = TEntry::empty();
+      size_t j = i;
+      for (;;) {
+        j = nextBucket(j);
+        if (entries_[j].isEmpty())
+          return true;
+        size_t k = bucketOf(entries_[j].hash());
+        bool inPlace = i <= j ? (i < k && k <= j) : (i < k || k <= j);
+        if (!inPlace)
+          break;
+      }
+      entries_[i] = entries_[j];
+      i = j;
+    }
+  }
+
+  // Removes all the entries, but keeps the table
+  void reset() {
+    for (size_t i = 0; i < capacity_; i++)
+      entries_[i] = TEntry::empty();
+    count_ = 0;
+  }
+
+  // Releases the table (the caller must release what the entries point to)
+  void clear(Allocator* allocator) {
+    if (entries_)
+      allocator->deallocate(entries_);
+    entries_ = nullptr;
+    capacity_ = 0;
+    count_ = 0;
+  }
+
+ private:
+  size_t bucketOf(uint32_t hash) const {
+    return size_t(hash) & (capacity_ - 1);
+  }
+
+  size_t nextBucket(size_t i) const {
+    return (i + 1) & (capacity_ - 1);
+  }
+
+  void place(const TEntry& entry) {
+    size_t i = bucketOf(entry.hash());
+    while (!entries_[i].isEmpty())
+      i = nextBucket(i);
+    entries_[i] = entry;
+  }
+
+  bool grow(Allocator* allocator) {
+    size_t newCapacity = capacity_ ? capacity_ * 2 : initialCapacity;
+    auto newEntries = reinterpret_cast<TEntry*>(
+        allocator->allocate(newCapacity * sizeof(TEntry)));
+    if (!newEntries)
+      return false;
+    for (size_t i = 0; i < newCapacity; i++)
+      newEntries[i] = TEntry::empty();
+
+    auto oldEntries = entries_;
+    auto oldCapacity = capacity_;
+    entries_ = newEntries;
+    capacity_ = newCapacity;
+    for (size_t i = 0; i < oldCapacity; i++) {
+      if (!oldEntries[i].isEmpty())
+        place(oldEntries[i]);
+    }
+    if (oldEntries)
+      allocator->deallocate(oldEntries);
+    return true;
+  }
+
+  TEntry* entries_ = nullptr;
+  size_t capacity_ = 0;
+  size_t count_ = 0;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
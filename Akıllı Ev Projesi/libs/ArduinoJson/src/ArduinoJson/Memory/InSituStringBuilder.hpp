@@ -0,0 +1,97 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Deserialization/Reader.hpp>
+#include <ArduinoJson/Memory/ResourceManager.hpp>
+#include <ArduinoJson/Memory/StringBuilder.hpp>
+
+#include <string.h>  // memmove
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Builds the strings in the input buffer, as linked strings.
+// An unescaped string is never longer than its representation in the input,
+// so it can overwrite the input behind the parser.
+class InSituStringBuilder {
+ public:
+  InSituStringBuilder(ResourceManager* resources) : resources_(resources) {}
+
+  void setReader(const InSituReader* reader) {
+    reader_ = reader;
+  }
+
+  // The string starts at the last character read: the opening quote, or the
+  // first character of a non-quoted string
+  void startString() {
+    ARDUINOJSON_ASSERT(reader_ != nullptr);
+    data_ = reader_->lastRead();
+    size_ = 0;
+  }
+
+  void save(VariantData* variant) {
+    ARDUINOJSON_ASSERT(variant != nullptr);
+
+    if (isTinyString(data_, size_)) {
+      variant->setTinyString(adaptString(data_, size_));
+      return;
+    }
+
+    if (memchr(data_, 0, size_)) {
+      // a linked string can't contain NUL, so we have to copy
+      variant->setString(adaptString(data_, size_), resources_);
+      return;
+    }
+
+    data_[size_] = 0;
+    variant->setLinkedString(data_);
+  }
+
+  void append(const char* s) {
+    while (*s)
+      append(*s++);
+  }
+
+  void append(const char* s, size_t n) {
+    memmove(data_ + size_, s, n);
+    size_ += n;
+  }
+
+  void append(char c) {
+    data_[size_++] = c;
+  }
+
+  bool isValid() const {
+    return true;
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  JsonString str() const {
+    data_[size_] = 0;
+    return JsonString(data_, size_);
+  }
+
+ private:
+  ResourceManager* resources_;
+  const InSituReader* reader_ = nullptr;
+  char* data_ = nullptr;
+  size_t size_ = 0;
+};
+
+// Selects the string builder that suits the reader
+template <typename TReader>
+struct StringBuilderFor {
+  using type = StringBuilder;
+};
+
+template <>
+struct StringBuilderFor<InSituReader> {
+  using type = InSituStringBuilder;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
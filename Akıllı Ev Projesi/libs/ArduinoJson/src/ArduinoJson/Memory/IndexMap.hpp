@@ -0,0 +1,114 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/HashTable.hpp>
+#include <ArduinoJson/Memory/MemoryPool.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Maps the first slot of each indexed collection to its index.
+// TIndex must be default-constructible with placement new and provide
+// void clear(Allocator*).
+template <typename TIndex>
+class IndexMap {
+  struct Entry {
+    SlotId head;
+    TIndex* index;
+
+    uint32_t hash() const {
+      return hashOf(head);
+    }
+
+    bool isEmpty() const {
+      return index == nullptr;
+    }
+
+    static Entry empty() {
+      return {NULL_SLOT, nullptr};
+    }
+  };
+
+  struct HeadMatcher {
+    SlotId head;
+
+    bool operator()(const Entry& entry) const {
+      return entry.head == head;
+    }
+  };
+
+ public:
+  ~IndexMap() {
+    ARDUINOJSON_ASSERT(table_.count() == 0);
+  }
+
+  friend void swap(IndexMap& a, IndexMap& b) {
+    swap(a.table_, b.table_);
+  }
+
+  TIndex* get(SlotId head) const {
+    if (head == NULL_SLOT || table_.count() == 0)
+      return nullptr;
+    auto entry = table_.find(hashOf(head), HeadMatcher{head});
+    return entry ? entry->index : nullptr;
+  }
+
+  // Returns nullptr if allocation fails
+  TIndex* create(SlotId head, Allocator* allocator) {
+    ARDUINOJSON_ASSERT(head != NULL_SLOT);
+    ARDUINOJSON_ASSERT(get(head) == nullptr);
+    auto index =
+        reinterpret_cast<TIndex*>(allocator->allocate(sizeof(TIndex)));
+    if (!index)
+      return nullptr;
+    new (index) TIndex();
+    if (!table_.insert({head, index}, allocator)) {
+      destroy(index, allocator);
+      return nullptr;
+    }
+    return index;
+  }
+
+  void remove(SlotId head, Allocator* allocator) {
+    auto index = get(head);
+    if (!index)
+      return;
+    table_.remove(hashOf(head), HeadMatcher{head});
+    destroy(index, allocator);
+  }
+
+  // Call this when the first slot of a collection is removed
+  void rename(SlotId oldHead, SlotId newHead, Allocator* allocator) {
+    auto index = get(oldHead);
+    if (!index)
+      return;
+    table_.remove(hashOf(oldHead), HeadMatcher{oldHead});
+    if (newHead == NULL_SLOT || !table_.insert({newHead, index}, allocator))
+      destroy(index, allocator);
+  }
+
+  void clear(Allocator* allocator) {
+    for (size_t i = 0; i < table_.capacity(); i++) {
+      if (!table_[i].isEmpty())
+        destroy(table_[i].index, allocator);
+    }
+    table_.clear(allocator);
+  }
+
+ private:
+  static uint32_t hashOf(SlotId id) {
+    return uint32_t(id) * 2654435761u;  // Knuth's multiplicative hash
+  }
+
+  static void destroy(TIndex* index, Allocator* allocator) {
+    index->clear(allocator);
+    index->~TIndex();
+    allocator->deallocate(index);
+  }
+
+  HashTable<Entry> table_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -0,0 +1,97 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/HashTable.hpp>
+#include <ArduinoJson/Memory/MemoryPool.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Maps the hash of each key of an object to the slot of the key.
+// Keys are indexed in order, up to lastKey(); the keys appended after that
+// are indexed the next time the object is searched.
+class KeyIndex {
+  struct Entry {
+    SlotId key;
+    uint32_t hash_;
+
+    uint32_t hash() const {
+      return hash_;
+    }
+
+    bool isEmpty() const {
+      return key == NULL_SLOT;
+    }
+
+    static Entry empty() {
+      return {NULL_SLOT, 0};
+    }
+  };
+
+  struct SlotMatcher {
+    SlotId key;
+
+    bool operator()(const Entry& entry) const {
+      return entry.key == key;
+    }
+  };
+
+ public:
+  // Placement new
+  static void* operator new(size_t, void* p) noexcept {
+    return p;
+  }
+
+  static void operator delete(void*, void*) noexcept {}
+
+  // TMatcher must provide bool operator()(SlotId key) const
+  template <typename TMatcher>
+  struct KeyMatcher {
+    const TMatcher& matches;
+
+    bool operator()(const Entry& entry) const {
+      return matches(entry.key);
+    }
+  };
+
+  template <typename TMatcher>
+  SlotId find(uint32_t hash, const TMatcher& matches) const {
+    auto entry = table_.find(hash, KeyMatcher<TMatcher>{matches});
+    return entry ? entry->key : NULL_SLOT;
+  }
+
+  // Returns false if the table is full and cannot grow
+  bool insert(uint32_t hash, SlotId key, Allocator* allocator) {
+    ARDUINOJSON_ASSERT(key != NULL_SLOT);
+    if (!table_.insert({key, hash}, allocator))
+      return false;
+    lastKey_ = key;
+    return true;
+  }
+
+  void remove(uint32_t hash, SlotId key) {
+    table_.remove(hash, SlotMatcher{key});
+  }
+
+  SlotId lastKey() const {
+    return lastKey_;
+  }
+
+  // Call this when lastKey() is removed, with the key before it
+  void setLastKey(SlotId key) {
+    lastKey_ = key;
+  }
+
+  void clear(Allocator* allocator) {
+    table_.clear(allocator);
+    lastKey_ = NULL_SLOT;
+  }
+
+ private:
+  HashTable<Entry> table_;
+  SlotId lastKey_ = NULL_SLOT;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -54,6 +54,13 @@ class MemoryPool {
     usage_ = 0;
   }
 
+  // Uses slots that the pool doesn't own, such as the ones of a snapshot
+  void attach(T* slots, SlotCount count) {
+    slots_ = slots;
+    capacity_ = count;
+    usage_ = count;
+  }
+
   void destroy(Allocator* allocator) {
     if (slots_)
       allocator->deallocate(slots_);
@@ -80,6 +87,10 @@ class MemoryPool {
     usage_ = 0;
   }
 
+  const T* slots() const {
+    return slots_;
+  }
+
   void shrinkToFit(Allocator* allocator) {
     auto newSlots = reinterpret_cast<T*>(
         allocator->reallocate(slots_, slotsToBytes(usage_)));
@@ -93,6 +104,10 @@ class MemoryPool {
     return usage_;
   }
 
+  SlotCount capacity() const {
+    return capacity_;
+  }
+
   static SlotCount bytesToSlots(size_t n) {
     return static_cast<SlotCount>(n / sizeof(T));
   }
@@ -8,12 +8,22 @@
 #include <ArduinoJson/Polyfills/assert.hpp>
 #include <ArduinoJson/Polyfills/utility.hpp>
 
-#include <string.h>  // memcpy
+#include <string.h>  // memcpy, memset
 
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
 using PoolCount = SlotId;
 
+constexpr PoolCount bitLength(size_t n) {
+  return n ? PoolCount(1 + bitLength(n >> 1)) : PoolCount(0);
+}
+
+// A list of pools whose capacities grow geometrically, then linearly.
+// The first two pools have ARDUINOJSON_POOL_CAPACITY slots, and each of the
+// next ones is twice as big as the previous one, so pool k starts at slot
+// ARDUINOJSON_POOL_CAPACITY << (k - 1). Once a pool has
+// ARDUINOJSON_MAX_POOL_CAPACITY slots, the next ones have the same capacity.
+// Either way, the id of a slot gives its pool.
 template <typename T>
 class MemoryPoolList {
   struct FreeSlot {
@@ -22,13 +32,27 @@ class MemoryPoolList {
 
   static_assert(sizeof(FreeSlot) <= sizeof(T), "T is too small");
 
+  static constexpr size_t minCapacity = ARDUINOJSON_POOL_CAPACITY;
+  static constexpr size_t maxCapacity = ARDUINOJSON_MAX_POOL_CAPACITY;
+
+  static_assert(maxCapacity >= minCapacity &&
+                    maxCapacity % minCapacity == 0 &&
+                    ((maxCapacity / minCapacity) &
+                     (maxCapacity / minCapacity - 1)) == 0,
+                "ARDUINOJSON_MAX_POOL_CAPACITY must be "
+                "ARDUINOJSON_POOL_CAPACITY times a power of two");
+
+  // The index of the first pool of maxCapacity slots
+  static constexpr PoolCount geometricPools =
+      bitLength(maxCapacity / minCapacity);
+
  public:
   using Pool = MemoryPool<T>;
 
   MemoryPoolList() = default;
 
   ~MemoryPoolList() {
-    ARDUINOJSON_ASSERT(count_ == 0);
+    ARDUINOJSON_ASSERT(created_ == 0);
   }
 
   friend void swap(MemoryPoolList& a, MemoryPoolList& b) {
@@ -58,12 +82,13 @@ class MemoryPoolList {
     }
 
     swap_(a.count_, b.count_);
+    swap_(a.created_, b.created_);
     swap_(a.capacity_, b.capacity_);
     swap_(a.freeList_, b.freeList_);
   }
 
   MemoryPoolList& operator=(MemoryPoolList&& src) {
-    ARDUINOJSON_ASSERT(count_ == 0);
+    ARDUINOJSON_ASSERT(created_ == 0);
     if (src.pools_ == src.preallocatedPools_) {
       memcpy(preallocatedPools_, src.preallocatedPools_,
              sizeof(preallocatedPools_));
@@ -73,8 +98,10 @@ class MemoryPoolList {
       src.pools_ = nullptr;
     }
     count_ = src.count_;
+    created_ = src.created_;
     capacity_ = src.capacity_;
     src.count_ = 0;
+    src.created_ = 0;
     src.capacity_ = 0;
     return *this;
   }
@@ -108,16 +135,16 @@ class MemoryPoolList {
   T* getSlot(SlotId id) const {
     if (id == NULL_SLOT)
       return nullptr;
-    auto poolIndex = SlotId(id / ARDUINOJSON_POOL_CAPACITY);
-    auto indexInPool = SlotId(id % ARDUINOJSON_POOL_CAPACITY);
+    auto poolIndex = poolOf(id);
     ARDUINOJSON_ASSERT(poolIndex < count_);
-    return pools_[poolIndex].getSlot(indexInPool);
+    return pools_[poolIndex].getSlot(SlotId(id - poolStart(poolIndex)));
   }
 
   void clear(Allocator* allocator) {
-    for (PoolCount i = 0; i < count_; i++)
+    for (PoolCount i = 0; i < created_; i++)
       pools_[i].destroy(allocator);
     count_ = 0;
+    created_ = 0;
     freeList_ = NULL_SLOT;
     if (pools_ != preallocatedPools_) {
       allocator->deallocate(pools_);
@@ -126,6 +153,86 @@ class MemoryPoolList {
     }
   }
 
+  // Releases all the slots, but keeps the pools for the next allocations
+  void reset() {
+    for (PoolCount i = 0; i < count_; i++)
+      pools_[i].clear();
+    count_ = 0;
+    freeList_ = NULL_SLOT;
+  }
+
+  // Creates the pools to hold at least n slots in total.
+  // Returns false if the allocation fails or if n is above the limit.
+  bool reserve(size_t n, Allocator* allocator) {
+    while (poolStart(created_) < n) {
+      if (!createPool(allocator))
+        return false;
+    }
+    return true;
+  }
+
+  // Reads the slots from an array that the list doesn't own, such as the one
+  // of a snapshot. Only the pool list is allocated.
+  // Returns false if the allocation fails.
+  // Call detach() before destroying the list.
+  bool attach(T* slots, size_t count, Allocator* allocator) {
+    ARDUINOJSON_ASSERT(created_ == 0);
+    ARDUINOJSON_ASSERT(count <= NULL_SLOT);
+    auto n = count ? PoolCount(poolOf(SlotId(count - 1)) + 1) : PoolCount(0);
+    if (n > capacity_) {
+      auto pools = allocator->allocate(n * sizeof(Pool));
+      if (!pools)
+        return false;
+      pools_ = static_cast<Pool*>(pools);
+      capacity_ = n;
+    }
+    for (count_ = 0; count_ < n; count_++) {
+      size_t start = poolStart(count_);
+      size_t end = poolStart(PoolCount(count_ + 1));
+      if (end > count)
+        end = count;
+      pools_[count_].attach(slots + start, SlotCount(end - start));
+    }
+    return true;
+  }
+
+  void detach(Allocator* allocator) {
+    ARDUINOJSON_ASSERT(created_ == 0);
+    count_ = 0;
+    freeList_ = NULL_SLOT;
+    if (pools_ != preallocatedPools_) {
+      allocator->deallocate(pools_);
+      pools_ = preallocatedPools_;
+      capacity_ = ARDUINOJSON_INITIAL_POOL_COUNT;
+    }
+  }
+
+  // Returns the number of ids in use: the ids of the slots go from 0 to
+  // idCount() - 1. It's larger than usage() if a pool was shrunk before the
+  // next one was added.
+  size_t idCount() const {
+    if (!count_)
+      return 0;
+    return poolStart(PoolCount(count_ - 1)) + pools_[count_ - 1].usage();
+  }
+
+  // Copies the slots in the order of their ids, in an array of idCount()
+  // slots. The ids that don't have a slot are filled with zeros.
+  void copyTo(void* dst) const {
+    char* p = reinterpret_cast<char*>(dst);
+    for (PoolCount i = 0; i < count_; i++) {
+      size_t n = Pool::slotsToBytes(pools_[i].usage());
+      memcpy(p, pools_[i].slots(), n);
+      if (i + 1 < count_) {
+        auto capacity = SlotCount(poolStart(PoolCount(i + 1)) - poolStart(i));
+        size_t poolSize = Pool::slotsToBytes(capacity);
+        memset(p + n, 0, poolSize - n);
+        n = poolSize;
+      }
+      p += n;
+    }
+  }
+
   SlotCount usage() const {
     SlotCount total = 0;
     for (PoolCount i = 0; i < count_; i++)
@@ -138,9 +245,16 @@ class MemoryPoolList {
   }
 
   void shrinkToFit(Allocator* allocator) {
+    for (PoolCount i = count_; i < created_; i++)
+      pools_[i].destroy(allocator);
+    created_ = count_;
     if (count_ > 0)
       pools_[count_ - 1].shrinkToFit(allocator);
-    if (pools_ != preallocatedPools_ && count_ != capacity_) {
+    if (pools_ != preallocatedPools_ && count_ == 0) {
+      allocator->deallocate(pools_);
+      pools_ = preallocatedPools_;
+      capacity_ = ARDUINOJSON_INITIAL_POOL_COUNT;
+    } else if (pools_ != preallocatedPools_ && count_ != capacity_) {
       pools_ = static_cast<Pool*>(
           allocator->reallocate(pools_, count_ * sizeof(Pool)));
       ARDUINOJSON_ASSERT(pools_ != nullptr);  // realloc to smaller can't fail
@@ -163,26 +277,40 @@ class MemoryPoolList {
     auto slot = pools_[poolIndex].allocSlot();
     if (!slot)
       return {};
-    return {slot.ptr(),
-            SlotId(poolIndex * ARDUINOJSON_POOL_CAPACITY + slot.id())};
+    return {slot.ptr(), SlotId(poolStart(poolIndex) + slot.id())};
   }
 
+  // Returns the next pool, reusing the ones kept by reset()
   Pool* addPool(Allocator* allocator) {
-    if (count_ == capacity_ && !increaseCapacity(allocator))
+    if (count_ == created_ && !createPool(allocator))
       return nullptr;
-    auto pool = &pools_[count_++];
-    SlotCount poolCapacity = ARDUINOJSON_POOL_CAPACITY;
-    if (count_ == maxPools)  // last pool is smaller because of NULL_SLOT
-      poolCapacity--;
-    pool->create(poolCapacity, allocator);
-    return pool;
+    return &pools_[count_++];
+  }
+
+  bool createPool(Allocator* allocator) {
+    if (created_ == maxPools)
+      return false;
+    if (created_ == capacity_ && !increaseCapacity(allocator))
+      return false;
+    auto pool = &pools_[created_];
+    size_t start = poolStart(created_);
+    size_t end = poolStart(PoolCount(created_ + 1));
+    if (end > NULL_SLOT)  // last pool is smaller because of NULL_SLOT
+      end = NULL_SLOT;
+    pool->create(SlotCount(end - start), allocator);
+    if (!pool->capacity())
+      return false;
+    created_++;
+    return true;
   }
 
   bool increaseCapacity(Allocator* allocator) {
-    if (capacity_ == maxPools)
+    if (capacity_ >= maxPools)
       return false;
     void* newPools;
     auto newCapacity = PoolCount(capacity_ * 2);
+    if (newCapacity > maxPools)
+      newCapacity = maxPools;
 
     if (pools_ == preallocatedPools_) {
       newPools = allocator->allocate(newCapacity * sizeof(Pool));
@@ -200,15 +328,42 @@ class MemoryPoolList {
     return true;
   }
 
+  // Returns the id of the first slot of the pool (for index <= maxPools)
+  static size_t poolStart(PoolCount index) {
+    if (index > geometricPools)
+      return (index - geometricPools + 1) * maxCapacity;
+    return index ? minCapacity << (index - 1) : 0;
+  }
+
+  static PoolCount poolOf(SlotId id) {
+    if (id >= maxCapacity)
+      return PoolCount(geometricPools - 1 + id / maxCapacity);
+    // the number of bits of id / minCapacity
+    auto n = static_cast<unsigned>(id / minCapacity);
+    if (!n)
+      return 0;
+#if defined(__GNUC__)
+    return PoolCount(sizeof(unsigned) * 8 - unsigned(__builtin_clz(n)));
+#else
+    PoolCount bits = 0;
+    for (; n; n >>= 1)
+      bits++;
+    return bits;
+#endif
+  }
+
   Pool preallocatedPools_[ARDUINOJSON_INITIAL_POOL_COUNT];
   Pool* pools_ = preallocatedPools_;
-  PoolCount count_ = 0;
+  PoolCount count_ = 0;    // the pools in use
+  PoolCount created_ = 0;  // the pools in use, plus the ones kept by reset()
   PoolCount capacity_ = ARDUINOJSON_INITIAL_POOL_COUNT;
   SlotId freeList_ = NULL_SLOT;
 
  public:
-  static const PoolCount maxPools =
-      PoolCount(NULL_SLOT / ARDUINOJSON_POOL_CAPACITY + 1);
+  static constexpr PoolCount maxPools = PoolCount(
+      NULL_SLOT - 1 >= maxCapacity
+          ? geometricPools + (NULL_SLOT - 1) / maxCapacity
+          : bitLength((NULL_SLOT - 1) / minCapacity) + 1);
 };
 
 ARDUINOJSON_END_PRIVATE_NAMESPACE
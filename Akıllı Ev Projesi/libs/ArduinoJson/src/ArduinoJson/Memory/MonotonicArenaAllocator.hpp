@@ -0,0 +1,186 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/Alignment.hpp>
+#include <ArduinoJson/Memory/Allocator.hpp>
+
+#include <stdint.h>  // uint8_t
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// An allocator that carves the allocations out of big blocks and only
+// releases them all at once, with reset().
+// The first block can be a buffer supplied by the caller; the next ones come
+// from the upstream allocator and are kept across reset(), so after the first
+// document, the following ones don't call the upstream allocator at all.
+// deallocate() only releases the most recent allocation, and reallocate()
+// resizes the most recent allocation in place, which is what StringBuilder
+// does when it grows and then shrinks a string. reallocate() shrinks the
+// other allocations in place too, like the pools in shrinkToFit().
+// The documents that use the arena must be destroyed before reset().
+class MonotonicArenaAllocator : public Allocator {
+ public:
+  static const size_t defaultBlockSize = 1024;
+
+  explicit MonotonicArenaAllocator(
+      size_t blockSize = defaultBlockSize,
+      Allocator* upstream = detail::DefaultAllocator::instance())
+      : MonotonicArenaAllocator(nullptr, 0, blockSize, upstream) {}
+
+  MonotonicArenaAllocator(
+      void* buffer, size_t bufferSize, size_t blockSize = defaultBlockSize,
+      Allocator* upstream = detail::DefaultAllocator::instance())
+      : upstream_(upstream), blockSize_(blockSize) {
+    if (buffer) {
+      auto begin = reinterpret_cast<uint8_t*>(buffer);
+      auto end = begin + bufferSize;
+      buffer_ = detail::addPadding(begin);
+      bufferEnd_ = buffer_ < end ? end : buffer_;
+    }
+    reset();
+  }
+
+  MonotonicArenaAllocator(const MonotonicArenaAllocator&) = delete;
+  MonotonicArenaAllocator& operator=(const MonotonicArenaAllocator&) = delete;
+
+  virtual ~MonotonicArenaAllocator() {
+    while (blocks_) {
+      Block* next = blocks_->next;
+      upstream_->deallocate(blocks_);
+      blocks_ = next;
+    }
+  }
+
+  void* allocate(size_t size) override {
+    if (size > maxSize)
+      return nullptr;
+    size_t total = headerSize + detail::addPadding(size);
+    if (size_t(end_ - ptr_) < total && !nextBlock(total))
+      return nullptr;
+    uint8_t* p = ptr_ + headerSize;
+    setSize(p, size);
+    ptr_ += total;
+    last_ = p;
+    return p;
+  }
+
+  void deallocate(void* ptr) override {
+    if (ptr && ptr == last_) {
+      ptr_ = last_ - headerSize;
+      last_ = nullptr;
+    }
+  }
+
+  void* reallocate(void* ptr, size_t newSize) override {
+    if (!ptr)
+      return allocate(newSize);
+    if (newSize > maxSize)
+      return nullptr;
+
+    auto p = reinterpret_cast<uint8_t*>(ptr);
+    if (p == last_ && size_t(end_ - p) >= detail::addPadding(newSize)) {
+      setSize(p, newSize);
+      ptr_ = p + detail::addPadding(newSize);
+      return p;
+    }
+
+    // shrinking doesn't release the space, but it must not consume more
+    size_t oldSize = getSize(p);
+    if (newSize <= oldSize) {
+      setSize(p, newSize);
+      return p;
+    }
+
+    void* newPtr = allocate(newSize);
+    if (newPtr)
+      memcpy(newPtr, p, oldSize);
+    return newPtr;
+  }
+
+  // Releases all the allocations at once.
+  // The blocks from the upstream allocator are kept for the next allocations.
+  void reset() {
+    current_ = nullptr;
+    ptr_ = buffer_;
+    end_ = bufferEnd_;
+    last_ = nullptr;
+  }
+
+ private:
+  struct Block {
+    Block* next;
+    size_t size;  // the number of bytes after the header
+
+    uint8_t* begin() {
+      return reinterpret_cast<uint8_t*>(this) + blockHeaderSize;
+    }
+  };
+
+  static const size_t blockHeaderSize =
+      detail::AddPadding<sizeof(Block)>::value;
+
+  // each allocation is preceded by its size, so reallocate() can copy it
+  static const size_t headerSize = detail::AddPadding<sizeof(size_t)>::value;
+
+  // above this size, the padding and the headers would overflow size_t
+  static const size_t maxSize =
+      size_t(-1) - blockHeaderSize - headerSize - sizeof(void*);
+
+  static size_t getSize(uint8_t* p) {
+    size_t size;
+    memcpy(&size, p - headerSize, sizeof(size));
+    return size;
+  }
+
+  static void setSize(uint8_t* p, size_t size) {
+    memcpy(p - headerSize, &size, sizeof(size));
+  }
+
+  // Moves to the next block that can hold size bytes, reusing the blocks
+  // allocated before the last reset()
+  bool nextBlock(size_t size) {
+    Block* next = current_ ? current_->next : blocks_;
+    if (!next || next->size < size) {
+      size_t blockSize = size > blockSize_ ? size : blockSize_;
+      if (blockSize > size_t(-1) - blockHeaderSize)
+        return false;
+      auto block = reinterpret_cast<Block*>(
+          upstream_->allocate(blockHeaderSize + blockSize));
+      if (!block)
+        return false;
+      block->size = blockSize;
+      block->next = next;
+      if (current_)
+        current_->next = block;
+      else
+        blocks_ = block;
+      next = block;
+    }
+    current_ = next;
+    ptr_ = next->begin();
+    end_ = ptr_ + next->size;
+    last_ = nullptr;
+    return true;
+  }
+
+  Allocator* upstream_;
+  size_t blockSize_;
+
+  // the buffer supplied by the caller
+  uint8_t* buffer_ = nullptr;
+  uint8_t* bufferEnd_ = nullptr;
+
+  // the blocks from the upstream allocator, in the order they're used
+  Block* blocks_ = nullptr;
+  Block* current_ = nullptr;  // null while in the caller's buffer
+
+  uint8_t* ptr_ = nullptr;  // the free space in the current block
+  uint8_t* end_ = nullptr;
+  uint8_t* last_ = nullptr;  // the most recent allocation
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
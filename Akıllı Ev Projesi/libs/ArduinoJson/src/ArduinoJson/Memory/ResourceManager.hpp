@@ -5,7 +5,11 @@
 #pragma once
 
 #include <ArduinoJson/Memory/Allocator.hpp>
+#include <ArduinoJson/Memory/ElementIndex.hpp>
+#include <ArduinoJson/Memory/IndexMap.hpp>
+#include <ArduinoJson/Memory/KeyIndex.hpp>
 #include <ArduinoJson/Memory/MemoryPoolList.hpp>
+#include <ArduinoJson/Memory/StringArena.hpp>
 #include <ArduinoJson/Memory/StringPool.hpp>
 #include <ArduinoJson/Polyfills/assert.hpp>
 #include <ArduinoJson/Polyfills/utility.hpp>
@@ -29,10 +33,18 @@ class ResourceManager {
   constexpr static size_t slotSize = sizeof(SlotData);
 
   ResourceManager(Allocator* allocator = DefaultAllocator::instance())
-      : allocator_(allocator), overflowed_(false) {}
+      : allocator_(allocator), overflowed_(false), stringArena_(allocator) {}
 
   ~ResourceManager() {
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+    keyIndexes_.clear(allocator_);
+#endif
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+    elementIndexes_.clear(allocator_);
+#endif
+    stringPool_.reset(stringAllocator());
     stringPool_.clear(allocator_);
+    stringArena_.release();
     variantPools_.clear(allocator_);
   }
 
@@ -41,9 +53,17 @@ class ResourceManager {
 
   friend void swap(ResourceManager& a, ResourceManager& b) {
     swap(a.stringPool_, b.stringPool_);
+    swap(a.stringArena_, b.stringArena_);
     swap(a.variantPools_, b.variantPools_);
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+    swap(a.keyIndexes_, b.keyIndexes_);
+#endif
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+    swap(a.elementIndexes_, b.elementIndexes_);
+#endif
     swap_(a.allocator_, b.allocator_);
     swap_(a.overflowed_, b.overflowed_);
+    swap_(a.keepCapacity_, b.keepCapacity_);
   }
 
   Allocator* allocator() const {
@@ -58,6 +78,35 @@ class ResourceManager {
     return overflowed_;
   }
 
+  // Returns true after reserve() or clear(true), until clear() or
+  // shrinkToFit()
+  bool keepsCapacity() const {
+    return keepCapacity_;
+  }
+
+  // Returns the number of slot ids in use; they go from 0 to slotCount() - 1
+  size_t slotCount() const {
+    return variantPools_.idCount();
+  }
+
+  // Copies the slots in an array of slotCount() slots, in the order of their
+  // ids
+  void copySlots(void* dst) const {
+    variantPools_.copyTo(dst);
+  }
+
+  // Reads the variants from slots that the manager doesn't own, such as the
+  // ones of a snapshot. Returns false if the allocation of the pool list
+  // fails. Call detachSlots() before destroying the manager.
+  bool attachSlots(void* slots, size_t count) {
+    return variantPools_.attach(reinterpret_cast<SlotData*>(slots), count,
+                                allocator_);
+  }
+
+  void detachSlots() {
+    variantPools_.detach(allocator_);
+  }
+
   Slot<VariantData> allocVariant();
   void freeVariant(Slot<VariantData> slot);
   VariantData* getVariant(SlotId id) const;
@@ -73,7 +122,7 @@ class ResourceManager {
     if (str.isNull())
       return 0;
 
-    auto node = stringPool_.add(str, allocator_);
+    auto node = stringPool_.add(str, allocator_, stringAllocator());
     if (!node)
       overflowed_ = true;
 
@@ -81,7 +130,7 @@ class ResourceManager {
   }
 
   void saveString(StringNode* node) {
-    stringPool_.add(node);
+    stringPool_.add(node, allocator_);
   }
 
   template <typename TAdaptedString>
@@ -90,42 +139,131 @@ class ResourceManager {
   }
 
   StringNode* createString(size_t length) {
-    auto node = StringNode::create(length, allocator_);
+    auto node = StringNode::create(length, stringAllocator());
     if (!node)
       overflowed_ = true;
     return node;
   }
 
   StringNode* resizeString(StringNode* node, size_t length) {
-    node = StringNode::resize(node, length, allocator_);
+    node = StringNode::resize(node, length, stringAllocator());
     if (!node)
       overflowed_ = true;
     return node;
   }
 
   void destroyString(StringNode* node) {
-    StringNode::destroy(node, allocator_);
+    StringNode::destroy(node, stringAllocator());
   }
 
-  void dereferenceString(const char* s) {
-    stringPool_.dereference(s, allocator_);
+  void dereferenceString(StringNode* node) {
+    stringPool_.dereference(node, stringAllocator());
   }
 
-  void clear() {
-    variantPools_.clear(allocator_);
+  // Releases all the values and strings.
+  // If keepCapacity is true, the pools and the string arena stay allocated for
+  // the next values.
+  void clear(bool keepCapacity = false) {
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+    keyIndexes_.clear(allocator_);
+#endif
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+    elementIndexes_.clear(allocator_);
+#endif
+    if (keepCapacity)
+      variantPools_.reset();
+    else
+      variantPools_.clear(allocator_);
     overflowed_ = false;
-    stringPool_.clear(allocator_);
+    stringPool_.reset(stringAllocator());
+    if (keepCapacity) {
+      stringArena_.reset();
+    } else {
+      stringPool_.clear(allocator_);
+      stringArena_.release();
+    }
+    keepCapacity_ = keepCapacity;
+  }
+
+  // Allocates the pools for the specified number of slots, and an arena for
+  // the specified number of bytes of strings.
+  // The arena can only be allocated while it's empty.
+  bool reserve(size_t slots, size_t stringBytes) {
+    if (!variantPools_.reserve(slots, allocator_))
+      return false;
+    if (stringBytes > stringArena_.capacity()) {
+      if (stringArena_.size() != 0 || !stringArena_.resize(stringBytes))
+        return false;
+    }
+    keepCapacity_ = true;
+    return true;
   }
 
   void shrinkToFit() {
     variantPools_.shrinkToFit(allocator_);
+    if (stringArena_.size() == 0)
+      stringArena_.release();
+    keepCapacity_ = false;
+  }
+
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+  // The key indexes are a cache: they can be updated through a const object
+
+  KeyIndex* getKeyIndex(SlotId head) const {
+    return keyIndexes_.get(head);
+  }
+
+  KeyIndex* createKeyIndex(SlotId head) const {
+    return keyIndexes_.create(head, allocator_);
+  }
+
+  void destroyKeyIndex(SlotId head) const {
+    keyIndexes_.remove(head, allocator_);
+  }
+
+  void renameKeyIndex(SlotId oldHead, SlotId newHead) const {
+    keyIndexes_.rename(oldHead, newHead, allocator_);
+  }
+#endif
+
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  // The element indexes are a cache: they can be updated through a const array
+
+  ElementIndex* getElementIndex(SlotId head) const {
+    return elementIndexes_.get(head);
   }
 
+  ElementIndex* createElementIndex(SlotId head) const {
+    return elementIndexes_.create(head, allocator_);
+  }
+
+  void destroyElementIndex(SlotId head) const {
+    elementIndexes_.remove(head, allocator_);
+  }
+
+  void renameElementIndex(SlotId oldHead, SlotId newHead) const {
+    elementIndexes_.rename(oldHead, newHead, allocator_);
+  }
+#endif
+
  private:
+  // The strings go through the arena once reserve() allocated it
+  Allocator* stringAllocator() {
+    return stringArena_.capacity() ? &stringArena_ : allocator_;
+  }
+
   Allocator* allocator_;
   bool overflowed_;
+  bool keepCapacity_ = false;
   StringPool stringPool_;
+  StringArena stringArena_;
   MemoryPoolList<SlotData> variantPools_;
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+  mutable IndexMap<KeyIndex> keyIndexes_;
+#endif
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  mutable IndexMap<ElementIndex> elementIndexes_;
+#endif
 };
 
 ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -0,0 +1,125 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/Alignment.hpp>
+#include <ArduinoJson/Memory/Allocator.hpp>
+#include <ArduinoJson/Memory/StringNode.hpp>
+#include <ArduinoJson/Polyfills/assert.hpp>
+#include <ArduinoJson/Polyfills/utility.hpp>
+
+#include <stdint.h>  // uint8_t
+#include <string.h>  // memmove
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// The buffer that JsonDocument::reserve() allocates for the strings.
+// It bump-allocates the strings, and forwards to the upstream allocator once
+// it's full. The space of a string is only reused after reset(), unless it's
+// the most recent one, so StringBuilder grows and shrinks its string in place.
+// The blocks must be StringNodes: reallocate() reads the old length in the
+// node.
+class StringArena : public Allocator {
+ public:
+  explicit StringArena(Allocator* upstream) : upstream_(upstream) {}
+
+  StringArena(const StringArena&) = delete;
+  StringArena& operator=(const StringArena&) = delete;
+
+  virtual ~StringArena() {
+    ARDUINOJSON_ASSERT(begin_ == nullptr);
+  }
+
+  friend void swap(StringArena& a, StringArena& b) {
+    swap_(a.upstream_, b.upstream_);
+    swap_(a.begin_, b.begin_);
+    swap_(a.end_, b.end_);
+    swap_(a.ptr_, b.ptr_);
+    swap_(a.last_, b.last_);
+  }
+
+  size_t capacity() const {
+    return size_t(end_ - begin_);
+  }
+
+  size_t size() const {
+    return size_t(ptr_ - begin_);
+  }
+
+  // Replaces the buffer; the arena must be empty
+  bool resize(size_t n) {
+    ARDUINOJSON_ASSERT(size() == 0);
+    auto buffer = reinterpret_cast<uint8_t*>(upstream_->allocate(n));
+    if (!buffer)
+      return false;
+    release();
+    begin_ = ptr_ = buffer;
+    end_ = buffer + n;
+    return true;
+  }
+
+  void release() {
+    if (begin_)
+      upstream_->deallocate(begin_);
+    begin_ = end_ = ptr_ = last_ = nullptr;
+  }
+
+  // Forgets all the strings, but keeps the buffer
+  void reset() {
+    ptr_ = begin_;
+    last_ = nullptr;
+  }
+
+  void* allocate(size_t size) override {
+    size_t n = addPadding(size);
+    if (size_t(end_ - ptr_) < n)
+      return upstream_->allocate(size);
+    last_ = ptr_;
+    ptr_ += n;
+    return last_;
+  }
+
+  void deallocate(void* ptr) override {
+    auto p = reinterpret_cast<uint8_t*>(ptr);
+    if (!contains(p))
+      upstream_->deallocate(ptr);
+    else if (p == last_) {
+      ptr_ = last_;
+      last_ = nullptr;
+    }
+  }
+
+  void* reallocate(void* ptr, size_t size) override {
+    auto p = reinterpret_cast<uint8_t*>(ptr);
+    if (!contains(p))
+      return upstream_->reallocate(ptr, size);
+
+    if (p == last_ && size_t(end_ - p) >= addPadding(size)) {
+      ptr_ = p + addPadding(size);
+      return p;
+    }
+
+    // StringNode::resize() updates the length after the reallocation
+    size_t oldSize =
+        StringNode::sizeForLength(reinterpret_cast<StringNode*>(p)->length);
+    auto newPtr = allocate(size);
+    if (newPtr)
+      memmove(newPtr, p, size < oldSize ? size : oldSize);
+    return newPtr;
+  }
+
+ private:
+  bool contains(const uint8_t* p) const {
+    return p >= begin_ && p < end_;
+  }
+
+  Allocator* upstream_;
+  uint8_t* begin_ = nullptr;
+  uint8_t* end_ = nullptr;
+  uint8_t* ptr_ = nullptr;
+  uint8_t* last_ = nullptr;  // the most recent allocation
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -32,9 +32,31 @@ class StringBuffer {
     return node_->data;
   }
 
+  // Adds n characters after the ones reserved before, and returns a pointer to
+  // the first one. Used when the size of a string is only known at the end.
+  char* extend(size_t n) {
+    ARDUINOJSON_ASSERT(node_ != nullptr);
+    size_t capacity = size_ + n;
+    if (capacity < n)  // integer overflow
+      return nullptr;
+    if (capacity > node_->length) {
+      // grow geometrically, so that many small parts don't cost many copies
+      size_t length = size_t(node_->length) * 2;
+      if (length < capacity || length > StringNode::maxLength)
+        length = capacity;
+      node_ = resources_->resizeString(node_, length);
+      if (!node_)
+        return nullptr;
+    }
+    char* p = node_->data + size_;
+    size_ = capacity;
+    node_->data[capacity] = 0;  // null-terminate the string
+    return p;
+  }
+
   JsonString str() const {
     ARDUINOJSON_ASSERT(node_ != nullptr);
-    return JsonString(node_->data, node_->length);
+    return JsonString(node_->data, size_);
   }
 
   void save(VariantData* data) {
@@ -0,0 +1,105 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/HashTable.hpp>
+#include <ArduinoJson/Memory/StringNode.hpp>
+#include <ArduinoJson/Strings/StringAdapters.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// A hash table of StringNodes.
+// The hash of each string is cached in the table to avoid comparing strings
+// whose hash differ.
+class StringIndex {
+  struct Entry {
+    StringNode* node;
+    uint32_t hash_;
+
+    uint32_t hash() const {
+      return hash_;
+    }
+
+    bool isEmpty() const {
+      return node == nullptr;
+    }
+
+    static Entry empty() {
+      return {nullptr, 0};
+    }
+  };
+
+  template <typename TAdaptedString>
+  struct StringMatcher {
+    const TAdaptedString& str;
+
+    bool operator()(const Entry& entry) const {
+      return stringEquals(str,
+                          adaptString(entry.node->data, entry.node->length));
+    }
+  };
+
+  struct NodeMatcher {
+    const StringNode* node;
+
+    bool operator()(const Entry& entry) const {
+      return entry.node == node;
+    }
+  };
+
+ public:
+  friend void swap(StringIndex& a, StringIndex& b) {
+    swap(a.table_, b.table_);
+  }
+
+  template <typename TAdaptedString>
+  StringNode* find(const TAdaptedString& str, uint32_t hash) const {
+    auto entry = table_.find(hash, StringMatcher<TAdaptedString>{str});
+    return entry ? entry->node : nullptr;
+  }
+
+  // Returns false if the table is full and cannot grow
+  bool insert(StringNode* node, uint32_t hash, Allocator* allocator) {
+    ARDUINOJSON_ASSERT(node != nullptr);
+    return table_.insert({node, hash}, allocator);
+  }
+
+  // Returns false if the node is not in the table
+  bool remove(const StringNode* node, uint32_t hash) {
+    return table_.remove(hash, NodeMatcher{node});
+  }
+
+  size_t size() const {
+    size_t total = 0;
+    for (size_t i = 0; i < table_.capacity(); i++) {
+      if (!table_[i].isEmpty())
+        total += sizeofString(table_[i].node->length);
+    }
+    return total;
+  }
+
+  // Destroys all the strings, but keeps the table
+  void reset(Allocator* stringAllocator) {
+    for (size_t i = 0; i < table_.capacity(); i++) {
+      if (!table_[i].isEmpty())
+        StringNode::destroy(table_[i].node, stringAllocator);
+    }
+    table_.reset();
+  }
+
+  // Destroys all the strings and releases the table
+  void clear(Allocator* allocator) {
+    for (size_t i = 0; i < table_.capacity(); i++) {
+      if (!table_[i].isEmpty())
+        StringNode::destroy(table_[i].node, allocator);
+    }
+    table_.clear(allocator);
+  }
+
+ private:
+  HashTable<Entry> table_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
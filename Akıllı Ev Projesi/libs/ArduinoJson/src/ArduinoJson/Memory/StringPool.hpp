@@ -5,6 +5,7 @@
 #pragma once
 
 #include <ArduinoJson/Memory/Allocator.hpp>
+#include <ArduinoJson/Memory/StringIndex.hpp>
 #include <ArduinoJson/Memory/StringNode.hpp>
 #include <ArduinoJson/Polyfills/assert.hpp>
 #include <ArduinoJson/Polyfills/utility.hpp>
@@ -24,9 +25,27 @@ class StringPool {
 
   friend void swap(StringPool& a, StringPool& b) {
     swap_(a.strings_, b.strings_);
+#if ARDUINOJSON_ENABLE_STRING_INDEX
+    swap(a.index_, b.index_);
+#endif
+  }
+
+  // Destroys all the strings, but keeps the index
+  void reset(Allocator* stringAllocator) {
+#if ARDUINOJSON_ENABLE_STRING_INDEX
+    index_.reset(stringAllocator);
+#endif
+    while (strings_) {
+      auto node = strings_;
+      strings_ = node->next;
+      StringNode::destroy(node, stringAllocator);
+    }
   }
 
   void clear(Allocator* allocator) {
+#if ARDUINOJSON_ENABLE_STRING_INDEX
+    index_.clear(allocator);
+#endif
     while (strings_) {
       auto node = strings_;
       strings_ = node->next;
@@ -36,13 +55,18 @@ class StringPool {
 
   size_t size() const {
     size_t total = 0;
+#if ARDUINOJSON_ENABLE_STRING_INDEX
+    total += index_.size();
+#endif
     for (auto node = strings_; node; node = node->next)
       total += sizeofString(node->length);
     return total;
   }
 
+  // The nodes are allocated with stringAllocator, the index with allocator
   template <typename TAdaptedString>
-  StringNode* add(TAdaptedString str, Allocator* allocator) {
+  StringNode* add(TAdaptedString str, Allocator* allocator,
+                  Allocator* stringAllocator) {
     ARDUINOJSON_ASSERT(str.isNull() == false);
 
     auto node = get(str);
@@ -53,24 +77,36 @@ class StringPool {
 
     size_t n = str.size();
 
-    node = StringNode::create(n, allocator);
+    node = StringNode::create(n, stringAllocator);
     if (!node)
       return nullptr;
 
     stringGetChars(str, node->data, n);
     node->data[n] = 0;  // force NUL terminator
-    add(node);
+    add(node, allocator);
     return node;
   }
 
-  void add(StringNode* node) {
+  void add(StringNode* node, Allocator* allocator) {
     ARDUINOJSON_ASSERT(node != nullptr);
+#if ARDUINOJSON_ENABLE_STRING_INDEX
+    if (index_.insert(node, hashOf(node), allocator))
+      return;
+    // the index couldn't grow: fall back to the linked list
+#else
+    (void)allocator;
+#endif
     node->next = strings_;
     strings_ = node;
   }
 
   template <typename TAdaptedString>
   StringNode* get(const TAdaptedString& str) const {
+#if ARDUINOJSON_ENABLE_STRING_INDEX
+    auto found = index_.find(str, stringHash(str));
+    if (found)
+      return found;
+#endif
     for (auto node = strings_; node; node = node->next) {
       if (stringEquals(str, adaptString(node->data, node->length)))
         return node;
@@ -78,17 +114,24 @@ class StringPool {
     return nullptr;
   }
 
-  void dereference(const char* s, Allocator* allocator) {
+  void dereference(StringNode* target, Allocator* stringAllocator) {
+    ARDUINOJSON_ASSERT(target != nullptr);
+    if (--target->references != 0)
+      return;
+#if ARDUINOJSON_ENABLE_STRING_INDEX
+    if (index_.remove(target, hashOf(target))) {
+      StringNode::destroy(target, stringAllocator);
+      return;
+    }
+#endif
     StringNode* prev = nullptr;
     for (auto node = strings_; node; node = node->next) {
-      if (node->data == s) {
-        if (--node->references == 0) {
-          if (prev)
-            prev->next = node->next;
-          else
-            strings_ = node->next;
-          StringNode::destroy(node, allocator);
-        }
+      if (node == target) {
+        if (prev)
+          prev->next = node->next;
+        else
+          strings_ = node->next;
+        StringNode::destroy(node, stringAllocator);
         return;
       }
       prev = node;
@@ -96,6 +139,13 @@ class StringPool {
   }
 
  private:
+#if ARDUINOJSON_ENABLE_STRING_INDEX
+  static uint32_t hashOf(const StringNode* node) {
+    return stringHash(adaptString(node->data, node->length));
+  }
+
+  StringIndex index_;
+#endif
   StringNode* strings_ = nullptr;
 };
 
@@ -31,6 +31,14 @@ class MsgPackDeserializer {
     return foundSomething_ ? err : DeserializationError::EmptyInput;
   }
 
+  template <typename THandler>
+  DeserializationError parseEvents(
+      THandler& handler, DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+    err = emitVariant(handler, nestingLimit);
+    return foundSomething_ ? err : DeserializationError::EmptyInput;
+  }
+
  private:
   template <typename TFilter>
   DeserializationError::Code parseVariant(
@@ -43,6 +51,16 @@ class MsgPackDeserializer {
     if (err)
       return err;
 
+    return parseVariant(header, variant, filter, nestingLimit);
+  }
+
+  // header[0] is the type code, which was already read
+  template <typename TFilter>
+  DeserializationError::Code parseVariant(
+      uint8_t (&header)[5], VariantData* variant, TFilter filter,
+      DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
     const uint8_t& code = header[0];
 
     foundSomething_ = true;
@@ -142,17 +160,9 @@ class MsgPackDeserializer {
     }
 
     if (sizeBytes) {
-      err = readBytes(header + 1, sizeBytes);
+      err = readSize(header, sizeBytes, size);
       if (err)
         return err;
-
-      uint32_t size32 = 0;
-      for (uint8_t i = 0; i < sizeBytes; i++)
-        size32 = (size32 << 8) | header[i + 1];
-
-      size = size_t(size32);
-      if (size < size32)                        // integer overflow
-        return DeserializationError::NoMemory;  // (not testable on 32/64-bit)
     }
 
     // array 16, 32 and fixarray
@@ -180,6 +190,93 @@ class MsgPackDeserializer {
       return skipBytes(size);
   }
 
+  template <typename THandler>
+  DeserializationError::Code emitVariant(
+      THandler& handler, DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    uint8_t header[5];
+    err = readBytes(header, 1);
+    if (err)
+      return err;
+
+    const uint8_t& code = header[0];
+    bool isArray = code == 0xdc || code == 0xdd || (code & 0xf0) == 0x90;
+    bool isMap = code == 0xde || code == 0xdf || (code & 0xf0) == 0x80;
+
+    if (!isArray && !isMap) {
+      VariantData value;
+      err = parseVariant(header, &value, AllowAllFilter(), nestingLimit);
+      if (!err)
+        handler.value(JsonVariantConst(&value, resources_));
+      value.clear(resources_);
+      return err;
+    }
+
+    foundSomething_ = true;
+
+    size_t size = code & 0x0F;
+    if (code >= 0xdc) {
+      err = readSize(header, (code & 1) ? 4 : 2, size);  // 16 or 32 bits
+      if (err)
+        return err;
+    }
+
+    if (nestingLimit.reached())
+      return DeserializationError::TooDeep;
+
+    if (isArray) {
+      if (!handler.startArray())
+        return readArray(nullptr, size, AllowNothingFilter(), nestingLimit);
+
+      for (; size; --size) {
+        err = emitVariant(handler, nestingLimit.decrement());
+        if (err)
+          return err;
+      }
+
+      handler.endArray();
+      return DeserializationError::Ok;
+    }
+
+    if (!handler.startObject())
+      return readObject(nullptr, size, AllowNothingFilter(), nestingLimit);
+
+    for (; size; --size) {
+      err = readKey();
+      if (err)
+        return err;
+
+      if (handler.key(stringBuffer_.str()))
+        err = emitVariant(handler, nestingLimit.decrement());
+      else
+        err = parseVariant(nullptr, AllowNothingFilter(),
+                           nestingLimit.decrement());
+      if (err)
+        return err;
+    }
+
+    handler.endObject();
+    return DeserializationError::Ok;
+  }
+
+  // Reads the size that follows the type code in header[0]
+  DeserializationError::Code readSize(uint8_t (&header)[5], uint8_t sizeBytes,
+                                      size_t& size) {
+    auto err = readBytes(header + 1, sizeBytes);
+    if (err)
+      return err;
+
+    uint32_t size32 = 0;
+    for (uint8_t i = 0; i < sizeBytes; i++)
+      size32 = (size32 << 8) | header[i + 1];
+
+    size = size_t(size32);
+    if (size < size32)                        // integer overflow
+      return DeserializationError::NoMemory;  // (not testable on 32/64-bit)
+    return DeserializationError::Ok;
+  }
+
   DeserializationError::Code readByte(uint8_t& value) {
     int c = reader_.read();
     if (c < 0)
@@ -484,4 +581,40 @@ inline DeserializationError deserializeMsgPack(TDestination&& dst, TChar* input,
                                           detail::forward<Args>(args)...);
 }
 
+// Parses a MessagePack input and calls the handler for each value, without
+// building a document. The handler must have these member functions:
+//   bool startObject(), bool startArray(): return false to skip the value
+//   void endObject(), void endArray()
+//   bool key(JsonString): return false to skip the member
+//   void value(JsonVariantConst): a string, a number, a boolean, null,
+//     a MsgPackBinary, or a MsgPackExtension
+// The strings passed to the handler are only valid during the call.
+template <typename THandler, typename TInput>
+inline DeserializationError deserializeMsgPackEvents(
+    THandler& handler, TInput&& input,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  using namespace detail;
+  return deserializeEvents<MsgPackDeserializer>(
+      handler, makeReader(detail::forward<TInput>(input)), nestingLimit);
+}
+
+template <typename THandler, typename TChar>
+inline DeserializationError deserializeMsgPackEvents(
+    THandler& handler, TChar* input,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  using namespace detail;
+  return deserializeEvents<MsgPackDeserializer>(handler, makeReader(input),
+                                                nestingLimit);
+}
+
+template <typename THandler, typename TChar, typename Size,
+          detail::enable_if_t<detail::is_integral<Size>::value, int> = 0>
+inline DeserializationError deserializeMsgPackEvents(
+    THandler& handler, TChar* input, Size inputSize,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  using namespace detail;
+  return deserializeEvents<MsgPackDeserializer>(
+      handler, makeReader(input, size_t(inputSize)), nestingLimit);
+}
+
 ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -0,0 +1,52 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/MsgPack/MsgPackSerializer.hpp>
+#include <ArduinoJson/Serialization/SerializationCursor.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+template <typename TWriter>
+class MsgPackCursorFormat : public MsgPackSerializer<TWriter> {
+  using base = MsgPackSerializer<TWriter>;
+
+ public:
+  MsgPackCursorFormat(TWriter writer, const ResourceManager* resources)
+      : base(writer, resources) {}
+
+  void writeStart(bool isObject, size_t size) {
+    if (isObject)
+      base::writeMapHeader(size);
+    else
+      base::writeArrayHeader(size);
+  }
+
+  // MessagePack has no separators and no end markers
+  void writeSeparator(bool, bool, size_t) {}
+  void writeEnd(bool, bool, size_t) {}
+
+  void writeStringStart(size_t n) {
+    base::writeStringHeader(n);
+  }
+
+  void writeStringPart(const char* s, size_t n) {
+    base::visit(RawString(s, n));
+  }
+
+  void writeStringEnd() {}
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Produces a MessagePack document in chunks of any size.
+// Each call to read() resumes where the previous one stopped, so the
+// document is serialized only once.
+using MsgPackSerializationCursor =
+    detail::SerializationCursor<detail::MsgPackCursorFormat>;
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -48,16 +48,7 @@ class MsgPackSerializer : public VariantDataVisitor<size_t> {
   }
 
   size_t visit(const ArrayData& array) {
-    size_t n = array.size(resources_);
-    if (n < 0x10) {
-      writeByte(uint8_t(0x90 + n));
-    } else if (n < 0x10000) {
-      writeByte(0xDC);
-      writeInteger(uint16_t(n));
-    } else {
-      writeByte(0xDD);
-      writeInteger(uint32_t(n));
-    }
+    writeArrayHeader(array.size(resources_));
 
     auto slotId = array.head();
     while (slotId != NULL_SLOT) {
@@ -70,16 +61,7 @@ class MsgPackSerializer : public VariantDataVisitor<size_t> {
   }
 
   size_t visit(const ObjectData& object) {
-    size_t n = object.size(resources_);
-    if (n < 0x10) {
-      writeByte(uint8_t(0x80 + n));
-    } else if (n < 0x10000) {
-      writeByte(0xDE);
-      writeInteger(uint16_t(n));
-    } else {
-      writeByte(0xDF);
-      writeInteger(uint32_t(n));
-    }
+    writeMapHeader(object.size(resources_));
 
     auto slotId = object.head();
     while (slotId != NULL_SLOT) {
@@ -99,19 +81,7 @@ class MsgPackSerializer : public VariantDataVisitor<size_t> {
     ARDUINOJSON_ASSERT(!value.isNull());
 
     auto n = value.size();
-
-    if (n < 0x20) {
-      writeByte(uint8_t(0xA0 + n));
-    } else if (n < 0x100) {
-      writeByte(0xD9);
-      writeInteger(uint8_t(n));
-    } else if (n < 0x10000) {
-      writeByte(0xDA);
-      writeInteger(uint16_t(n));
-    } else {
-      writeByte(0xDB);
-      writeInteger(uint32_t(n));
-    }
+    writeStringHeader(n);
     writeBytes(reinterpret_cast<const uint8_t*>(value.c_str()), n);
     return bytesWritten();
   }
@@ -189,6 +159,46 @@ class MsgPackSerializer : public VariantDataVisitor<size_t> {
     return bytesWritten();
   }
 
+ protected:
+  void writeArrayHeader(size_t n) {
+    if (n < 0x10) {
+      writeByte(uint8_t(0x90 + n));
+    } else if (n < 0x10000) {
+      writeByte(0xDC);
+      writeInteger(uint16_t(n));
+    } else {
+      writeByte(0xDD);
+      writeInteger(uint32_t(n));
+    }
+  }
+
+  void writeStringHeader(size_t n) {
+    if (n < 0x20) {
+      writeByte(uint8_t(0xA0 + n));
+    } else if (n < 0x100) {
+      writeByte(0xD9);
+      writeInteger(uint8_t(n));
+    } else if (n < 0x10000) {
+      writeByte(0xDA);
+      writeInteger(uint16_t(n));
+    } else {
+      writeByte(0xDB);
+      writeInteger(uint32_t(n));
+    }
+  }
+
+  void writeMapHeader(size_t n) {
+    if (n < 0x10) {
+      writeByte(uint8_t(0x80 + n));
+    } else if (n < 0x10000) {
+      writeByte(0xDE);
+      writeInteger(uint16_t(n));
+    } else {
+      writeByte(0xDF);
+      writeInteger(uint32_t(n));
+    }
+  }
+
  private:
   size_t bytesWritten() const {
     return writer_.count();
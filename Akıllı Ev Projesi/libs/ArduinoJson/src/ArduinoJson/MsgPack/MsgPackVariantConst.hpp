@@ -0,0 +1,604 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Array/JsonArrayConst.hpp>
+#include <ArduinoJson/Document/IsDocumentReference.hpp>
+#include <ArduinoJson/Document/JsonDocument.hpp>
+#include <ArduinoJson/MsgPack/MsgPackBinary.hpp>
+#include <ArduinoJson/MsgPack/MsgPackDeserializer.hpp>
+#include <ArduinoJson/MsgPack/MsgPackExtension.hpp>
+#include <ArduinoJson/MsgPack/endianness.hpp>
+#include <ArduinoJson/MsgPack/ieee754.hpp>
+#include <ArduinoJson/Numbers/convertNumber.hpp>
+#include <ArduinoJson/Numbers/parseNumber.hpp>
+#include <ArduinoJson/Object/JsonObjectConst.hpp>
+#include <ArduinoJson/Strings/IsString.hpp>
+#include <ArduinoJson/Strings/StringAdapters.hpp>
+
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+enum class MsgPackTokenType : uint8_t {
+  Invalid,  // truncated input or reserved code
+  Null,     // also integers that don't fit in JsonInteger or JsonUInt
+  Boolean,
+  SignedInteger,
+  UnsignedInteger,
+  Float,
+  String,
+  Binary,
+  Extension,
+  Array,
+  Map,
+};
+
+// The header of a MessagePack value
+struct MsgPackToken {
+  MsgPackTokenType type = MsgPackTokenType::Invalid;
+
+  bool boolean = false;
+  JsonInteger signedInteger = 0;
+  JsonUInt unsignedInteger = 0;
+  JsonFloat floating = 0;
+  int8_t extensionType = 0;
+
+  // The content of a string, a binary, or an extension,
+  // or the first element of an array or a map
+  const uint8_t* payload = nullptr;
+
+  // The length of a string, a binary, or an extension,
+  // the number of elements of an array, or the number of pairs of a map
+  size_t size = 0;
+
+  // The address after the value, except for arrays and maps
+  const uint8_t* next = nullptr;
+};
+
+inline uint64_t readMsgPackBigEndian(const uint8_t* p, uint8_t width,
+                                     bool isSigned) {
+  uint64_t value = isSigned && (p[0] & 0x80) ? ~uint64_t(0) : 0;
+  for (uint8_t i = 0; i < width; i++)
+    value = (value << 8) | p[i];
+  return value;
+}
+
+template <typename T>
+enable_if_t<sizeof(T) == 8, T> readMsgPackDouble(const uint8_t* p) {
+  T value;
+  memcpy(&value, p, 8);
+  fixEndianness(value);
+  return value;
+}
+
+template <typename T>
+enable_if_t<sizeof(T) == 4, T> readMsgPackDouble(const uint8_t* p) {
+  T value;
+  doubleToFloat(p, reinterpret_cast<uint8_t*>(&value));
+  fixEndianness(value);
+  return value;
+}
+
+// Decodes the header of the value at p, with the same rules as
+// MsgPackDeserializer
+inline MsgPackToken decodeMsgPack(const uint8_t* p, const uint8_t* end) {
+  MsgPackToken token;
+  if (!p || p >= end)
+    return token;
+
+  uint8_t code = *p++;
+  size_t available = size_t(end - p);
+
+  if (code <= 0x7f || code >= 0xe0) {  // fixint
+    token.type = MsgPackTokenType::SignedInteger;
+    token.signedInteger = static_cast<int8_t>(code);
+    token.next = p;
+    return token;
+  }
+
+  if (code >= 0xcc && code <= 0xd3) {
+    auto width = uint8_t(1U << ((code - 0xcc) % 4));
+    if (available < width)
+      return token;
+    bool isSigned = code >= 0xd0;
+    uint64_t value = readMsgPackBigEndian(p, width, isSigned);
+    token.next = p + width;
+    token.type = MsgPackTokenType::Null;  // on overflow
+    if (isSigned) {
+      auto signedValue = static_cast<int64_t>(value);
+      auto truncatedValue = static_cast<JsonInteger>(signedValue);
+      if (truncatedValue == signedValue) {
+        token.type = MsgPackTokenType::SignedInteger;
+        token.signedInteger = truncatedValue;
+      }
+    } else {
+      auto truncatedValue = static_cast<JsonUInt>(value);
+      if (truncatedValue == value) {
+        token.type = MsgPackTokenType::UnsignedInteger;
+        token.unsignedInteger = truncatedValue;
+      }
+    }
+    return token;
+  }
+
+  switch (code) {
+    case 0xc0:
+      token.type = MsgPackTokenType::Null;
+      token.next = p;
+      return token;
+
+    case 0xc1:
+      return token;
+
+    case 0xc2:
+    case 0xc3:
+      token.type = MsgPackTokenType::Boolean;
+      token.boolean = code == 0xc3;
+      token.next = p;
+      return token;
+
+    case 0xca:
+      if (available < 4)
+        return token;
+      {
+        float value;
+        memcpy(&value, p, 4);
+        fixEndianness(value);
+        token.floating = JsonFloat(value);
+      }
+      token.type = MsgPackTokenType::Float;
+      token.next = p + 4;
+      return token;
+
+    case 0xcb:
+      if (available < 8)
+        return token;
+      token.floating = JsonFloat(readMsgPackDouble<double>(p));
+      token.type = MsgPackTokenType::Float;
+      token.next = p + 8;
+      return token;
+  }
+
+  uint8_t sizeBytes = 0;
+  size_t size = 0;
+
+  switch (code) {
+    case 0xc4:  // bin 8
+    case 0xc7:  // ext 8
+    case 0xd9:  // str 8
+      sizeBytes = 1;
+      break;
+
+    case 0xc5:  // bin 16
+    case 0xc8:  // ext 16
+    case 0xda:  // str 16
+    case 0xdc:  // array 16
+    case 0xde:  // map 16
+      sizeBytes = 2;
+      break;
+
+    case 0xc6:  // bin 32
+    case 0xc9:  // ext 32
+    case 0xdb:  // str 32
+    case 0xdd:  // array 32
+    case 0xdf:  // map 32
+      sizeBytes = 4;
+      break;
+  }
+
+  if (sizeBytes) {
+    if (available < sizeBytes)
+      return token;
+    auto size32 = uint32_t(readMsgPackBigEndian(p, sizeBytes, false));
+    size = size_t(size32);
+    if (size < size32)  // integer overflow
+      return token;
+    p += sizeBytes;
+    available -= sizeBytes;
+  }
+
+  // array 16, 32 and fixarray
+  if (code == 0xdc || code == 0xdd || (code & 0xf0) == 0x90) {
+    if (!sizeBytes)
+      size = code & 0x0F;
+    if (size > available)  // each element takes at least one byte
+      return token;
+    token.type = MsgPackTokenType::Array;
+    token.payload = p;
+    token.size = size;
+    return token;
+  }
+
+  // map 16, 32 and fixmap
+  if (code == 0xde || code == 0xdf || (code & 0xf0) == 0x80) {
+    if (!sizeBytes)
+      size = code & 0x0F;
+    if (size > available / 2)
+      return token;
+    token.type = MsgPackTokenType::Map;
+    token.payload = p;
+    token.size = size;
+    return token;
+  }
+
+  if (code == 0xd9 || code == 0xda || code == 0xdb || (code & 0xe0) == 0xa0) {
+    if (!sizeBytes)
+      size = code & 0x1f;
+    token.type = MsgPackTokenType::String;
+  } else if (code >= 0xc4 && code <= 0xc6) {
+    token.type = MsgPackTokenType::Binary;
+  } else {  // ext 8, 16, 32, and fixext
+    if (code >= 0xd4 && code <= 0xd8)
+      size = size_t(1) << (code - 0xd4);
+    if (available < 1)
+      return token;
+    token.extensionType = static_cast<int8_t>(*p++);
+    available--;
+    token.type = MsgPackTokenType::Extension;
+  }
+
+  if (size > available) {
+    token.type = MsgPackTokenType::Invalid;
+    return token;
+  }
+
+  token.payload = p;
+  token.size = size;
+  token.next = p + size;
+  return token;
+}
+
+// Returns the address after the value at p, or null if it's invalid.
+// Doesn't recurse, so there is no nesting limit.
+inline const uint8_t* skipMsgPack(const uint8_t* p, const uint8_t* end) {
+  size_t remaining = 1;
+  while (remaining) {
+    auto token = decodeMsgPack(p, end);
+    remaining--;
+    switch (token.type) {
+      case MsgPackTokenType::Invalid:
+        return nullptr;
+
+      case MsgPackTokenType::Array:
+        remaining += token.size;  // decodeMsgPack() checked the size
+        p = token.payload;
+        break;
+
+      case MsgPackTokenType::Map:
+        remaining += token.size * 2;
+        p = token.payload;
+        break;
+
+      default:
+        p = token.next;
+        break;
+    }
+  }
+  return p;
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// A read-only reference to a value in a MessagePack document.
+// Unlike deserializeMsgPack(), it doesn't copy anything: it decodes the headers
+// on demand, and the strings and binaries point to the input buffer, which
+// must outlive the MsgPackVariantConst.
+// The conversions give the same results as JsonVariantConst after
+// deserializeMsgPack(). Invalid or truncated values behave like null.
+class MsgPackVariantConst {
+  using Token = detail::MsgPackToken;
+  using TokenType = detail::MsgPackTokenType;
+
+ public:
+  // Creates an unbound reference.
+  MsgPackVariantConst() : data_(nullptr), end_(nullptr) {}
+
+  // Creates a reference to the first value in the buffer.
+  MsgPackVariantConst(const void* data, size_t size)
+      : data_(reinterpret_cast<const uint8_t*>(data)),
+        end_(data_ ? data_ + size : nullptr) {}
+
+  // Returns true if the value is null, invalid, or if the reference is unbound.
+  bool isNull() const {
+    auto type = decode().type;
+    return type == TokenType::Null || type == TokenType::Invalid;
+  }
+
+  // Returns the number of elements of an array, the number of members of an
+  // object, or 0.
+  // It only reads the header of the value.
+  size_t size() const {
+    auto token = decode();
+    switch (token.type) {
+      case TokenType::Array:
+      case TokenType::Map:
+        return token.size;
+      default:
+        return 0;
+    }
+  }
+
+  // Returns the address of the encoded value.
+  const void* data() const {
+    return data_;
+  }
+
+  // Returns the size of the encoded value, or 0 if it's invalid.
+  size_t encodedSize() const {
+    auto next = detail::skipMsgPack(data_, end_);
+    return next ? size_t(next - data_) : 0;
+  }
+
+  // Casts the value to the specified type.
+  // The strings and binaries point to the input buffer; the other types go
+  // through a temporary JsonDocument and Converter<T>.
+  template <typename T>
+  T as() const {
+    return as(type_tag<T>());
+  }
+
+  // Returns true if the value is of the specified type.
+  template <typename T>
+  bool is() const {
+    return is(type_tag<T>());
+  }
+
+  template <typename T>
+  operator T() const {
+    return as<T>();
+  }
+
+  // Gets array's element at specified index.
+  // It skips the previous elements without decoding them.
+  template <typename T,
+            detail::enable_if_t<detail::is_integral<T>::value, int> = 0>
+  MsgPackVariantConst operator[](T index) const {
+    auto token = decode();
+    if (token.type != TokenType::Array || size_t(index) >= token.size)
+      return MsgPackVariantConst();
+    const uint8_t* p = token.payload;
+    for (size_t i = 0; i < size_t(index) && p; i++)
+      p = detail::skipMsgPack(p, end_);
+    return MsgPackVariantConst(p, end_);
+  }
+
+  // Gets object's member with specified key.
+  // It compares the keys in place and skips the other values.
+  template <typename TString,
+            detail::enable_if_t<detail::IsString<TString>::value, int> = 0>
+  MsgPackVariantConst operator[](const TString& key) const {
+    return getMember(detail::adaptString(key));
+  }
+
+  // Gets object's member with specified key.
+  template <typename TChar,
+            detail::enable_if_t<detail::IsString<TChar*>::value &&
+                                    !detail::is_const<TChar>::value,
+                                int> = 0>
+  MsgPackVariantConst operator[](TChar* key) const {
+    return getMember(detail::adaptString(key));
+  }
+
+ private:
+  template <typename T>
+  struct type_tag {};
+
+  MsgPackVariantConst(const uint8_t* data, const uint8_t* end)
+      : data_(data), end_(data ? end : nullptr) {}
+
+  Token decode() const {
+    return detail::decodeMsgPack(data_, end_);
+  }
+
+  template <typename TAdaptedString>
+  MsgPackVariantConst getMember(TAdaptedString key) const {
+    auto token = decode();
+    if (token.type != TokenType::Map || key.isNull())
+      return MsgPackVariantConst();
+    const uint8_t* p = token.payload;
+    for (size_t i = 0; i < token.size; i++) {
+      auto keyToken = detail::decodeMsgPack(p, end_);
+      if (keyToken.type != TokenType::String)
+        return MsgPackVariantConst();  // deserializeMsgPack() would fail too
+      p = keyToken.next;
+      if (stringEquals(key, detail::adaptString(reinterpret_cast<const char*>(
+                                                    keyToken.payload),
+                                                keyToken.size)))
+        return MsgPackVariantConst(p, end_);
+      p = detail::skipMsgPack(p, end_);
+      if (!p)
+        return MsgPackVariantConst();
+    }
+    return MsgPackVariantConst();
+  }
+
+  bool as(type_tag<bool>) const {
+    auto token = decode();
+    switch (token.type) {
+      case TokenType::Boolean:
+        return token.boolean;
+      case TokenType::SignedInteger:
+        return token.signedInteger != 0;
+      case TokenType::UnsignedInteger:
+        return token.unsignedInteger != 0;
+      case TokenType::Float:
+        return token.floating != 0;
+      case TokenType::Null:
+      case TokenType::Invalid:
+        return false;
+      default:
+        return true;
+    }
+  }
+
+  template <typename T>
+  detail::enable_if_t<detail::is_integral<T>::value, T> as(
+      type_tag<T>) const {
+    auto token = decode();
+    switch (token.type) {
+      case TokenType::Boolean:
+        return token.boolean;
+      case TokenType::SignedInteger:
+        return detail::convertNumber<T>(token.signedInteger);
+      case TokenType::UnsignedInteger:
+        return detail::convertNumber<T>(token.unsignedInteger);
+      case TokenType::Float:
+        return detail::convertNumber<T>(token.floating);
+      case TokenType::String:
+        return parseString<T>(token);
+      default:
+        return 0;
+    }
+  }
+
+  template <typename T>
+  detail::enable_if_t<detail::is_floating_point<T>::value, T> as(
+      type_tag<T>) const {
+    auto token = decode();
+    switch (token.type) {
+      case TokenType::Boolean:
+        return static_cast<T>(token.boolean);
+      case TokenType::SignedInteger:
+        return static_cast<T>(token.signedInteger);
+      case TokenType::UnsignedInteger:
+        return static_cast<T>(token.unsignedInteger);
+      case TokenType::Float:
+        return static_cast<T>(token.floating);
+      case TokenType::String:
+        return parseString<T>(token);
+      default:
+        return 0.0;
+    }
+  }
+
+  JsonString as(type_tag<JsonString>) const {
+    auto token = decode();
+    if (token.type != TokenType::String)
+      return JsonString();
+    return JsonString(reinterpret_cast<const char*>(token.payload), token.size);
+  }
+
+  MsgPackBinary as(type_tag<MsgPackBinary>) const {
+    auto token = decode();
+    if (token.type != TokenType::Binary)
+      return MsgPackBinary();
+    return MsgPackBinary(token.payload, token.size);
+  }
+
+  MsgPackExtension as(type_tag<MsgPackExtension>) const {
+    auto token = decode();
+    if (token.type != TokenType::Extension)
+      return MsgPackExtension();
+    return MsgPackExtension(token.extensionType, token.payload, token.size);
+  }
+
+  // Other types, like std::string or the custom converters
+  template <typename T>
+  detail::enable_if_t<!detail::is_integral<T>::value &&
+                          !detail::is_floating_point<T>::value,
+                      T>
+  as(type_tag<T>) const {
+    static_assert(!detail::IsDocumentReference<T>::value,
+                  "MsgPackVariantConst can't return a reference; "
+                  "use as<JsonString>() or deserializeMsgPack()");
+    JsonDocument doc;
+    materialize(doc);
+    return doc.as<T>();
+  }
+
+  bool is(type_tag<bool>) const {
+    return decode().type == TokenType::Boolean;
+  }
+
+  template <typename T>
+  detail::enable_if_t<detail::is_integral<T>::value, bool> is(
+      type_tag<T>) const {
+    auto token = decode();
+    switch (token.type) {
+      case TokenType::SignedInteger:
+        return detail::canConvertNumber<T>(token.signedInteger);
+      case TokenType::UnsignedInteger:
+        return detail::canConvertNumber<T>(token.unsignedInteger);
+      default:
+        return false;
+    }
+  }
+
+  template <typename T>
+  detail::enable_if_t<detail::is_floating_point<T>::value, bool> is(
+      type_tag<T>) const {
+    auto type = decode().type;
+    return type == TokenType::SignedInteger ||
+           type == TokenType::UnsignedInteger || type == TokenType::Float;
+  }
+
+  template <typename T>
+  detail::enable_if_t<detail::IsString<T>::value, bool> is(type_tag<T>) const {
+    return decode().type == TokenType::String;
+  }
+
+  bool is(type_tag<MsgPackBinary>) const {
+    return decode().type == TokenType::Binary;
+  }
+
+  bool is(type_tag<MsgPackExtension>) const {
+    return decode().type == TokenType::Extension;
+  }
+
+  bool is(type_tag<JsonArrayConst>) const {
+    return decode().type == TokenType::Array;
+  }
+
+  bool is(type_tag<JsonArray>) const {
+    return decode().type == TokenType::Array;
+  }
+
+  bool is(type_tag<JsonObjectConst>) const {
+    return decode().type == TokenType::Map;
+  }
+
+  bool is(type_tag<JsonObject>) const {
+    return decode().type == TokenType::Map;
+  }
+
+  // Other types, like the custom converters
+  template <typename T>
+  detail::enable_if_t<!detail::is_integral<T>::value &&
+                          !detail::is_floating_point<T>::value &&
+                          !detail::IsString<T>::value,
+                      bool>
+  is(type_tag<T>) const {
+    JsonDocument doc;
+    materialize(doc);
+    return doc.is<T>();
+  }
+
+  template <typename T>
+  T parseString(const Token& token) const {
+    char buffer[64];
+    if (token.size >= sizeof(buffer)) {
+      JsonDocument doc;
+      materialize(doc);
+      return doc.as<T>();
+    }
+    memcpy(buffer, token.payload, token.size);
+    buffer[token.size] = 0;
+    return detail::parseNumber<T>(buffer);
+  }
+
+  void materialize(JsonDocument& doc) const {
+    auto next = detail::skipMsgPack(data_, end_);
+    if (next)
+      deserializeMsgPack(doc, data_, size_t(next - data_));
+  }
+
+  const uint8_t* data_;
+  const uint8_t* end_;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
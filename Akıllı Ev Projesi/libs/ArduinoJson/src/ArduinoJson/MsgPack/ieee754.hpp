@@ -6,6 +6,8 @@
 
 #include <ArduinoJson/Namespace.hpp>
 
+#include <string.h>  // memcpy
+
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
 inline void doubleToFloat(const uint8_t d[8], uint8_t f[4]) {
@@ -15,4 +17,29 @@ inline void doubleToFloat(const uint8_t d[8], uint8_t f[4]) {
   f[3] = uint8_t((d[3] << 3) | (d[4] >> 5));
 }
 
+// Converts a big-endian half-precision number, as found in CBOR
+inline float halfToFloat(const uint8_t h[2]) {
+  uint32_t sign = uint32_t(h[0] & 0x80) << 24;
+  uint32_t exponent = uint32_t(h[0] >> 2 & 0x1f);
+  uint32_t mantissa = uint32_t(h[0] & 0x03) << 8 | h[1];
+  uint32_t bits;
+  if (exponent == 0x1f) {  // infinity or NaN
+    bits = sign | 0x7f800000 | mantissa << 13;
+  } else if (exponent) {
+    bits = sign | (exponent + 112) << 23 | mantissa << 13;
+  } else if (mantissa) {  // subnormal, becomes normal in single precision
+    exponent = 113;
+    while (!(mantissa & 0x400)) {
+      mantissa <<= 1;
+      exponent--;
+    }
+    bits = sign | exponent << 23 | (mantissa & 0x3ff) << 13;
+  } else {
+    bits = sign;
+  }
+  float f;
+  memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
 ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -0,0 +1,103 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Namespace.hpp>
+
+#include <stddef.h>  // size_t
+#include <stdint.h>
+#include <string.h>  // memmove, memset
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// An unsigned integer of up to 4096 bits, stored as 32-bit limbs with the
+// least significant first.
+// The operations that exceed the capacity set the overflowed flag.
+class BigInteger {
+ public:
+  static const size_t capacity = 128;
+
+  BigInteger(uint64_t value = 0) {
+    while (value) {
+      push(uint32_t(value));
+      value >>= 32;
+    }
+  }
+
+  // this = this * factor + addend
+  void multiply(uint32_t factor, uint32_t addend = 0) {
+    uint64_t carry = addend;
+    for (size_t i = 0; i < size_; i++) {
+      uint64_t x = uint64_t(limbs_[i]) * factor + carry;
+      limbs_[i] = uint32_t(x);
+      carry = x >> 32;
+    }
+    if (carry)
+      push(uint32_t(carry));
+  }
+
+  void multiplyByPowerOfFive(int n) {
+    for (; n >= 13; n -= 13)
+      multiply(1220703125);  // 5^13, the largest power that fits
+    uint32_t factor = 1;
+    for (; n > 0; n--)
+      factor *= 5;
+    multiply(factor);
+  }
+
+  void shiftLeft(int n) {
+    if (!size_ || n <= 0)
+      return;
+    size_t limbShift = size_t(n) / 32;
+    int bitShift = n % 32;
+    if (size_ + limbShift >= capacity) {
+      overflowed_ = true;
+      return;
+    }
+    if (bitShift) {
+      uint32_t carry = 0;
+      for (size_t i = 0; i < size_; i++) {
+        uint32_t limb = limbs_[i];
+        limbs_[i] = limb << bitShift | carry;
+        carry = limb >> (32 - bitShift);
+      }
+      if (carry)
+        push(carry);
+    }
+    memmove(limbs_ + limbShift, limbs_, size_ * sizeof(uint32_t));
+    memset(limbs_, 0, limbShift * sizeof(uint32_t));
+    size_ += limbShift;
+  }
+
+  // Returns a negative value if this < other, zero if they're equal, and a
+  // positive value if this > other
+  int compare(const BigInteger& other) const {
+    if (size_ != other.size_)
+      return size_ < other.size_ ? -1 : 1;
+    for (size_t i = size_; i > 0; i--) {
+      if (limbs_[i - 1] != other.limbs_[i - 1])
+        return limbs_[i - 1] < other.limbs_[i - 1] ? -1 : 1;
+    }
+    return 0;
+  }
+
+  bool overflowed() const {
+    return overflowed_;
+  }
+
+ private:
+  void push(uint32_t limb) {
+    if (size_ < capacity)
+      limbs_[size_++] = limb;
+    else
+      overflowed_ = true;
+  }
+
+  uint32_t limbs_[capacity];
+  size_t size_ = 0;
+  bool overflowed_ = false;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -0,0 +1,52 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Namespace.hpp>
+#include <ArduinoJson/Polyfills/assert.hpp>
+
+#include <stdint.h>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+struct UInt128 {
+  uint64_t high;
+  uint64_t low;
+};
+
+inline UInt128 multiplyFull(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+  __extension__ using uint128_t = unsigned __int128;
+  uint128_t product = uint128_t(a) * b;
+  return {uint64_t(product >> 64), uint64_t(product)};
+#else
+  uint64_t aLow = a & 0xFFFFFFFF, aHigh = a >> 32;
+  uint64_t bLow = b & 0xFFFFFFFF, bHigh = b >> 32;
+  uint64_t lowLow = aLow * bLow;
+  uint64_t lowHigh = aLow * bHigh;
+  uint64_t highLow = aHigh * bLow;
+  uint64_t highHigh = aHigh * bHigh;
+  uint64_t middle =
+      (lowLow >> 32) + (lowHigh & 0xFFFFFFFF) + (highLow & 0xFFFFFFFF);
+  return {highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32),
+          (middle << 32) | (lowLow & 0xFFFFFFFF)};
+#endif
+}
+
+inline int countLeadingZeros(uint64_t x) {
+  ARDUINOJSON_ASSERT(x != 0);
+#if defined(__GNUC__)
+  return __builtin_clzll(x);
+#else
+  int n = 0;
+  while (!(x & 0x8000000000000000)) {
+    x <<= 1;
+    n++;
+  }
+  return n;
+#endif
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
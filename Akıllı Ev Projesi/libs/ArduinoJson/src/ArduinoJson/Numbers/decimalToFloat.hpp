@@ -0,0 +1,309 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Numbers/BigInteger.hpp>
+#include <ArduinoJson/Numbers/FloatTraits.hpp>
+#include <ArduinoJson/Numbers/PowersOfFive.hpp>
+#include <ArduinoJson/Numbers/UInt128.hpp>
+#include <ArduinoJson/Polyfills/alias_cast.hpp>
+#include <ArduinoJson/Polyfills/ctype.hpp>
+#include <ArduinoJson/Polyfills/pgmspace_generic.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// The significant digits of a decimal number: value = w * 10^q.
+// Only the first 19 digits are kept in w; the digits that don't fit are
+// dropped, and truncated tells if any of them was not zero.
+class DecimalSignificand {
+ public:
+  DecimalSignificand(uint64_t w = 0) : w_(w) {}
+
+  void appendIntegerDigit(uint8_t digit) {
+    if (!append(digit))
+      q_++;
+  }
+
+  void appendFractionalDigit(uint8_t digit) {
+    if (append(digit))
+      q_--;
+  }
+
+  uint64_t w() const {
+    return w_;
+  }
+
+  int q() const {
+    return q_;
+  }
+
+  bool truncated() const {
+    return truncated_;
+  }
+
+ private:
+  bool append(uint8_t digit) {
+    // once w is full, it never changes, so all the next digits are dropped
+    if (w_ >= 1000000000000000000) {  // w would exceed 19 digits
+      truncated_ |= digit != 0;
+      return false;
+    }
+    w_ = w_ * 10 + digit;
+    return true;
+  }
+
+  uint64_t w_;
+  int q_ = 0;
+  bool truncated_ = false;
+};
+
+template <typename T, size_t = sizeof(T)>
+struct BinaryFormat {};
+
+template <typename T>
+struct BinaryFormat<T, 8 /*64bits*/> {
+  using bits_type = uint64_t;
+  static const int mantissa_bits = 52;
+  static const int minimum_exponent = -1023;
+  static const int infinite_power = 0x7FF;
+  static const int smallest_power_of_ten = -342;
+  static const int largest_power_of_ten = 308;
+  static const int min_exponent_round_to_even = -4;
+  static const int max_exponent_round_to_even = 23;
+  static const uint64_t max_exact_integer = uint64_t(1) << 53;
+  static const int max_exact_power_of_ten = 22;
+
+  static pgm_ptr<T> exactPowersOfTen() {
+    ARDUINOJSON_DEFINE_PROGMEM_ARRAY(  //
+        uint64_t, factors,
+        {
+            0x3FF0000000000000,  // 1e0
+            0x4024000000000000,  // 1e1
+            0x4059000000000000,  // 1e2
+            0x408F400000000000,  // 1e3
+            0x40C3880000000000,  // 1e4
+            0x40F86A0000000000,  // 1e5
+            0x412E848000000000,  // 1e6
+            0x416312D000000000,  // 1e7
+            0x4197D78400000000,  // 1e8
+            0x41CDCD6500000000,  // 1e9
+            0x4202A05F20000000,  // 1e10
+            0x42374876E8000000,  // 1e11
+            0x426D1A94A2000000,  // 1e12
+            0x42A2309CE5400000,  // 1e13
+            0x42D6BCC41E900000,  // 1e14
+            0x430C6BF526340000,  // 1e15
+            0x4341C37937E08000,  // 1e16
+            0x4376345785D8A000,  // 1e17
+            0x43ABC16D674EC800,  // 1e18
+            0x43E158E460913D00,  // 1e19
+            0x4415AF1D78B58C40,  // 1e20
+            0x444B1AE4D6E2EF50,  // 1e21
+            0x4480F0CF064DD592   // 1e22
+        });
+    return pgm_ptr<T>(reinterpret_cast<const T*>(factors));
+  }
+};
+
+template <typename T>
+struct BinaryFormat<T, 4 /*32bits*/> {
+  using bits_type = uint32_t;
+  static const int mantissa_bits = 23;
+  static const int minimum_exponent = -127;
+  static const int infinite_power = 0xFF;
+  static const int smallest_power_of_ten = -65;
+  static const int largest_power_of_ten = 38;
+  static const int min_exponent_round_to_even = -17;
+  static const int max_exponent_round_to_even = 10;
+  static const uint64_t max_exact_integer = uint64_t(1) << 24;
+  static const int max_exact_power_of_ten = 10;
+
+  static pgm_ptr<T> exactPowersOfTen() {
+    ARDUINOJSON_DEFINE_PROGMEM_ARRAY(uint32_t, factors,
+                                     {
+                                         0x3F800000,  // 1e0f
+                                         0x41200000,  // 1e1f
+                                         0x42C80000,  // 1e2f
+                                         0x447A0000,  // 1e3f
+                                         0x461C4000,  // 1e4f
+                                         0x47C35000,  // 1e5f
+                                         0x49742400,  // 1e6f
+                                         0x4B189680,  // 1e7f
+                                         0x4CBEBC20,  // 1e8f
+                                         0x4E6E6B28,  // 1e9f
+                                         0x501502F9   // 1e10f
+                                     });
+    return pgm_ptr<T>(reinterpret_cast<const T*>(factors));
+  }
+};
+
+// Converts w * 10^q to the nearest float or double, with the Eisel-Lemire
+// algorithm: the result is correctly rounded, provided that w holds all the
+// digits of the number.
+// See "Number Parsing at a Gigabyte per Second" by Daniel Lemire.
+template <typename T>
+T decimalToFloat(uint64_t w, int q) {
+  using format = BinaryFormat<T>;
+  using bits_type = typename format::bits_type;
+  const int mantissa_shift = 64 - format::mantissa_bits - 3;
+
+#if !defined(__FLT_EVAL_METHOD__) || __FLT_EVAL_METHOD__ == 0
+  // w and 10^q are exact, so a single operation rounds correctly
+  if (w <= format::max_exact_integer && q >= -format::max_exact_power_of_ten &&
+      q <= format::max_exact_power_of_ten) {
+    auto powers = format::exactPowersOfTen();
+    return q < 0 ? T(w) / powers[-q] : T(w) * powers[q];
+  }
+#endif
+
+  if (w == 0 || q < format::smallest_power_of_ten)
+    return 0;
+  if (q > format::largest_power_of_ten)
+    return FloatTraits<T>::inf();
+
+  int leadingZeros = countLeadingZeros(w);
+  w <<= leadingZeros;
+
+  // multiply by the 128-bit approximation of 5^q
+  auto powers = PowersOfFive::table();
+  auto index = 2 * (q - PowersOfFive::smallest);
+  UInt128 product = multiplyFull(w, powers[index]);
+  const uint64_t precisionMask = uint64_t(-1) >> (format::mantissa_bits + 3);
+  if ((product.high & precisionMask) == precisionMask) {
+    // the low bits may carry to the high part
+    UInt128 lowProduct = multiplyFull(w, powers[index + 1]);
+    product.low += lowProduct.high;
+    if (lowProduct.high > product.low)
+      product.high++;
+  }
+
+  int upperBit = int(product.high >> 63);
+  uint64_t mantissa = product.high >> (upperBit + mantissa_shift);
+  // 217706 / 2^16 approximates log2(10)
+  int power2 = ((217706 * q) >> 16) + 63 + upperBit - leadingZeros -
+               format::minimum_exponent;
+
+  if (power2 <= 0) {  // subnormal
+    if (-power2 + 1 >= 64)
+      return 0;
+    mantissa >>= -power2 + 1;
+    mantissa += mantissa & 1;  // round up
+    mantissa >>= 1;
+    // the rounding may have produced a normal number
+    power2 = mantissa < (uint64_t(1) << format::mantissa_bits) ? 0 : 1;
+    return FloatTraits<T>::forge(
+        bits_type(mantissa | uint64_t(power2) << format::mantissa_bits));
+  }
+
+  // exactly halfway between two floats: round to even
+  if (product.low <= 1 && q >= format::min_exponent_round_to_even &&
+      q <= format::max_exponent_round_to_even && (mantissa & 3) == 1 &&
+      (mantissa << (upperBit + mantissa_shift)) == product.high)
+    mantissa &= ~uint64_t(1);
+
+  mantissa += mantissa & 1;  // round up
+  mantissa >>= 1;
+  if (mantissa >= (uint64_t(2) << format::mantissa_bits)) {
+    mantissa = uint64_t(1) << format::mantissa_bits;
+    power2++;
+  }
+  mantissa &= ~(uint64_t(1) << format::mantissa_bits);
+
+  if (power2 >= format::infinite_power)
+    return FloatTraits<T>::inf();
+
+  return FloatTraits<T>::forge(
+      bits_type(mantissa | uint64_t(power2) << format::mantissa_bits));
+}
+
+// Chooses between lower and the next float, by comparing the decimal number
+// with the halfway point between them.
+// This is slow, but it only happens when the significand has more than 19
+// digits and is very close to the halfway point.
+template <typename T>
+T roundDecimalToFloat(const char* digits, int exponent, T lower) {
+  using format = BinaryFormat<T>;
+  using bits_type = typename format::bits_type;
+  // enough to decide in all cases
+  const int maxDigits = 800;
+
+  // decimal * 10^power10
+  BigInteger decimal;
+  int power10 = exponent;
+  int count = 0;
+  bool fractional = false, truncated = false;
+  for (;; digits++) {
+    if (*digits == '.') {
+      fractional = true;
+      continue;
+    }
+    if (!isdigit(*digits))
+      break;
+    uint8_t digit = uint8_t(*digits - '0');
+    if (count < maxDigits) {
+      if (count || digit) {  // leading zeros are not significant
+        decimal.multiply(10, digit);
+        count++;
+      }
+      if (fractional)
+        power10--;
+    } else {
+      truncated |= digit != 0;
+      if (!fractional)
+        power10++;
+    }
+  }
+  if (truncated) {  // a non-zero digit breaks the ties
+    decimal.multiply(10, 1);
+    power10--;
+  }
+
+  // halfway * 2^power2
+  auto bits = alias_cast<bits_type>(lower);
+  uint64_t mantissa = bits & ((bits_type(1) << format::mantissa_bits) - 1);
+  int biasedExponent = int(bits >> format::mantissa_bits);
+  int power2 = format::minimum_exponent - format::mantissa_bits;
+  if (biasedExponent) {
+    mantissa |= uint64_t(1) << format::mantissa_bits;
+    power2 += biasedExponent;
+  } else {
+    power2 += 1;  // subnormal
+  }
+  BigInteger halfway(2 * mantissa + 1);
+  power2--;
+
+  if (power10 >= 0)
+    decimal.multiplyByPowerOfFive(power10);
+  else
+    halfway.multiplyByPowerOfFive(-power10);
+  if (power10 > power2)
+    decimal.shiftLeft(power10 - power2);
+  else
+    halfway.shiftLeft(power2 - power10);
+  if (decimal.overflowed() || halfway.overflowed())
+    return lower;
+
+  int comparison = decimal.compare(halfway);
+  bool roundUp = comparison > 0 || (comparison == 0 && (mantissa & 1));
+  return roundUp ? FloatTraits<T>::forge(bits_type(bits + 1)) : lower;
+}
+
+// Converts the significand to the nearest float or double.
+// digits points to the first digit of the number in the input; it is read
+// again when the dropped digits make the rounding ambiguous.
+template <typename T>
+T decimalToFloat(const DecimalSignificand& decimal, int exponent,
+                 const char* digits) {
+  int q = decimal.q() + exponent;
+  T result = decimalToFloat<T>(decimal.w(), q);
+  if (!decimal.truncated())
+    return result;
+  // the actual value is between w and w+1
+  if (result == decimalToFloat<T>(decimal.w() + 1, q))
+    return result;
+  return roundDecimalToFloat(digits, exponent, result);
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
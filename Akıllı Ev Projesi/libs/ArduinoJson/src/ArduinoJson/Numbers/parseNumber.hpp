@@ -7,6 +7,7 @@
 #include <ArduinoJson/Numbers/FloatTraits.hpp>
 #include <ArduinoJson/Numbers/JsonFloat.hpp>
 #include <ArduinoJson/Numbers/convertNumber.hpp>
+#include <ArduinoJson/Numbers/decimalToFloat.hpp>
 #include <ArduinoJson/Polyfills/assert.hpp>
 #include <ArduinoJson/Polyfills/ctype.hpp>
 #include <ArduinoJson/Polyfills/math.hpp>
@@ -102,10 +103,73 @@ class Number {
 #endif
 };
 
+#if ARDUINOJSON_ENABLE_EXACT_FLOAT_PARSING
+// Parses the fractional part and the exponent of a number.
+// digits points to the first digit, s to the first character that didn't fit
+// in mantissa.
+inline Number parseExactFloat(const char* digits, const char* s,
+                              uint64_t mantissa, bool is_negative) {
+  DecimalSignificand decimal(mantissa);
+
+  while (isdigit(*s)) {
+    decimal.appendIntegerDigit(uint8_t(*s - '0'));
+    s++;
+  }
+
+  if (*s == '.') {
+    s++;
+    while (isdigit(*s)) {
+      decimal.appendFractionalDigit(uint8_t(*s - '0'));
+      s++;
+    }
+  }
+
+  int exponent = 0;
+  if (*s == 'e' || *s == 'E') {
+    s++;
+    bool negative_exponent = false;
+    if (*s == '-') {
+      negative_exponent = true;
+      s++;
+    } else if (*s == '+') {
+      s++;
+    }
+
+    while (isdigit(*s)) {
+      // saturate instead of returning early because the significand may
+      // compensate a large exponent
+      if (exponent < 10000)
+        exponent = exponent * 10 + (*s - '0');
+      s++;
+    }
+    if (negative_exponent)
+      exponent = -exponent;
+  }
+
+  // we should be at the end of the string, otherwise it's an error
+  if (*s != '\0')
+    return Number();
+
+#  if ARDUINOJSON_USE_DOUBLE
+  int q = exponent + decimal.q();
+  bool isDouble = q < -FloatTraits<float>::exponent_max ||
+                  q > FloatTraits<float>::exponent_max ||
+                  decimal.w() > FloatTraits<float>::mantissa_max;
+  if (isDouble) {
+    auto final_result = decimalToFloat<double>(decimal, exponent, digits);
+    return Number(is_negative ? -final_result : final_result);
+  } else
+#  endif
+  {
+    auto final_result = decimalToFloat<float>(decimal, exponent, digits);
+    return Number(is_negative ? -final_result : final_result);
+  }
+}
+#endif
+
 inline Number parseNumber(const char* s) {
   using traits = FloatTraits<JsonFloat>;
   using mantissa_t = largest_type<traits::mantissa_type, JsonUInt>;
-  using exponent_t = traits::exponent_type;
 
   ARDUINOJSON_ASSERT(s != 0);
 
@@ -135,18 +199,19 @@ inline Number parseNumber(const char* s) {
   if (!isdigit(*s) && *s != '.')
     return Number();
 
+#if ARDUINOJSON_ENABLE_EXACT_FLOAT_PARSING
+  const char* digits = s;
+#endif
+
   mantissa_t mantissa = 0;
-  exponent_t exponent_offset = 0;
   const mantissa_t maxUint = JsonUInt(-1);
 
   while (isdigit(*s)) {
     uint8_t digit = uint8_t(*s - '0');
-    if (mantissa > maxUint / 10)
-      break;
-    mantissa *= 10;
-    if (mantissa > maxUint - digit)
+    if (mantissa >= maxUint / 10 &&
+        (mantissa > maxUint / 10 || digit > maxUint % 10))
       break;
-    mantissa += digit;
+    mantissa = mantissa * 10 + digit;
     s++;
   }
 
@@ -162,6 +227,12 @@ inline Number parseNumber(const char* s) {
     }
   }
 
+#if ARDUINOJSON_ENABLE_EXACT_FLOAT_PARSING
+  return parseExactFloat(digits, s, mantissa, is_negative);
+#else
+  using exponent_t = traits::exponent_type;
+  exponent_t exponent_offset = 0;
+
   // avoid mantissa overflow
   while (mantissa > traits::mantissa_max) {
     mantissa /= 10;
@@ -228,6 +299,7 @@ inline Number parseNumber(const char* s) {
     auto final_result = make_float(float(mantissa), exponent);
     return Number(is_negative ? -final_result : final_result);
   }
+#endif
 }
 
 template <typename T>
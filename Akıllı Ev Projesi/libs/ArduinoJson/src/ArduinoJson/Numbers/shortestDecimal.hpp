@@ -0,0 +1,190 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Numbers/PowersOfFive.hpp>
+#include <ArduinoJson/Numbers/UInt128.hpp>
+#include <ArduinoJson/Polyfills/alias_cast.hpp>
+
+#include <stddef.h>  // size_t
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// value = significand * 10^exponent
+struct ShortestDecimal {
+  uint64_t significand;
+  int exponent;
+};
+
+// floor(log10(2^e))
+inline int floorLog10Pow2(int e) {
+  return int(int64_t(e) * 661971961083 >> 41);
+}
+
+// floor(log10(3/4 * 2^e))
+inline int floorLog10ThreeQuartersPow2(int e) {
+  return int((int64_t(e) * 661971961083 - 274743187321) >> 41);
+}
+
+// floor(log2(10^e))
+inline int floorLog2Pow10(int e) {
+  return int(int64_t(e) * 913124641741 >> 38);
+}
+
+// Returns floor(10^e * 2^-r) + 1, where r is chosen so that the result is
+// in [2^125, 2^126).
+// The digits of 10^e are the ones of 5^e, so we take them from PowersOfFive.
+inline UInt128 schubfachMultiplier(int e) {
+  auto powers = PowersOfFive::table();
+  auto index = 2 * (e - PowersOfFive::smallest);
+  uint64_t high = powers[index];
+  uint64_t low = powers[index + 1];
+
+  // the negative powers are rounded up, the others are truncated
+  if (e < 0) {
+    if (low == 0)
+      high--;
+    low--;
+  }
+
+  UInt128 g = {high >> 2, high << 62 | low >> 2};
+  if (++g.low == 0)
+    g.high++;
+  return g;
+}
+
+template <typename T, size_t = sizeof(T)>
+struct SchubfachFormat {};
+
+template <typename T>
+struct SchubfachFormat<T, 8 /*64bits*/> {
+  using bits_type = uint64_t;
+  static const int precision = 53;
+  static const int min_exponent = -1074;
+  static const uint64_t tiny_significand = 3;
+  static const int multiplier_shift = 2;
+
+  // Computes g * cp / 2^127, rounded to odd
+  static uint64_t roundToOdd(UInt128 g, uint64_t cp) {
+    const uint64_t mask = 0x7FFFFFFFFFFFFFFF;
+    uint64_t g1 = g.high << 1 | g.low >> 63;
+    uint64_t g0 = g.low & mask;
+    uint64_t x1 = multiplyFull(g0, cp).high;
+    UInt128 y = multiplyFull(g1, cp);
+    uint64_t z = (y.low >> 1) + x1;
+    uint64_t vbp = y.high + (z >> 63);
+    return vbp | ((z & mask) + mask) >> 63;
+  }
+};
+
+template <typename T>
+struct SchubfachFormat<T, 4 /*32bits*/> {
+  using bits_type = uint32_t;
+  static const int precision = 24;
+  static const int min_exponent = -149;
+  static const uint64_t tiny_significand = 8;
+  static const int multiplier_shift = 33;
+
+  // Computes g * cp / 2^95, rounded to odd, using the 64 upper bits of g
+  static uint64_t roundToOdd(UInt128 g, uint64_t cp) {
+    const uint64_t mask = 0xFFFFFFFF;
+    uint64_t g1 = (g.high << 1 | g.low >> 63) + 1;
+    uint64_t x1 = multiplyFull(g1, cp).high;
+    uint64_t vbp = x1 >> 31;
+    return vbp | ((x1 & mask) + mask) >> 32;
+  }
+};
+
+// Finds the decimal closest to c * 2^q that has the fewest digits and still
+// rounds to c * 2^q.
+// See "The Schubfach way to render doubles" by Raffaello Giulietti.
+template <typename TFormat>
+ShortestDecimal schubfach(int q, uint64_t c, int dk) {
+  const uint64_t minSignificand = uint64_t(1) << (TFormat::precision - 1);
+
+  uint64_t out = c & 1;
+  uint64_t cb = c << 2;
+  uint64_t cbr = cb + 2;
+  uint64_t cbl;
+  int k;
+  if (c != minSignificand || q == TFormat::min_exponent) {
+    // regular spacing
+    cbl = cb - 2;
+    k = floorLog10Pow2(q);
+  } else {
+    // irregular spacing: the previous value is closer than the next one
+    cbl = cb - 1;
+    k = floorLog10ThreeQuartersPow2(q);
+  }
+  int h = q + floorLog2Pow10(-k) + TFormat::multiplier_shift;
+
+  UInt128 g = schubfachMultiplier(-k);
+  uint64_t vb = TFormat::roundToOdd(g, cb << h);
+  uint64_t vbl = TFormat::roundToOdd(g, cbl << h);
+  uint64_t vbr = TFormat::roundToOdd(g, cbr << h);
+
+  uint64_t s = vb >> 2;
+  if (s >= 100) {
+    // try with one digit less
+    uint64_t sp10 = s / 10 * 10;
+    uint64_t tp10 = sp10 + 10;
+    bool upin = vbl + out <= sp10 << 2;
+    bool wpin = (tp10 << 2) + out <= vbr;
+    if (upin != wpin)
+      return {upin ? sp10 : tp10, k};
+  }
+
+  uint64_t t = s + 1;
+  bool uin = vbl + out <= s << 2;
+  bool win = (t << 2) + out <= vbr;
+  if (uin != win)
+    return {uin ? s : t, k + dk};
+
+  // both candidates round to the value: pick the closest
+  uint64_t mid = (s + t) << 1;
+  bool pickS = vb < mid || (vb == mid && (s & 1) == 0);
+  return {pickS ? s : t, k + dk};
+}
+
+// Returns the shortest decimal representation of value.
+// value must be positive and finite.
+template <typename T>
+ShortestDecimal shortestDecimal(T value) {
+  using format = SchubfachFormat<T>;
+  using bits_type = typename format::bits_type;
+  const int mantissaBits = format::precision - 1;
+
+  auto bits = alias_cast<bits_type>(value);
+  uint64_t t = bits & ((bits_type(1) << mantissaBits) - 1);
+  int biasedExponent = int(bits >> mantissaBits);
+
+  ShortestDecimal result;
+  if (biasedExponent) {
+    int mq = -format::min_exponent + 1 - biasedExponent;
+    uint64_t c = uint64_t(1) << mantissaBits | t;
+    if (0 < mq && mq < format::precision && (c >> mq << mq) == c)
+      result = {c >> mq, 0};  // small integers are printed as such
+    else
+      result = schubfach<format>(-mq, c, 0);
+  } else if (t < format::tiny_significand) {
+    // tiny subnormals need an extra digit of precision
+    result = schubfach<format>(format::min_exponent, 10 * t, -1);
+  } else {
+    result = schubfach<format>(format::min_exponent, t, 0);
+  }
+
+  // remove the trailing zeros, four at a time first
+  while (result.significand % 10000 == 0) {
+    result.significand /= 10000;
+    result.exponent += 4;
+  }
+  while (result.significand % 10 == 0) {
+    result.significand /= 10;
+    result.exponent++;
+  }
+  return result;
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
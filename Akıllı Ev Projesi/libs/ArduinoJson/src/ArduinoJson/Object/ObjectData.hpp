@@ -5,6 +5,7 @@
 #pragma once
 
 #include <ArduinoJson/Collection/CollectionData.hpp>
+#include <ArduinoJson/Memory/KeyIndex.hpp>
 
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
@@ -41,9 +42,7 @@ class ObjectData : public CollectionData {
     obj->removeMember(key, resources);
   }
 
-  void remove(iterator it, ResourceManager* resources) {
-    CollectionData::removePair(it, resources);
-  }
+  void remove(iterator it, ResourceManager* resources);
 
   static void remove(ObjectData* obj, ObjectData::iterator it,
                      ResourceManager* resources) {
@@ -65,6 +64,17 @@ class ObjectData : public CollectionData {
  private:
   template <typename TAdaptedString>
   iterator findKey(TAdaptedString key, const ResourceManager* resources) const;
+
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+  template <typename TAdaptedString>
+  iterator findKeyInIndex(KeyIndex* index, TAdaptedString key,
+                          const ResourceManager* resources) const;
+
+  bool updateKeyIndex(KeyIndex* index, const ResourceManager* resources) const;
+
+  SlotId getPreviousKey(VariantData* key,
+                        const ResourceManager* resources) const;
+#endif
 };
 
 ARDUINOJSON_END_PRIVATE_NAMESPACE
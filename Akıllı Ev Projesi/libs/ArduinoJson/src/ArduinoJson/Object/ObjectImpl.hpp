@@ -34,15 +34,109 @@ inline ObjectData::iterator ObjectData::findKey(
     TAdaptedString key, const ResourceManager* resources) const {
   if (key.isNull())
     return iterator();
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+  auto index = resources->getKeyIndex(head());
+  if (index && updateKeyIndex(index, resources))
+    return findKeyInIndex(index, key, resources);
+  size_t keyCount = 0;
+#endif
   bool isKey = true;
   for (auto it = createIterator(resources); !it.done(); it.next(resources)) {
-    if (isKey && stringEquals(key, adaptString(it->asString())))
-      return it;
+    if (isKey) {
+      if (stringEquals(key, adaptString(it->asString())))
+        return it;
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+      if (++keyCount == ARDUINOJSON_OBJECT_INDEX_THRESHOLD && !index) {
+        // the object is large enough to be worth indexing
+        index = resources->createKeyIndex(head());
+        if (index && updateKeyIndex(index, resources))
+          return findKeyInIndex(index, key, resources);
+      }
+#endif
+    }
     isKey = !isKey;
   }
   return iterator();
 }
 
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+template <typename TAdaptedString>
+struct KeyEquals {
+  const TAdaptedString& key;
+  const ResourceManager* resources;
+
+  bool operator()(SlotId id) const {
+    return stringEquals(key,
+                        adaptString(resources->getVariant(id)->asString()));
+  }
+};
+
+template <typename TAdaptedString>
+inline ObjectData::iterator ObjectData::findKeyInIndex(
+    KeyIndex* index, TAdaptedString key,
+    const ResourceManager* resources) const {
+  auto id = index->find(stringHash(key),
+                        KeyEquals<TAdaptedString>{key, resources});
+  if (id == NULL_SLOT)
+    return iterator();
+  return iterator(resources->getVariant(id), id);
+}
+
+// Indexes the keys appended since the last update.
+// Returns false if the index cannot be used.
+inline bool ObjectData::updateKeyIndex(KeyIndex* index,
+                                       const ResourceManager* resources) const {
+  auto keyId = head();
+  if (index->lastKey() != NULL_SLOT) {
+    auto valueId = resources->getVariant(index->lastKey())->next();
+    keyId = resources->getVariant(valueId)->next();
+  }
+  while (keyId != NULL_SLOT) {
+    auto keySlot = resources->getVariant(keyId);
+    auto str = keySlot->asString();
+    if (str.isNull())  // key not set yet
+      return false;
+    if (!index->insert(stringHash(adaptString(str)), keyId,
+                       resources->allocator())) {
+      resources->destroyKeyIndex(head());
+      return false;
+    }
+    keyId = resources->getVariant(keySlot->next())->next();
+  }
+  return true;
+}
+
+// Returns the key of the member before the one of the specified key
+inline SlotId ObjectData::getPreviousKey(
+    VariantData* key, const ResourceManager* resources) const {
+  auto value = getPreviousSlot(key, resources);
+  if (!value)
+    return NULL_SLOT;
+  return getPreviousSlot(value.ptr(), resources).id();
+}
+#endif
+
+inline void ObjectData::remove(iterator it, ResourceManager* resources) {
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+  auto index = resources->getKeyIndex(head());
+  if (index && !it.done()) {
+    auto keyId = it.currentId_;
+    auto key = it->asString();
+    if (!key.isNull()) {  // the key is null while the member is being added
+      index->remove(stringHash(adaptString(key)), keyId);
+      if (keyId == index->lastKey())
+        index->setLastKey(getPreviousKey(it.slot_, resources));
+      if (keyId == head()) {
+        auto valueId = it.nextId_;
+        resources->renameKeyIndex(head(),
+                                  resources->getVariant(valueId)->next());
+      }
+    }
+  }
+#endif
+  CollectionData::removePair(it, resources);
+}
+
 template <typename TAdaptedString>
 inline void ObjectData::removeMember(TAdaptedString key,
                                      ResourceManager* resources) {
@@ -29,6 +29,11 @@ inline uint32_t pgm_read(const uint32_t* p) {
   return pgm_read_dword(p);
 }
 
+inline uint64_t pgm_read(const uint64_t* p) {
+  auto words = reinterpret_cast<const uint32_t*>(p);
+  return uint64_t(pgm_read_dword(words + 1)) << 32 | pgm_read_dword(words);
+}
+
 inline double pgm_read(const double* p) {
   return pgm_read_double(p);
 }
@@ -0,0 +1,71 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Namespace.hpp>
+
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Groups the small writes of the serializers into blocks of N bytes.
+// Once the destination refuses a byte, every following write is refused, so
+// that the count is the number of bytes actually written.
+template <typename TWriter, size_t N>
+class BufferingDecorator {
+ public:
+  explicit BufferingDecorator(TWriter writer)
+      : writer_(writer), size_(0), lost_(0), failed_(false) {}
+
+  BufferingDecorator(const BufferingDecorator&) = delete;
+  BufferingDecorator& operator=(const BufferingDecorator&) = delete;
+
+  size_t write(uint8_t c) {
+    if (size_ == N)
+      flush();
+    if (failed_)
+      return 0;
+    buffer_[size_++] = c;
+    return 1;
+  }
+
+  size_t write(const uint8_t* s, size_t n) {
+    if (size_ + n > N)
+      flush();
+    if (failed_)
+      return 0;
+    if (n >= N) {
+      size_t written = writer_.write(s, n);
+      failed_ = written < n;
+      return written;
+    }
+    memcpy(buffer_ + size_, s, n);
+    size_ += n;
+    return n;
+  }
+
+  // Writes the pending bytes.
+  // Returns the number of bytes that were accepted but couldn't be written.
+  size_t flush() {
+    if (size_ > 0) {
+      size_t written = writer_.write(buffer_, size_);
+      if (written < size_) {
+        lost_ += size_ - written;
+        failed_ = true;
+      }
+      size_ = 0;
+    }
+    return lost_;
+  }
+
+ private:
+  TWriter writer_;
+  uint8_t buffer_[N];
+  size_t size_;
+  size_t lost_;
+  bool failed_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
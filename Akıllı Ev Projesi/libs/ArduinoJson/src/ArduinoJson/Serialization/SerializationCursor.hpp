@@ -0,0 +1,301 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/ResourceManager.hpp>
+#include <ArduinoJson/Serialization/Writer.hpp>
+#include <ArduinoJson/Variant/VariantData.hpp>
+
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Receives the bytes of one token of the output.
+// It drops the bytes that a previous chunk already delivered, and remembers
+// whether the token didn't fit in the rest of the buffer.
+class ChunkBuffer {
+ public:
+  ChunkBuffer(uint8_t* buffer, size_t size)
+      : begin_(buffer), ptr_(buffer), end_(buffer + size) {}
+
+  void startToken(size_t skip) {
+    skip_ = skip;
+    tokenBegin_ = ptr_;
+    truncated_ = false;
+  }
+
+  size_t write(uint8_t c) {
+    if (skip_)
+      skip_--;
+    else if (ptr_ < end_)
+      *ptr_++ = c;
+    else
+      truncated_ = true;
+    return 1;
+  }
+
+  size_t write(const uint8_t* s, size_t n) {
+    size_t skipped = skip_ < n ? skip_ : n;
+    skip_ -= skipped;
+    size_t remaining = n - skipped;
+    size_t room = size_t(end_ - ptr_);
+    size_t copied = remaining < room ? remaining : room;
+    if (copied) {
+      memcpy(ptr_, s + skipped, copied);
+      ptr_ += copied;
+    }
+    if (copied < remaining)
+      truncated_ = true;
+    return n;
+  }
+
+  // Returns true if the current token didn't fit in the chunk
+  bool truncated() const {
+    return truncated_;
+  }
+
+  // Number of bytes of the current token written in this chunk
+  size_t tokenSize() const {
+    return size_t(ptr_ - tokenBegin_);
+  }
+
+  size_t size() const {
+    return size_t(ptr_ - begin_);
+  }
+
+ private:
+  uint8_t* begin_;
+  uint8_t* ptr_;
+  uint8_t* end_;
+  uint8_t* tokenBegin_ = nullptr;
+  size_t skip_ = 0;
+  bool truncated_ = false;
+};
+
+// Serializes a variant in chunks of any size.
+// The output is cut in tokens: a scalar, a key, the start or the end of a
+// collection, or a separator. The cursor keeps the stack of open collections
+// and the number of bytes of the current token that were already delivered,
+// so each chunk resumes where the previous one stopped instead of starting
+// over. A token that spans several chunks is formatted again for each of
+// them, so strings are cut in tokens of stringPartSize characters: the work
+// stays proportional to the size of the output, whatever the chunk size.
+//
+// TFormat<TWriter> must derive from the serializer of the format, and add:
+//   void writeStart(bool isObject, size_t size)
+//   void writeSeparator(bool first, bool isValue, size_t depth)
+//   void writeEnd(bool isObject, bool empty, size_t depth)
+//   void writeStringStart(size_t size)
+//   void writeStringPart(const char* s, size_t n)
+//   void writeStringEnd()
+// Raw strings are written in parts with TFormat::visit(RawString).
+//
+// The variant must not be modified while the cursor is in use.
+template <template <typename> class TFormat>
+class SerializationCursor {
+ public:
+  explicit SerializationCursor(ArduinoJson::JsonVariantConst source)
+      : resources_(VariantAttorney::getResourceManager(source)),
+        current_(VariantAttorney::getData(source)) {}
+
+  SerializationCursor(const SerializationCursor&) = delete;
+  SerializationCursor& operator=(const SerializationCursor&) = delete;
+
+  ~SerializationCursor() {
+    if (frames_)
+      resources_->allocator()->deallocate(frames_);
+  }
+
+  // Writes the next chunk of the output, up to size bytes.
+  // Returns the number of bytes written, which is 0 once the output is
+  // complete or after an error. If size is 0, it returns 0 and does nothing.
+  size_t read(void* buffer, size_t size) {
+    if (!size)
+      return 0;
+    ChunkBuffer chunk(reinterpret_cast<uint8_t*>(buffer), size);
+    while (state_ != State::Done && state_ != State::Error) {
+      chunk.startToken(offset_);
+      writeToken(chunk);
+      if (chunk.truncated()) {
+        offset_ += chunk.tokenSize();
+        break;
+      }
+      offset_ = 0;
+      next();
+    }
+    return chunk.size();
+  }
+
+  // Returns true when the whole output was written
+  bool done() const {
+    return state_ == State::Done;
+  }
+
+  // Returns true if the cursor couldn't allocate its stack. The output stops
+  // at the collection that needed it, and done() remains false.
+  bool failed() const {
+    return state_ == State::Error;
+  }
+
+ private:
+  enum class State : uint8_t {
+    Value,      // current_ is the next value or key
+    String,     // the next part of string_, from stringPos_
+    StringEnd,  // the end of string_
+    Child,      // a separator or the end of the top collection
+    Done,
+    Error,      // couldn't allocate the stack
+  };
+
+  // The number of characters of a string in each token
+  static constexpr size_t stringPartSize = 64;
+
+  // An array or an object that is still open
+  struct Frame {
+    SlotId next;  // the next element, key, or value
+    bool isObject;
+    bool isKey;  // for objects, true if next is a key
+    bool first;
+  };
+
+  // Writes the current token; doesn't change the state so that the same
+  // token can be written again in the next chunk
+  void writeToken(ChunkBuffer& chunk) {
+    TFormat<Writer<ChunkBuffer>> format(Writer<ChunkBuffer>(chunk), resources_);
+    if (state_ == State::Value) {
+      if (current_ && current_->isCollection())
+        format.writeStart(current_->isObject(), current_->size(resources_));
+      else if (current_ && current_->isString())
+        format.writeStringStart(current_->asString().size());
+      else if (!current_ || current_->asRawString().isNull())
+        VariantData::accept(current_, resources_, format);
+      // a raw string has no start
+    } else if (state_ == State::String) {
+      size_t n = stringSize_ - stringPos_;
+      if (n > stringPartSize)
+        n = stringPartSize;
+      if (stringIsRaw_)
+        format.visit(RawString(string_ + stringPos_, n));
+      else
+        format.writeStringPart(string_ + stringPos_, n);
+    } else if (state_ == State::StringEnd) {
+      format.writeStringEnd();
+    } else {
+      const Frame& frame = top();
+      if (frame.next != NULL_SLOT)
+        format.writeSeparator(frame.first, frame.isObject && !frame.isKey,
+                              depth_);
+      else
+        format.writeEnd(frame.isObject, frame.first, depth_);
+    }
+  }
+
+  // Moves to the next token
+  void next() {
+    if (state_ == State::Value) {
+      if (current_ && current_->isCollection())
+        push();
+      else if (current_ && current_->isString())
+        startString(current_->asString(), false);
+      else if (current_ && !current_->asRawString().isNull())
+        startString(current_->asRawString(), true);
+      else
+        endValue();
+    } else if (state_ == State::String) {
+      stringPos_ += stringPartSize;
+      if (stringPos_ >= stringSize_)
+        endString();
+    } else if (state_ == State::StringEnd) {
+      endValue();
+    } else {
+      Frame& frame = top();
+      if (frame.next != NULL_SLOT) {
+        current_ = resources_->getVariant(frame.next);
+        frame.next = current_->next();
+        frame.first = false;
+        if (frame.isObject)
+          frame.isKey = !frame.isKey;
+        state_ = State::Value;
+      } else {
+        depth_--;
+        endValue();
+      }
+    }
+  }
+
+  // The characters are saved because the size of a linked string isn't
+  // stored in the variant
+  void startString(JsonString s, bool raw) {
+    string_ = s.c_str();
+    stringSize_ = s.size();
+    stringPos_ = 0;
+    stringIsRaw_ = raw;
+    if (stringSize_)
+      state_ = State::String;
+    else
+      endString();
+  }
+
+  void endString() {
+    if (stringIsRaw_)
+      endValue();
+    else
+      state_ = State::StringEnd;
+  }
+
+  void endValue() {
+    state_ = depth_ ? State::Child : State::Done;
+  }
+
+  void push() {
+    if (depth_ == capacity_) {
+      size_t newCapacity = capacity_ ? capacity_ * 2 : 4;
+      auto newFrames = reinterpret_cast<Frame*>(
+          resources_->allocator()->reallocate(frames_,
+                                              newCapacity * sizeof(Frame)));
+      if (!newFrames) {
+        state_ = State::Error;
+        return;
+      }
+      frames_ = newFrames;
+      capacity_ = newCapacity;
+    }
+
+    Frame& frame = frames_[depth_++];
+    frame.next = current_->asCollection()->head();
+    frame.isObject = current_->isObject();
+    frame.isKey = true;
+    frame.first = true;
+    state_ = State::Child;
+  }
+
+  Frame& top() {
+    ARDUINOJSON_ASSERT(depth_ > 0);
+    return frames_[depth_ - 1];
+  }
+
+  const Frame& top() const {
+    ARDUINOJSON_ASSERT(depth_ > 0);
+    return frames_[depth_ - 1];
+  }
+
+  const ResourceManager* resources_;
+  const VariantData* current_;
+  State state_ = State::Value;
+  size_t offset_ = 0;  // bytes of the current token already written
+
+  // the string being written
+  const char* string_ = nullptr;
+  size_t stringSize_ = 0;
+  size_t stringPos_ = 0;
+  bool stringIsRaw_ = false;
+
+  // the stack of open arrays and objects
+  Frame* frames_ = nullptr;
+  size_t depth_ = 0;
+  size_t capacity_ = 0;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
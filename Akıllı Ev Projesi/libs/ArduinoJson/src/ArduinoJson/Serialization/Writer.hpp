@@ -5,6 +5,7 @@
 #pragma once
 
 #include <ArduinoJson/Namespace.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
 
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
@@ -26,6 +27,11 @@ class Writer {
   TDestination* dest_;
 };
 
+// Destinations that pay a call for each write(), so serialize() groups the
+// writes with a BufferingDecorator
+template <typename TDestination, typename Enable = void>
+struct IsBufferedDestination : false_type {};
+
 ARDUINOJSON_END_PRIVATE_NAMESPACE
 
 #include <ArduinoJson/Serialization/Writers/StaticStringWriter.hpp>
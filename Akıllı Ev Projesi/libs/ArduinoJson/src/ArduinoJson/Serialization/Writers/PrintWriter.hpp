@@ -26,4 +26,9 @@ class Writer<TDestination,
   ::Print* print_;
 };
 
+template <typename TDestination>
+struct IsBufferedDestination<
+    TDestination, enable_if_t<is_base_of<::Print, TDestination>::value>>
+    : true_type {};
+
 ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -29,4 +29,9 @@ class Writer<TDestination,
   std::ostream* os_;
 };
 
+template <typename TDestination>
+struct IsBufferedDestination<
+    TDestination, enable_if_t<is_base_of<std::ostream, TDestination>::value>>
+    : true_type {};
+
 ARDUINOJSON_END_PRIVATE_NAMESPACE
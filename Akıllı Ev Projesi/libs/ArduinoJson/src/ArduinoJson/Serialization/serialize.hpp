@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <ArduinoJson/Serialization/BufferingDecorator.hpp>
 #include <ArduinoJson/Serialization/Writer.hpp>
 
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
@@ -16,13 +17,28 @@ size_t doSerialize(ArduinoJson::JsonVariantConst source, TWriter writer) {
   return VariantData::accept(data, resources, serializer);
 }
 
+template <typename TDestination>
+struct UseWriterBuffer
+    : bool_constant<(ARDUINOJSON_WRITER_BUFFER_SIZE > 0) &&
+                    IsBufferedDestination<TDestination>::value> {};
+
 template <template <typename> class TSerializer, typename TDestination>
-size_t serialize(ArduinoJson::JsonVariantConst source,
-                 TDestination& destination) {
+enable_if_t<!UseWriterBuffer<TDestination>::value, size_t> serialize(
+    ArduinoJson::JsonVariantConst source, TDestination& destination) {
   Writer<TDestination> writer(destination);
   return doSerialize<TSerializer>(source, writer);
 }
 
+template <template <typename> class TSerializer, typename TDestination>
+enable_if_t<UseWriterBuffer<TDestination>::value, size_t> serialize(
+    ArduinoJson::JsonVariantConst source, TDestination& destination) {
+  using Buffer =
+      BufferingDecorator<Writer<TDestination>, ARDUINOJSON_WRITER_BUFFER_SIZE>;
+  Buffer buffer(Writer<TDestination>{destination});
+  size_t n = doSerialize<TSerializer>(source, Writer<Buffer>(buffer));
+  return n - buffer.flush();
+}
+
 template <template <typename> class TSerializer>
 enable_if_t<!TSerializer<StaticStringWriter>::producesText, size_t> serialize(
     ArduinoJson::JsonVariantConst source, void* buffer, size_t bufferSize) {
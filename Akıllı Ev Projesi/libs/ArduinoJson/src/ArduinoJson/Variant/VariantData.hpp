@@ -31,6 +31,9 @@ class VariantData {
   VariantContent content_;  // must be first to allow cast from array to variant
   VariantType type_;
   SlotId next_;
+#if ARDUINOJSON_DOUBLY_LINKED_COLLECTIONS
+  SlotId prev_;
+#endif
 
  public:
   // Placement new
@@ -40,7 +43,12 @@ class VariantData {
 
   static void operator delete(void*, void*) noexcept {}
 
+#if ARDUINOJSON_DOUBLY_LINKED_COLLECTIONS
+  VariantData()
+      : type_(VariantType::Null), next_(NULL_SLOT), prev_(NULL_SLOT) {}
+#else
   VariantData() : type_(VariantType::Null), next_(NULL_SLOT) {}
+#endif
 
   SlotId next() const {
     return next_;
@@ -50,6 +58,16 @@ class VariantData {
     next_ = slot;
   }
 
+#if ARDUINOJSON_DOUBLY_LINKED_COLLECTIONS
+  SlotId prev() const {
+    return prev_;
+  }
+
+  void setPrev(SlotId slot) {
+    prev_ = slot;
+  }
+#endif
+
   template <typename TVisitor>
   typename TVisitor::result_type accept(
       TVisitor& visit, const ResourceManager* resources) const {
@@ -543,6 +561,39 @@ class VariantData {
     content_.asTinyString[n] = 0;
   }
 
+  // Returns the node of an owned or raw string
+  StringNode* stringNode() const {
+    return type_ == VariantType::OwnedString || type_ == VariantType::RawString
+               ? content_.asOwnedString
+               : nullptr;
+  }
+
+  // Returns the bytes of the value; used by the snapshots, which check the
+  // tiny strings and the booleans that come from a file
+  const uint8_t* contentBytes() const {
+    return reinterpret_cast<const uint8_t*>(&content_);
+  }
+
+#if ARDUINOJSON_USE_EXTENSIONS
+  // Returns the slot that holds the value of a 64-bit number
+  SlotId extensionSlot() const {
+    return type_ & VariantTypeBits::ExtensionBit ? content_.asSlotId
+                                                 : NULL_SLOT;
+  }
+#endif
+
+  // Replaces the characters of a linked, owned, or raw string; used by the
+  // snapshots, whose strings move with the image.
+  // A linked string becomes an owned string.
+  void relinkString(StringNode* s) {
+    ARDUINOJSON_ASSERT(type_ == VariantType::LinkedString ||
+                       type_ == VariantType::OwnedString ||
+                       type_ == VariantType::RawString);
+    if (type_ == VariantType::LinkedString)
+      type_ = VariantType::OwnedString;
+    content_.asOwnedString = s;
+  }
+
   void setOwnedString(StringNode* s) {
     ARDUINOJSON_ASSERT(type_ == VariantType::Null);  // must call clear() first
     ARDUINOJSON_ASSERT(s);